@@ -0,0 +1,369 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+// packed AppMessage payloads; the layouts must match the decoders in main.c
+//
+// departures (KEY_DEPARTURES), a complete departure table that replaces the watch's table:
+//   [0]       protocol version
+//   [1]       number of train records
+//   [2-4]     origin CRS
+//   [5-7]     destination CRS
+//   [8-11]    time difference from UTC in seconds, int32
+//   [12-15]   base time, seconds since epoch, uint32
+//   then one record per train, in slot order:
+//   [0-1]     departure time, minutes after the base time, uint16
+//   [2-3]     destination CRS, packed in base 26 (AAA = 0), or 0xFFFF if unknown
+//   [4]       platform number, or 0 if unknown
+//   [5]       flags (bit 0: cancelled, bit 1: delayed without an estimate, so the time is the scheduled time)
+//
+// departure updates (KEY_DEPARTURE_UPDATES), changes to the watch's departure table:
+//   [0]       protocol version
+//   [1]       number of update records
+//   [2-5]     time difference from UTC in seconds, int32
+//   then one record per changed train:
+//   [0]       slot; the slot after the last one in use adds a train
+//   [1-6]     train record, as above, relative to the base time of the watch's table
+//
+// boards (KEY_BOARDS), the next few trains on other routes, which replace the watch's boards:
+//   [0]       protocol version
+//   [1]       number of boards
+//   [2-5]     base time, seconds since epoch, uint32
+//   then for each board:
+//   [0-2]     origin CRS
+//   [3-5]     destination CRS
+//   [6]       number of train records
+//   then one train record per train, as above, relative to the base time
+//
+// journeys (KEY_JOURNEYS), the best journeys with a change, which replace the watch's departure table:
+//   [0-15]    header, as for departures; the destination is the final destination
+//   then one record per journey, in slot order:
+//   [0-5]     train record, as above, for the first leg; the destination is that of the second leg's train
+//   [6-7]     arrival time at the final destination, minutes after the base time, uint16
+//
+// next service details (KEY_NEXT_SERVICE_DETAILS), for the next train on the watch's departure table:
+//   [0]       protocol version
+//   [1-4]     departure time of the train, seconds since epoch, uint32
+//   [5-6]     destination CRS of the train, packed as in train records
+//   [7-8]     minutes from departure to the expected arrival at the route's destination, uint16
+//   [9]       number of stops before the route's destination
+//
+// config (KEY_CONFIG):
+//   [0]       protocol version
+//   [1-2]     config generation, uint16; a hash of bytes [3-8], never 0
+//   [3]       flags (bit 0: customised days, bit 1: customised times, bit 2: update only on tap,
+//             bit 3: learned times)
+//   [4]       days on which to update (bit 0: Sunday ... bit 6: Saturday)
+//   [5-8]     morning start, morning end, afternoon start, afternoon end hours
+//
+// stats (KEY_STATS), from the watch: the Stats struct in stats.c; see decodeStats()
+//
+// the watch reports the generation of its stored config with each update request (KEY_CONFIG_GENERATION),
+// so that the config only needs to be sent when it has changed
+//
+// all multi-byte values are little-endian
+
+var codec = (function() {
+    var PROTOCOL_VERSION = 3;
+    var CRS_CODE_UNKNOWN = 0xFFFF;
+    var TRAIN_FLAG_CANCELLED = 0x01;
+    var TRAIN_FLAG_DELAYED = 0x02;
+    var CONFIG_FLAG_CUSTOMISED_DAYS = 0x01;
+    var CONFIG_FLAG_CUSTOMISED_TIMES = 0x02;
+    var CONFIG_FLAG_UPDATE_ONLY_ON_TAP = 0x04;
+    var CONFIG_FLAG_LEARNED_TIMES = 0x08;
+
+    function pushUint32(bytes, value) {
+        bytes.push(value & 0xFF, (value >>> 8) & 0xFF, (value >>> 16) & 0xFF, (value >>> 24) & 0xFF);
+    }
+
+    function pushUint16(bytes, value) {
+        bytes.push(value & 0xFF, (value >>> 8) & 0xFF);
+    }
+
+    function pushCRSCode(bytes, crs) {
+        var code = 0;
+        if (!crs || !/^[A-Z]{3}$/.test(crs)) {
+            code = CRS_CODE_UNKNOWN;
+        }
+        else {
+            for (var i = 0; i < 3; i++) {
+                code = code * 26 + crs.charCodeAt(i) - 65;
+            }
+        }
+        pushUint16(bytes, code);
+    }
+
+    function pushTrain(bytes, base, trains, i) {
+        var platform = trains.platform[i];
+        if (!(platform > 0 && platform <= 0xFF)) {
+            platform = 0;
+        }
+
+        pushUint16(bytes, Math.max(0, Math.round((trains.time[i] - base) / 60)));
+        pushCRSCode(bytes, trains.dest[i]);
+        bytes.push(platform);
+        bytes.push((trains.cancelled[i] ? TRAIN_FLAG_CANCELLED : 0) | (trains.delayed[i] ? TRAIN_FLAG_DELAYED : 0));
+    }
+
+    function readUint(bytes, offset, size) {
+        var value = 0;
+        for (var i = size - 1; i >= 0; i--) {
+            value = value * 256 + bytes[offset + i];
+        }
+        return value;
+    }
+
+    function pushCRS(bytes, crs) {
+        for (var i = 0; i < 3; i++) {
+            bytes.push(crs && i < crs.length ? crs.charCodeAt(i) & 0xFF : 0);
+        }
+    }
+
+    /**
+     * Encodes a departures payload.
+     * @param origin CRS code of the origin station
+     * @param destination CRS code of the destination station
+     * @param timeDiffSeconds Amount to add to the watch's clock to correct it
+     * @param base Base time of the table, in seconds since epoch; no later than the first train
+     * @param trains Departure table {time: [seconds since epoch], dest: [CRS code], platform: [int], cancelled: [bool],
+     *               delayed: [bool]}
+     * @returns Array of byte values, suitable for Pebble.sendAppMessage()
+     */
+    function encodeDepartures(origin, destination, timeDiffSeconds, base, trains) {
+        var bytes = [PROTOCOL_VERSION, trains.time.length];
+        pushCRS(bytes, origin);
+        pushCRS(bytes, destination);
+        pushUint32(bytes, timeDiffSeconds | 0);
+        pushUint32(bytes, base);
+
+        for (var i = 0; i < trains.time.length; i++) {
+            pushTrain(bytes, base, trains, i);
+        }
+
+        return bytes;
+    }
+
+    /**
+     * Encodes a departure updates payload.
+     * @param timeDiffSeconds Amount to add to the watch's clock to correct it
+     * @param base Base time of the watch's departure table, in seconds since epoch
+     * @param trains The updated departure table
+     * @param slots Slots of the trains in the table that have changed
+     * @returns Array of byte values, suitable for Pebble.sendAppMessage()
+     */
+    function encodeDepartureUpdates(timeDiffSeconds, base, trains, slots) {
+        var bytes = [PROTOCOL_VERSION, slots.length];
+        pushUint32(bytes, timeDiffSeconds | 0);
+
+        for (var i = 0; i < slots.length; i++) {
+            bytes.push(slots[i]);
+            pushTrain(bytes, base, trains, slots[i]);
+        }
+
+        return bytes;
+    }
+
+    /**
+     * Encodes a boards payload.
+     * @param base Base time of the boards, in seconds since epoch; no later than the first train of any board
+     * @param boards Array of {origin, destination, trains}, where trains is a departure table as for encodeDepartures()
+     * @returns Array of byte values, suitable for Pebble.sendAppMessage()
+     */
+    function encodeBoards(base, boards) {
+        var bytes = [PROTOCOL_VERSION, boards.length];
+        pushUint32(bytes, base);
+
+        for (var i = 0; i < boards.length; i++) {
+            pushCRS(bytes, boards[i].origin);
+            pushCRS(bytes, boards[i].destination);
+            bytes.push(boards[i].trains.time.length);
+
+            for (var j = 0; j < boards[i].trains.time.length; j++) {
+                pushTrain(bytes, base, boards[i].trains, j);
+            }
+        }
+
+        return bytes;
+    }
+
+    /**
+     * Encodes a journeys payload.
+     * @param origin CRS code of the origin station
+     * @param destination CRS code of the final destination
+     * @param timeDiffSeconds Amount to add to the watch's clock to correct it
+     * @param base Base time of the table, in seconds since epoch; no later than the first journey
+     * @param journeys Departure table as for encodeDepartures(), with arrival: [seconds since epoch]
+     * @returns Array of byte values, suitable for Pebble.sendAppMessage()
+     */
+    function encodeJourneys(origin, destination, timeDiffSeconds, base, journeys) {
+        var bytes = encodeDepartures(origin, destination, timeDiffSeconds, base, {time: [], dest: [], platform: [], cancelled: []});
+        bytes[1] = journeys.time.length;
+
+        for (var i = 0; i < journeys.time.length; i++) {
+            pushTrain(bytes, base, journeys, i);
+            pushUint16(bytes, Math.max(0, Math.round((journeys.arrival[i] - base) / 60)));
+        }
+
+        return bytes;
+    }
+
+    /**
+     * Encodes a next service details payload.
+     * @param time Departure time of the train, in seconds since epoch
+     * @param dest CRS code of the train's destination
+     * @param arrival Expected arrival time at the route's destination, in seconds since epoch
+     * @param stops Number of stops before the route's destination
+     * @returns Array of byte values, suitable for Pebble.sendAppMessage()
+     */
+    function encodeServiceDetails(time, dest, arrival, stops) {
+        var bytes = [PROTOCOL_VERSION];
+        pushUint32(bytes, time);
+        pushCRSCode(bytes, dest);
+        pushUint16(bytes, Math.max(0, Math.round((arrival - time) / 60)));
+        bytes.push(Math.min(stops, 0xFF));
+        return bytes;
+    }
+
+    function encodeConfigBody(config) {
+        var flags = 0;
+        if (config.customisedDays) {
+            flags |= CONFIG_FLAG_CUSTOMISED_DAYS;
+        }
+        if (config.customisedTimes) {
+            flags |= CONFIG_FLAG_CUSTOMISED_TIMES;
+        }
+        if (config.updateOnlyOnTap) {
+            flags |= CONFIG_FLAG_UPDATE_ONLY_ON_TAP;
+        }
+        if (config.learnedTimes) {
+            flags |= CONFIG_FLAG_LEARNED_TIMES;
+        }
+
+        var days = 0;
+        for (var i = 0; i < 7; i++) {
+            if (config.days[i]) {
+                days |= 1 << i;
+            }
+        }
+
+        var bytes = [flags, days];
+        for (var j = 0; j < 4; j++) {
+            bytes.push(parseInt(config.hours[j]) & 0xFF);
+        }
+
+        return bytes;
+    }
+
+    /**
+     * Calculates the generation of a config, which changes whenever any config value changes.
+     * @param config {customisedDays, days: [7 bools, Sunday first], customisedTimes, hours: [4 ints], updateOnlyOnTap, learnedTimes}
+     * @returns Non-zero 16-bit integer
+     */
+    function configGeneration(config) {
+        // 32-bit FNV-1a hash, folded to 16 bits
+        var body = encodeConfigBody(config);
+        var hash = 0x811C9DC5;
+        for (var i = 0; i < body.length; i++) {
+            hash ^= body[i];
+            hash = (hash + (hash << 1) + (hash << 4) + (hash << 7) + (hash << 8) + (hash << 24)) >>> 0;     // multiply by FNV prime without losing precision
+        }
+        hash = ((hash >>> 16) ^ hash) & 0xFFFF;
+
+        return hash === 0 ? 1 : hash;
+    }
+
+    /**
+     * Encodes a config payload.
+     * @param config {customisedDays, days: [7 bools, Sunday first], customisedTimes, hours: [4 ints], updateOnlyOnTap, learnedTimes}
+     * @returns Array of byte values, suitable for Pebble.sendAppMessage()
+     */
+    function encodeConfig(config) {
+        var generation = configGeneration(config);
+        return [PROTOCOL_VERSION, generation & 0xFF, generation >>> 8].concat(encodeConfigBody(config));
+    }
+
+    /**
+     * Decodes a stats payload from the watch.
+     * @param bytes Array of byte values, as received in KEY_STATS
+     * @returns Object with the watch's instrumentation counters, or null if the layout is not recognised
+     */
+    function decodeStats(bytes) {
+        var STATS_VERSION = 1;
+        var LAYERS = ['time', 'date', 'trains', 'info'];
+        var LATENCY_SAMPLES = 16;
+        var RESULT_BUCKETS = 16;
+
+        if (bytes.length < 144 || readUint(bytes, 0, 4) !== STATS_VERSION) {
+            return null;
+        }
+
+        var stats = {
+            latencyTotalMs: readUint(bytes, 4, 4),
+            ticks: readUint(bytes, 8, 4),
+            tickTotalMs: readUint(bytes, 12, 4),
+            redraws: {},
+            requests: readUint(bytes, 32, 2),
+            responses: readUint(bytes, 34, 2),
+            latencyCount: readUint(bytes, 36, 2),
+            latencyMaxMs: readUint(bytes, 38, 2),
+            messagesSent: readUint(bytes, 42, 2),
+            tickMaxMs: readUint(bytes, 44, 2),
+            recentLatenciesMs: [],
+            messagesFailed: {},
+            messagesDropped: {}
+        };
+
+        for (var i = 0; i < LAYERS.length; i++) {
+            stats.redraws[LAYERS[i]] = readUint(bytes, 16 + i * 4, 4);
+        }
+
+        // oldest latency sample first
+        var head = readUint(bytes, 40, 2);
+        for (var j = 0; j < LATENCY_SAMPLES; j++) {
+            var latency = readUint(bytes, 48 + ((head + j) % LATENCY_SAMPLES) * 2, 2);
+            if (latency > 0) {
+                stats.recentLatenciesMs.push(latency);
+            }
+        }
+
+        // AppMessageResult histograms, keyed by result value
+        for (var k = 0; k < RESULT_BUCKETS; k++) {
+            var failed = readUint(bytes, 80 + k * 2, 2);
+            var dropped = readUint(bytes, 112 + k * 2, 2);
+            if (failed > 0) {
+                stats.messagesFailed[1 << k] = failed;
+            }
+            if (dropped > 0) {
+                stats.messagesDropped[1 << k] = dropped;
+            }
+        }
+
+        return stats;
+    }
+
+    // export the encoders
+    var module = {};
+    module.encodeDepartures = encodeDepartures;
+    module.encodeDepartureUpdates = encodeDepartureUpdates;
+    module.encodeBoards = encodeBoards;
+    module.encodeJourneys = encodeJourneys;
+    module.encodeServiceDetails = encodeServiceDetails;
+    module.encodeConfig = encodeConfig;
+    module.configGeneration = configGeneration;
+    module.decodeStats = decodeStats;
+    return module;
+})();
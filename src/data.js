@@ -35,33 +35,177 @@ var afternoon_end = null;
 var use_HTTPS = null;
 var check_time = null;
 var update_only_on_tap = null;
+var learned_times = null;
+var cache_ttl = null;
+var endpoint = null;
+var debug_stats = null;              // log the watch's instrumentation counters after start-up; for development only
+var saved_routes = null;             // [{origin, destination}], shown on the watch as boards
+var interchange_station = null;      // CRS code of the station at which to change trains, or null for direct trains only
 
 // constants
-var NUMBER_OF_TRAINS = 3;
+var NUMBER_OF_TRAINS = 6;                           // trains fetched for each update; must not exceed MAX_DEPARTURE_UPDATE_RECORDS in main.c
+var MAX_TIMETABLE_TRAINS = 36;                      // size of the watch's departure table; must match MAX_DEPARTURE_RECORDS in main.c
+var TIMETABLE_DEFAULT_WINDOW = 2 * 60 * 60 * 1000;  // outside the update times, the timetable covers this period
+var DEFAULT_UPDATE_HOURS = [7, 11, 16, 20];         // must match the DEFAULT_*_HOUR constants in main.c
+var MAX_BOARDS = 3;                                 // saved routes sent as boards; must match MAX_BOARDS in main.c
+var BOARD_TRAINS = 4;                               // trains on each board; must match MAX_BOARD_RECORDS in main.c
+var BOARDS_REFRESH_INTERVAL = 15 * 60 * 1000;       // boards are refreshed this often, unlike the current route
+var MAX_JOURNEYS = 6;                               // journeys sent for a route with a change; must match MAX_JOURNEY_RECORDS in main.c
+var JOURNEY_LEG_TRAINS = 10;                        // trains fetched for each leg of a journey
+var MIN_CHANGE_TIME = 5 * 60;                       // seconds allowed to change trains at the interchange
 var LOCATION_TIMEOUT= 8000;
 var LOCATION_MAXIMUM_AGE = 0;
+var LOW_ACCURACY_MAXIMUM_AGE = 2 * 60 * 1000;         // a coarse fix may be reused by the phone for this long
+var LOCATION_CACHE_MAX_AGE = 10 * 60 * 1000;          // reuse the last fix for this long while stationary...
+var LOCATION_CACHE_MAX_AGE_MOVING = 60 * 1000;        // ...or this long while moving
+var MOVING_SPEED = 2.0;                               // metres per second; roughly walking pace
+var STATION_HYSTERESIS = 300;                         // metres by which another station must be closer before the origin changes
+var XHR_TIMEOUT = 15000;
+var DEFAULT_ENDPOINT_HOST = 'commuter-bliss-uk.apphb.com';  // used unless another departures service is configured
+var UPDATE_TIMEOUT = 60000;
+var DEPARTURES_CACHE_MAX_STALE = 2 * 60 * 60 * 1000;   // maximum age of a cached response that is served when a request fails
+var LOCATION_STAGE_TIMEOUT = 10000;                     // give up waiting for the location after this long
+var CLOCK_TIMEOUT = 5000;                               // give up waiting for the clock check after this long
+var CLOCK_CHECK_INTERVAL = 6 * 60 * 60 * 1000;          // measure the clock offset no more often than this
+var CLOCK_DRIFT_MIN_INTERVAL = 30 * 60 * 1000;          // measurements closer together than this are too noisy to estimate drift
+var STATS_REQUEST_DELAY = 60 * 1000;                   // the watch's stats are logged this long after start-up
+var MAX_CLOCK_DRIFT = 0.0001;                           // about 9 seconds per day
+
+// request failure classes, sent to the watch as KEY_LAST_REQUEST_FAILED
+var REQUEST_FAILED_TIMEOUT = 1;
+var REQUEST_FAILED_NETWORK = 2;
+var REQUEST_FAILED_HTTP = 3;
+var REQUEST_FAILED_PARSE = 4;
 
 // globals
 var current_origin = HOME_STATION;
 var current_destination = WORK_STATION;
 var stations_tree = null;
-var time_diff_ms = 0;
+var clock_offset = null;            // {offset: ms to add to the local time, drift: ms per ms, measured: ms since epoch}; also stored in localStorage as 'clock_offset'
+var watch_config_generation = 0;    // generation of the config stored on the watch, as last reported by the watch
+
+// single-flight update state: concurrent triggers share one location and departures pipeline
+var update_in_progress = false;
+var update_rerun = false;
+var update_timeout = null;
+var update_pipeline = null;         // the stages of the update in progress
+
+// departure table held by the watch, as last sent in this session, with the service id of each slot, so that later
+// updates only send the services that have changed: {origin, destination, base, windowEnd, trains}
+var watch_timetable = null;
+
+// boards held by the watch, as last sent in this session: {routes: route keys, sent: ms since epoch}
+var watch_boards = null;
+
+// location cache: the last fix {latitude, longitude, accuracy, speed, timestamp} and the station chosen from it {CRS, x, y}
+var last_fix = null;
+var last_station = null;
+
+// departures responses, keyed by route; also stored in localStorage as 'departures_cache'
+var departures_cache = null;
+
+// details of the services that have been the next train today, keyed by service id: {std, sta, stops}; also stored in
+// localStorage as 'service_details', with the day: {day, services}
+var service_details = null;
 
+// service ids whose details have been looked up in this session, so that a failed lookup is not repeated
+var service_lookups = {};
 
-var xhrRequest = function(url, type, callback, error) {
+
+var xhrRequest = function(url, type, callback, error, headers) {
     var xhr = new XMLHttpRequest();
     xhr.onload = function () {
-        callback(this.responseText);
+        if ((this.status >= 200 && this.status < 300) || this.status === 304) {
+            callback(this.responseText, this);
+        }
+        else if (error !== undefined) {
+            error(REQUEST_FAILED_HTTP, this);
+        }
     };
     if (error !== undefined) {
         xhr.onerror = function() {
-            error();
+            error(REQUEST_FAILED_NETWORK, this);
+        };
+        xhr.ontimeout = function() {
+            error(REQUEST_FAILED_TIMEOUT, this);
         };
     }
     xhr.open(type, url);
+    xhr.timeout = XHR_TIMEOUT;
+    if (headers !== undefined) {
+        for (var header in headers) {
+            xhr.setRequestHeader(header, headers[header]);
+        }
+    }
     xhr.send();
 };
 
+function getRetryAfter(reason, xhr) {
+    // use the server's hint if there is one, otherwise a delay suited to the type of failure
+    var header = null;
+    if (xhr && xhr.getResponseHeader) {
+        header = xhr.getResponseHeader('Retry-After');
+    }
+    if (header !== null && !isNaN(parseInt(header))) {
+        return Math.max(0, parseInt(header));
+    }
+    
+    if (reason === REQUEST_FAILED_HTTP) {
+        return xhr && xhr.status >= 500 ? 120 : 600;
+    }
+    else if (reason === REQUEST_FAILED_PARSE) {
+        return 300;
+    }
+    
+    return 60;
+}
+
+function sendRequestFailed(reason, xhr) {
+    var dictionary = {
+        'KEY_LAST_REQUEST_FAILED': reason,
+        'KEY_RETRY_AFTER': getRetryAfter(reason, xhr)
+    };
+    Pebble.sendAppMessage(dictionary, function (e) {}, function (e) {});
+    finishUpdate();
+}
+
+function requestUpdate(rerunIfBusy) {
+    if (update_in_progress) {
+        // merge with the update in progress, whose result answers this trigger too; a rerun is only needed if the
+        // inputs have changed, e.g. after configuration
+        if (rerunIfBusy) {
+            update_rerun = true;
+        }
+        return;
+    }
+    
+    update_in_progress = true;
+    update_timeout = setTimeout(finishUpdate, UPDATE_TIMEOUT);
+    
+    startPipeline();
+}
+
+function finishUpdate() {
+    if (!update_in_progress) {
+        return;
+    }
+    
+    clearTimeout(update_timeout);
+    update_timeout = null;
+    update_in_progress = false;
+    
+    if (update_pipeline !== null) {
+        clearTimeout(update_pipeline.locationTimeout);
+        clearTimeout(update_pipeline.clockTimeout);
+        update_pipeline = null;
+    }
+    
+    if (update_rerun) {
+        update_rerun = false;
+        requestUpdate(false);
+    }
+}
+
 function parseLocalStorage(type) {
     // additional code required to deal with strange Python-style 'True' and 'False' when using emulator
     if (typeof type == 'string' && type === 'False') {
@@ -74,23 +218,66 @@ function parseLocalStorage(type) {
     return typeof type == 'string' ? JSON.parse(type) : type;
 }
 
-function getNearestStation(lat, lon) {
-    var nearestNeighbour = stations_tree.getNearestNeighbour({x: lat, y: lon});
+// approximate distance in metres between two points; accurate enough over the distances between neighbouring stations
+function distanceMetres(lat1, lon1, lat2, lon2) {
+    var EARTH_RADIUS = 6371000;
+    var x = (lon2 - lon1) * Math.PI / 180 * Math.cos((lat1 + lat2) / 2 * Math.PI / 180);
+    var y = (lat2 - lat1) * Math.PI / 180;
+    return Math.sqrt(x * x + y * y) * EARTH_RADIUS;
+}
+
+// true if a fix cannot reliably separate the two nearest stations, so that a more accurate fix is worth waiting for
+function isAmbiguousFix(fix) {
+    if (!(fix.accuracy > 0)) {
+        return true;
+    }
+
+    var neighbours = stations_tree.getNearestNeighbours({x: fix.latitude, y: fix.longitude}, 2);
+    if (neighbours.length < 2) {
+        return false;
+    }
+
+    var nearest = distanceMetres(fix.latitude, fix.longitude, neighbours[0].x, neighbours[0].y);
+    var second = distanceMetres(fix.latitude, fix.longitude, neighbours[1].x, neighbours[1].y);
+    return second - nearest < 2 * fix.accuracy;
+}
+
+// chooses the nearest station to a fix, but keeps the previous choice unless another station is clearly closer
+function getNearestStation(fix) {
+    var nearestNeighbour = stations_tree.getNearestNeighbour({x: fix.latitude, y: fix.longitude});
     
-    if (nearestNeighbour) {
-        return nearestNeighbour.CRS;
+    if (!nearestNeighbour) {
+        return null;
     }
     
-    return null;
+    if (last_station !== null && last_station.CRS !== nearestNeighbour.CRS) {
+        var lastDistance = distanceMetres(fix.latitude, fix.longitude, last_station.x, last_station.y);
+        var nearestDistance = distanceMetres(fix.latitude, fix.longitude, nearestNeighbour.x, nearestNeighbour.y);
+        if (lastDistance - nearestDistance < STATION_HYSTERESIS) {
+            return last_station.CRS;
+        }
+    }
+    
+    last_station = nearestNeighbour;
+    return nearestNeighbour.CRS;
+}
+
+// the time-based origin and destination, used when the location is unknown
+function getFallbackRoute() {
+    if ((new Date()).getHours() >= 12 || (new Date()).getHours() < 3) {
+        return {origin: WORK_STATION, destination: HOME_STATION};
+    }
+    
+    return {origin: HOME_STATION, destination: WORK_STATION};
 }
 
-function locationSuccess(pos) {
-    current_origin = getNearestStation(pos.coords.latitude, pos.coords.longitude);
-//     console.log('current_origin: ' + current_origin);
+function locationSuccess(pipeline, fix) {
+    var origin = getNearestStation(fix);
+//     console.log('current_origin: ' + origin);
     
     // fall back to time-based origin and destination
-    if (current_origin === null) {
-        locationError(null);
+    if (origin === null) {
+        locationError(pipeline, null);
         return;
     }
 
@@ -101,205 +288,1050 @@ function locationSuccess(pos) {
 //         current_destination = HOME_STATION;
 //     }
     
-    if ((new Date()).getHours() >= 12 || (new Date()).getHours() < 3) {
-        current_destination = HOME_STATION;
-    } else {
-        current_destination = WORK_STATION;
+    setRoute(pipeline, origin, getFallbackRoute().destination);
+}
+
+function locationError(pipeline, err) {
+    var route = getFallbackRoute();
+    setRoute(pipeline, route.origin, route.destination);
+}
+
+// stores a position as the last fix, estimating speed from the previous fix if the phone does not report it
+function recordFix(pos) {
+    var fix = {
+        latitude: pos.coords.latitude,
+        longitude: pos.coords.longitude,
+        accuracy: pos.coords.accuracy,
+        speed: pos.coords.speed,
+        timestamp: pos.timestamp || Date.now()
+    };
+    
+    if (!(fix.speed >= 0)) {
+        fix.speed = 0;
+        if (last_fix !== null && fix.timestamp > last_fix.timestamp) {
+            fix.speed = distanceMetres(last_fix.latitude, last_fix.longitude, fix.latitude, fix.longitude) / ((fix.timestamp - last_fix.timestamp) / 1000);
+        }
     }
     
-    // the closest station is the destination; reset train data
-    if (current_origin === current_destination) {
-        var dictionary = {
-            'KEY_UPDATE': 0,
-            'KEY_CURRENT_ORIGIN': current_origin,
-            'KEY_CURRENT_DESTINATION': current_destination,
-            'KEY_TRAIN1_TIME': 0,
-            'KEY_TRAIN1_DEST': '',
-            'KEY_TRAIN1_PLATFORM': 0,
-            'KEY_TRAIN2_TIME': 0,
-            'KEY_TRAIN3_TIME': 0,
-            'KEY_TRAIN1_IS_CANCELED': 0,
-            'KEY_TRAIN2_IS_CANCELED': 0,
-            'KEY_TRAIN3_IS_CANCELED': 0,
-            'KEY_LAST_REQUEST_FAILED': 0
-        };
-        Pebble.sendAppMessage(dictionary, function (e) {}, function (e) {});
+    last_fix = fix;
+    return fix;
+}
+
+// the last fix, if it is recent enough to reuse, for less time if the user was moving; otherwise null
+function getCachedFix() {
+    if (last_fix !== null) {
+        var maxAge = last_fix.speed >= MOVING_SPEED ? LOCATION_CACHE_MAX_AGE_MOVING : LOCATION_CACHE_MAX_AGE;
+        if (Date.now() - last_fix.timestamp < maxAge) {
+            return last_fix;
+        }
+    }
+    
+    return null;
+}
+
+function getLocation(pipeline) {
+    var cachedFix = getCachedFix();
+    if (cachedFix !== null) {
+        locationSuccess(pipeline, cachedFix);
         return;
     }
+    
+    // try a quick, coarse fix first, and only wait for GPS if the coarse fix could be at more than one station
+    navigator.geolocation.getCurrentPosition(
+        function (pos) {
+            var coarseFix = recordFix(pos);
+            if (!isAmbiguousFix(coarseFix)) {
+                locationSuccess(pipeline, coarseFix);
+                return;
+            }
+            
+            // used if the location stage times out while waiting for GPS
+            pipeline.coarseFix = coarseFix;
+            
+            navigator.geolocation.getCurrentPosition(
+                function (pos) {
+                    locationSuccess(pipeline, recordFix(pos));
+                },
+                function (err) {
+                    locationSuccess(pipeline, coarseFix);
+                }, {
+                    enableHighAccuracy: true,
+                    timeout: LOCATION_TIMEOUT,
+                    maximumAge: LOCATION_MAXIMUM_AGE
+                }
+            );
+        },
+        function (err) {
+            locationError(pipeline, err);
+        }, {
+            enableHighAccuracy: false,
+            timeout: LOCATION_TIMEOUT,
+            maximumAge: LOW_ACCURACY_MAXIMUM_AGE
+        }
+    );
+}
 
-    getTrains();
+function getCachedDepartures(key) {
+    if (departures_cache === null) {
+        try {
+            departures_cache = JSON.parse(localStorage.getItem('departures_cache')) || {};
+        }
+        catch (err) {
+            departures_cache = {};
+        }
+    }
+    
+    return departures_cache.hasOwnProperty(key) ? departures_cache[key] : null;
 }
 
-function locationError(err) {
-    if ((new Date()).getHours() >= 12 || (new Date()).getHours() < 3) {
-        current_origin = WORK_STATION;
-        current_destination = HOME_STATION;
-    } else {
-        current_origin = HOME_STATION;
-        current_destination = WORK_STATION;
+function storeCachedDepartures(key, entry) {
+    getCachedDepartures(key);
+    departures_cache[key] = entry;
+    
+    // discard entries which are too old to be served
+    var now = Date.now();
+    for (var k in departures_cache) {
+        if (departures_cache.hasOwnProperty(k) && now - departures_cache[k].fetched > DEPARTURES_CACHE_MAX_STALE) {
+            delete departures_cache[k];
+        }
     }
+    
+    localStorage.setItem('departures_cache', JSON.stringify(departures_cache));
+}
 
-    getTrains();
+function fetchDepartures(URL, key, rows, callback, error) {
+    // callback(json, failure): failure is null for a fresh or revalidated response; otherwise the last good
+    // response is being served after a failed request, and failure is {reason, xhr}
+    //   responses are cached by route, so a board with at least the requested number of rows answers a request for
+    //   fewer, e.g. a full timetable answers the update that follows it
+    var cached = getCachedDepartures(key);
+    var now = Date.now();
+    
+    if (cached !== null && (cached.rows || 0) >= rows && now - cached.fetched < cache_ttl * 1000) {
+        callback(JSON.parse(cached.body), null);
+        return;
+    }
+    
+    var failed = function (reason, xhr) {
+        if (cached !== null && now - cached.fetched < DEPARTURES_CACHE_MAX_STALE) {
+            callback(JSON.parse(cached.body), {reason: reason, xhr: xhr});
+        }
+        else {
+            error(reason, xhr);
+        }
+    };
+    
+    // revalidate the cached response, if the server provided validators for the same number of rows
+    var headers = {};
+    if (cached !== null && cached.rows === rows && cached.etag) {
+        headers['If-None-Match'] = cached.etag;
+    }
+    if (cached !== null && cached.rows === rows && cached.lastModified) {
+        headers['If-Modified-Since'] = cached.lastModified;
+    }
+    
+    xhrRequest(URL, 'GET', function (responseText, xhr) {
+        if (xhr.status === 304 && cached !== null) {
+            cached.fetched = now;
+            storeCachedDepartures(key, cached);
+            callback(JSON.parse(cached.body), null);
+            return;
+        }
+        
+        var json = null;
+        try {
+            json = JSON.parse(responseText);
+        }
+        catch (err) {
+            console.log('XHR failed: invalid response');
+            failed(REQUEST_FAILED_PARSE, null);
+            return;
+        }
+        
+        storeCachedDepartures(key, {
+            body: responseText,
+            rows: rows,
+            etag: xhr.getResponseHeader('ETag'),
+            lastModified: xhr.getResponseHeader('Last-Modified'),
+            fetched: now
+        });
+        callback(json, null);
+    }, failed, headers);
 }
 
-function getLocation() {
-    navigator.geolocation.getCurrentPosition(
-        locationSuccess, locationError, {
-            enableHighAccuracy: true,
-            timeout: LOCATION_TIMEOUT,
-            maximumAge: LOCATION_MAXIMUM_AGE
+function getCachedServiceDetails(id) {
+    var day = new Date().toDateString();
+    if (service_details === null) {
+        try {
+            service_details = JSON.parse(localStorage.getItem('service_details'));
         }
-    );
+        catch (err) {
+            service_details = null;
+        }
+    }
+    
+    // service ids are only unique within a day
+    if (service_details === null || service_details.day !== day) {
+        service_details = {day: day, services: {}};
+    }
+    
+    return service_details.services.hasOwnProperty(id) ? service_details.services[id] : null;
+}
+
+function storeCachedServiceDetails(id, details) {
+    getCachedServiceDetails(id);
+    service_details.services[id] = details;
+    localStorage.setItem('service_details', JSON.stringify(service_details));
+}
+
+// looks up the calling points of a service, once per session, and sends its details to the watch once they are known
+//   trains is the departure table that was sent with the service as its next train; the watch ignores the details if
+//   its next train has changed since
+function lookupServiceDetails(id, destination, trains) {
+    if (service_lookups.hasOwnProperty(id)) {
+        return;
+    }
+    service_lookups[id] = true;
+    
+    xhrRequest(getEndpoint() + '/service/' + encodeURIComponent(id), 'GET', function (responseText) {
+        var details = null;
+        try {
+            details = parseServiceDetails(JSON.parse(responseText), destination);
+        }
+        catch (err) {
+            console.log('XHR failed: invalid service details');
+        }
+        if (details === null) {
+            return;
+        }
+        storeCachedServiceDetails(id, details);
+        
+        // an update in progress sends the details with the departures
+        if (!update_in_progress) {
+            var bytes = getNextServiceDetails(destination, trains);
+            if (bytes !== null) {
+                Pebble.sendAppMessage({'KEY_NEXT_SERVICE_DETAILS': bytes}, function (e) {}, function (e) {});
+            }
+        }
+    }, function (reason, xhr) {
+        console.log('XHR failed: service details ' + reason);
+    });
 }
 
-function getTrains() {
+// the scheduled times and the number of stops of a service, from Huxley's service details, or null if the service
+// does not call at the destination
+function parseServiceDetails(json, destination) {
+    var points = json.subsequentCallingPoints && json.subsequentCallingPoints[0] ?
+        json.subsequentCallingPoints[0].callingPoint : null;
+    for (var i = 0; points && i < points.length; i++) {
+        if (points[i].crs === destination) {
+            return {std: json.std, sta: points[i].st, stops: i};
+        }
+    }
+    
+    return null;
+}
+
+// the slot of the next train in a departure table, which is not necessarily the first slot after updates, or -1
+function getNextTrain(trains) {
+    var now = Math.floor(Date.now() / 60000) * 60;
+    var next = -1;
+    for (var i = 0; i < trains.time.length; i++) {
+        if ((trains.time[i] >= now || trains.delayed[i]) && (next < 0 || trains.time[i] < trains.time[next])) {
+            next = i;
+        }
+    }
+    
+    return next;
+}
+
+// the details of the next train of a departure table, encoded for the watch, or null if they are not known yet
+//   the details are looked up the first time that a service is the next train; after that, the expected arrival only
+//   follows the train's expected departure from the board, e.g. arriving 5 minutes late if it leaves 5 minutes late
+function getNextServiceDetails(destination, trains) {
+    var i = getNextTrain(trains);
+    
+    // ids made up from the departure time, when the board has no service id, cannot be looked up; a train delayed
+    // without an estimate has no expected arrival
+    if (i < 0 || trains.cancelled[i] || trains.delayed[i] || trains.id[i].indexOf(':') > -1) {
+        return null;
+    }
+    
+    var details = getCachedServiceDetails(trains.id[i]);
+    if (details === null) {
+        lookupServiceDetails(trains.id[i], destination, trains);
+        return null;
+    }
+    
     var now = new Date();
     now.setSeconds(0, 0);
+    var std = parseBoardTime(now, details.std);
+    var sta = parseBoardTime(now, details.sta);
+    if (std === null || sta === null) {
+        return null;
+    }
+    
+    var arrival = trains.time[i] + (sta.getTime() - std.getTime()) / 1000;
+    return codec.encodeServiceDetails(trains.time[i], trains.dest[i], Math.max(arrival, trains.time[i]), details.stops);
+}
 
+// base URL of the departures service: Huxley, or a proxy with the same API such as tools/proxy/departures_proxy.js
+function getEndpoint() {
+    if (endpoint !== null) {
+        return endpoint;
+    }
+    
     var protocol = 'http';
     if (use_HTTPS === true) {
         protocol = 'https';
     }
-    var URL = protocol + '://commuter-bliss-uk.apphb.com/departures/' + current_origin + '/to/' + current_destination + '/' + NUMBER_OF_TRAINS;
-
-    xhrRequest(URL, 'GET', function (responseText) {
-        var json = JSON.parse(responseText);
-
-        // assemble dictionary from keys
-        var dictionary = {
-            'KEY_UPDATE': 0,
-            'KEY_CURRENT_ORIGIN': current_origin,
-            'KEY_CURRENT_DESTINATION': current_destination,
-            'KEY_TRAIN1_TIME': 0,
-            'KEY_TRAIN1_DEST': '',
-            'KEY_TRAIN1_PLATFORM': 0,
-            'KEY_TRAIN2_TIME': 0,
-            'KEY_TRAIN3_TIME': 0,
-            'KEY_TRAIN1_IS_CANCELED': 0,
-            'CUSTOMISED_DAYS': customisedDays,
-            'USE_MONDAY': use_monday,
-            'USE_TUESDAY': use_tuesday,
-            'USE_WEDNESDAY': use_wednesday,
-            'USE_THURSDAY': use_thursday,
-            'USE_FRIDAY': use_friday,
-            'USE_SATURDAY': use_saturday,
-            'USE_SUNDAY': use_sunday,
-            'CUSTOMISED_TIMES': customisedTimes,
-            'MORNING_START': parseInt(morning_start),
-            'MORNING_END': parseInt(morning_end),
-            'AFTERNOON_START': parseInt(afternoon_start),
-            'AFTERNOON_END': parseInt(afternoon_end),
-            'KEY_TRAIN2_IS_CANCELED': 0,
-            'KEY_TRAIN3_IS_CANCELED': 0,
-            'TIME_DIFF_FROM_UTC': time_diff_ms,
-            'KEY_LAST_REQUEST_FAILED': 0,
-            'KEY_UPDATE_ONLY_ON_TAP': update_only_on_tap
+    return protocol + '://' + DEFAULT_ENDPOINT_HOST;
+}
+
+// returns the endpoint in canonical form, without a trailing slash, or null if it is not an HTTP(S) URL
+function parseEndpoint(value) {
+    if (typeof value !== 'string' || !/^https?:\/\/[^\s\/?#]+(\/[^\s?#]*)?$/.test(value)) {
+        return null;
+    }
+    
+    return value.replace(/\/+$/, '');
+}
+
+function getRouteKey(origin, destination) {
+    return origin + '/' + destination;
+}
+
+// end of the update period that contains the given time, or TIMETABLE_DEFAULT_WINDOW later outside the update periods
+function getCommuteWindowEnd(now) {
+    var hours = DEFAULT_UPDATE_HOURS;
+    if (customisedTimes) {
+        hours = [parseInt(morning_start), parseInt(morning_end), parseInt(afternoon_start), parseInt(afternoon_end)];
+    }
+    
+    var hour = now.getHours();
+    var end = new Date(now.getTime());
+    end.setMinutes(0, 0, 0);
+    
+    if (hour >= hours[0] && hour < hours[1]) {
+        end.setHours(hours[1]);
+        return end.getTime();
+    }
+    
+    // the afternoon period can end after midnight
+    if (hours[3] < hours[2] && hour >= hours[2]) {
+        end.setDate(end.getDate() + 1);
+        end.setHours(hours[3]);
+        return end.getTime();
+    }
+    if ((hours[3] < hours[2] && hour < hours[3]) || (hour >= hours[2] && hour < hours[3])) {
+        end.setHours(hours[3]);
+        return end.getTime();
+    }
+    
+    return now.getTime() + TIMETABLE_DEFAULT_WINDOW;
+}
+
+// returns the routes in a config value such as 'SUR-WAT, WAT-SUR', or null if it is not valid
+function parseRoutes(value) {
+    if (typeof value !== 'string') {
+        return null;
+    }
+    
+    var routes = [];
+    var items = value.toUpperCase().split(/[\s,;]+/);
+    for (var i = 0; i < items.length; i++) {
+        if (items[i] === '') {
+            continue;
+        }
+        
+        var match = /^([A-Z]{3})-([A-Z]{3})$/.exec(items[i]);
+        if (match === null) {
+            return null;
+        }
+        routes.push({origin: match[1], destination: match[2]});
+    }
+    
+    return routes;
+}
+
+// the saved routes that are shown as boards besides the current route; in tap-only mode, only the current route is shown
+function getBoardRoutes(route) {
+    var routes = [];
+    
+    for (var i = 0; i < saved_routes.length && routes.length < MAX_BOARDS && !update_only_on_tap; i++) {
+        var saved = saved_routes[i];
+        if (saved.origin !== saved.destination && getRouteKey(saved.origin, saved.destination) !== getRouteKey(route.origin, route.destination)) {
+            routes.push(saved);
+        }
+    }
+    
+    return routes;
+}
+
+function getRouteKeys(routes) {
+    var keys = [];
+    for (var i = 0; i < routes.length; i++) {
+        keys.push(getRouteKey(routes[i].origin, routes[i].destination));
+    }
+    return keys.join(',');
+}
+
+function areBoardsDue(routes) {
+    return watch_boards === null || watch_boards.routes !== getRouteKeys(routes) ||
+        Date.now() - watch_boards.sent >= BOARDS_REFRESH_INTERVAL;
+}
+
+function hasWatchTimetable(origin, destination) {
+    // in tap-only mode, the watch clears its table once the trains have been shown, so each tap needs a complete table
+    return !update_only_on_tap && watch_timetable !== null && watch_timetable.origin === origin && watch_timetable.destination === destination &&
+        Date.now() < watch_timetable.windowEnd;
+}
+
+// a route is a journey with a change if an interchange is configured that is not one of its ends
+function isJourney(route) {
+    return interchange_station !== null && route.origin !== interchange_station && route.destination !== interchange_station;
+}
+
+// fetches the departures for an entry of an update, and completes the update when they have been fetched
+function fetchEntry(pipeline, entry, URL, key, rows) {
+    fetchDepartures(URL, key, rows, function (json, failure) {
+        entry.done = true;
+        entry.json = json;
+        entry.failure = failure;
+        completePipeline(pipeline);
+    }, function(reason, xhr) {
+        console.log('XHR failed: ' + reason);
+        
+        entry.done = true;
+        entry.error = {reason: reason, xhr: xhr};
+        completePipeline(pipeline);
+    });
+}
+
+// starts fetching a leg of a journey, with the calling points of each train, so that its arrival time is known
+function fetchLeg(pipeline, origin, destination) {
+    var key = getLegKey(origin, destination);
+    if (key in pipeline.departures) {
+        return;
+    }
+    
+    var entry = {done: false, json: null, failure: null, error: null};
+    pipeline.departures[key] = entry;
+    fetchEntry(pipeline, entry, getEndpoint() + '/departures/' + origin + '/to/' + destination + '/' + JOURNEY_LEG_TRAINS + '?expand=true',
+               key, JOURNEY_LEG_TRAINS);
+}
+
+function getLegKey(origin, destination) {
+    return getRouteKey(origin, destination) + '/expand';
+}
+
+// starts fetching a route for an update: both legs at once for a journey with a change, otherwise the direct trains
+function fetchRouteOrLegs(pipeline, route) {
+    if (isJourney(route)) {
+        fetchLeg(pipeline, route.origin, interchange_station);
+        fetchLeg(pipeline, interchange_station, route.destination);
+    }
+    else {
+        fetchRoute(pipeline, route.origin, route.destination);
+    }
+}
+
+// starts fetching the departures for a route, unless this update has already started fetching them
+//   if the watch already has this session's timetable for the route, only the next few trains are fetched, to update
+//   it; otherwise the departures for the rest of the commute window are fetched, unless the number of rows is given
+function fetchRoute(pipeline, origin, destination, rows) {
+    var key = getRouteKey(origin, destination);
+    if (key in pipeline.departures) {
+        return;
+    }
+
+    var full = !hasWatchTimetable(origin, destination);
+    if (rows === undefined) {
+        rows = full ? MAX_TIMETABLE_TRAINS : NUMBER_OF_TRAINS;
+    }
+    var URL = getEndpoint() + '/departures/' + origin + '/to/' + destination + '/' + rows;
+
+    var entry = {done: false, json: null, failure: null, error: null, full: full, windowEnd: getCommuteWindowEnd(new Date())};
+    pipeline.departures[key] = entry;
+    fetchEntry(pipeline, entry, URL, key, rows);
+}
+
+// starts an update: the location, the departures and the clock check run concurrently, and the result is sent to the
+// watch once the departures for the resolved route and the clock offset are known
+function startPipeline() {
+    var pipeline = {
+        route: null,
+        legs: null,
+        boards: null,
+        departures: {},
+        clockReady: true,
+        sent: false,
+        coarseFix: null,
+        locationTimeout: null,
+        clockTimeout: null
+    };
+    update_pipeline = pipeline;
+    
+    if (check_time && isClockCheckDue(Date.now())) {
+        pipeline.clockReady = false;
+        var clockDone = function () {
+            clearTimeout(pipeline.clockTimeout);
+            pipeline.clockReady = true;
+            completePipeline(pipeline);
         };
+        
+        // if the clock check is slow, carry on with the last known offset
+        pipeline.clockTimeout = setTimeout(clockDone, CLOCK_TIMEOUT);
+        checkClock(clockDone);
+    }
+    
+    if (useLocation === true) {
+        // while waiting for a new fix, speculatively fetch the time-based route, which is usually the one that the
+        // location resolves to; a recent fix resolves the route straight away, so nothing is fetched speculatively
+        if (getCachedFix() === null) {
+            fetchRouteOrLegs(pipeline, getFallbackRoute());
+        }
+        
+        pipeline.locationTimeout = setTimeout(function () {
+            if (pipeline.coarseFix !== null) {
+                locationSuccess(pipeline, pipeline.coarseFix);
+            }
+            else {
+                locationError(pipeline, null);
+            }
+        }, LOCATION_STAGE_TIMEOUT);
+        getLocation(pipeline);
+    }
+    else {
+        locationError(pipeline, null);
+    }
+}
+
+function setRoute(pipeline, origin, destination) {
+    // only the first route resolved for an update is used, e.g. a fix that arrives after the location stage has
+    // timed out is ignored
+    if (pipeline !== update_pipeline || pipeline.route !== null) {
+        return;
+    }
+    
+    clearTimeout(pipeline.locationTimeout);
+    current_origin = origin;
+    current_destination = destination;
+    pipeline.route = {origin: origin, destination: destination};
+    
+    // the closest station is the destination; reset train data
+    if (origin === destination) {
+        pipeline.sent = true;
+        sendTimetable(pipeline.route, createDepartureTable(), getCommuteWindowEnd(new Date()), null, null);
+        return;
+    }
+    
+    // the config may change while the update is in progress, so the legs are fixed here
+    if (isJourney(pipeline.route)) {
+        pipeline.legs = [getLegKey(origin, interchange_station), getLegKey(interchange_station, destination)];
+    }
+    fetchRouteOrLegs(pipeline, pipeline.route);
+    
+    // the boards are fetched alongside the current route, and sent in the same message; a route that has already been
+    // fetched for this update, e.g. the speculative time-based route, is reused
+    var boardRoutes = getBoardRoutes(pipeline.route);
+    if (areBoardsDue(boardRoutes)) {
+        pipeline.boards = boardRoutes;
+        for (var i = 0; i < boardRoutes.length; i++) {
+            fetchRoute(pipeline, boardRoutes[i].origin, boardRoutes[i].destination, BOARD_TRAINS);
+        }
+    }
+    
+    completePipeline(pipeline);
+}
+
+// sends the result of an update to the watch, once all of the stages that it depends on have finished
+function completePipeline(pipeline) {
+    if (pipeline !== update_pipeline || pipeline.sent || pipeline.route === null || !pipeline.clockReady) {
+        return;
+    }
+    
+    var keys = pipeline.legs || [getRouteKey(pipeline.route.origin, pipeline.route.destination)];
+    for (var i = 0; pipeline.boards !== null && i < pipeline.boards.length; i++) {
+        keys = keys.concat(getRouteKey(pipeline.boards[i].origin, pipeline.boards[i].destination));
+    }
+    // a cached board completes as soon as it is fetched, possibly before the other fetches have started
+    for (var j = 0; j < keys.length; j++) {
+        if (!(keys[j] in pipeline.departures) || !pipeline.departures[keys[j]].done) {
+            return;
+        }
+    }
+    
+    pipeline.sent = true;
+    if (pipeline.legs !== null) {
+        completeJourneys(pipeline, pipeline.departures[pipeline.legs[0]], pipeline.departures[pipeline.legs[1]]);
+        return;
+    }
+    
+    var entry = pipeline.departures[keys[0]];
+    if (entry.error !== null) {
+        sendRequestFailed(entry.error.reason, entry.error.xhr);
+    }
+    else if (entry.full || !hasWatchTimetable(pipeline.route.origin, pipeline.route.destination)) {
+        // the watch's table may also have been lost while the departures were being fetched
+        sendTimetable(pipeline.route, parseTrains(entry.json, MAX_TIMETABLE_TRAINS, entry.windowEnd), entry.windowEnd, entry.failure,
+                      getBoards(pipeline));
+    }
+    else {
+        sendDepartureUpdates(parseTrains(entry.json, NUMBER_OF_TRAINS, Infinity), entry.failure, getBoards(pipeline));
+    }
+}
+
+// the boards fetched for an update, or null if they are not due: {routes: route keys, boards: [{origin, destination, trains}]}
+//   a route that could not be fetched is left out, so that it is fetched again by the next update
+function getBoards(pipeline) {
+    if (pipeline.boards === null) {
+        return null;
+    }
+    
+    var boards = [];
+    for (var i = 0; i < pipeline.boards.length; i++) {
+        var route = pipeline.boards[i];
+        var entry = pipeline.departures[getRouteKey(route.origin, route.destination)];
+        if (entry.error === null) {
+            boards.push({origin: route.origin, destination: route.destination, trains: parseTrains(entry.json, BOARD_TRAINS, Infinity)});
+        }
+    }
+    
+    return {routes: getRouteKeys(boards), boards: boards};
+}
+
+// departure table: services as parallel arrays, with the Huxley service id of each; see codec.encodeDepartures()
+//   a train delayed without an estimate keeps its scheduled time, and stays in the table after it until it leaves the
+//   board
+function createDepartureTable() {
+    return {id: [], time: [], dest: [], platform: [], cancelled: [], delayed: []};
+}
+
+function copyDepartureTable(trains) {
+    return {
+        id: trains.id.slice(),
+        time: trains.time.slice(),
+        dest: trains.dest.slice(),
+        platform: trains.platform.slice(),
+        cancelled: trains.cancelled.slice(),
+        delayed: trains.delayed.slice()
+    };
+}
+
+// updates a departure table from the latest departures, matching trains by service id; returns the changed slots
+function mergeDepartures(trains, latest) {
+    var slots = [];
+    
+    for (var i = 0; i < latest.id.length; i++) {
+        var slot = trains.id.indexOf(latest.id[i]);
+        if (slot < 0) {
+            slot = trains.id.length;
+            trains.id.push(latest.id[i]);
+        }
+        else if (trains.time[slot] === latest.time[i] && trains.dest[slot] === latest.dest[i] &&
+                trains.platform[slot] === latest.platform[i] && trains.cancelled[slot] === latest.cancelled[i] &&
+                trains.delayed[slot] === latest.delayed[i]) {
+            continue;
+        }
+        
+        trains.time[slot] = latest.time[i];
+        trains.dest[slot] = latest.dest[i];
+        trains.platform[slot] = latest.platform[i];
+        trains.cancelled[slot] = latest.cancelled[i];
+        trains.delayed[slot] = latest.delayed[i];
+        slots.push(slot);
+    }
+    
+    // a delayed train that is no longer on the board has left; without the flag, the watch drops it as departed
+    //   delayed trains have the earliest scheduled times, so they are among the first rows of any board that lists them
+    for (var j = 0; j < trains.id.length; j++) {
+        if (trains.delayed[j] && latest.id.indexOf(trains.id[j]) < 0) {
+            trains.delayed[j] = false;
+            slots.push(j);
+        }
+    }
+    
+    return slots;
+}
+
+// removes departed trains from a departure table, so that it fits in the watch's table again
+function compactDepartureTable(trains) {
+    var now = Date.now() / 1000;
+    now -= now % 60;
+    
+    var compacted = createDepartureTable();
+    for (var i = 0; i < trains.id.length && compacted.id.length < MAX_TIMETABLE_TRAINS; i++) {
+        if (trains.time[i] >= now || trains.delayed[i]) {
+            compacted.id.push(trains.id[i]);
+            compacted.time.push(trains.time[i]);
+            compacted.dest.push(trains.dest[i]);
+            compacted.platform.push(trains.platform[i]);
+            compacted.cancelled.push(trains.cancelled[i]);
+            compacted.delayed.push(trains.delayed[i]);
+        }
+    }
+    
+    return compacted;
+}
+
+// the time of an 'HH:MM' departure board time, on the day of now, or null if the text is not a time
+function parseBoardTime(now, text) {
+    if (typeof text !== 'string' || !/^\d{1,2}:\d{2}$/.test(text)) {
+        return null;
+    }
+    
+    var parts = text.split(':');
+    var time = new Date(now.getTime());
+    time.setHours(parts[0]);
+    time.setMinutes(parts[1]);
+    time.setSeconds(0);
+    
+    // cater for times in early hours of following day
+    if (time.getHours() >= 0 && time.getHours() <= 3) {
+        time.setDate(time.getDate() + 1);
+    }
+    
+    return time;
+}
+
+function parseTrains(json, maxTrains, windowEnd) {
+    var now = new Date();
+    now.setSeconds(0, 0);
 
-        if (json.trainServices) {
-            var trains = [];
-            var trainsLen = json.trainServices.length;
-
-            for (var i = 0; i < trainsLen; i++) {
-                trains.push(json.trainServices[i].std);
-
-                var trainTime = new Date(now.getTime());
-                var trainTimeTextArray = '';
-                var cancelled = false;
-                
-                // check for known delays in 'etd' field
-//                 console.log('etd: ' + json.trainServices[i].etd + ', std: ' + json.trainServices[i].std);
-                if (json.trainServices[i].etd !== null) {
-                    if (json.trainServices[i].etd.indexOf(':') > -1) {
-                        trainTimeTextArray = json.trainServices[i].etd.split(':');
-                    }
-                    else if (json.trainServices[i].etd == 'Cancelled') {
-                        cancelled = true;
-                        trainTimeTextArray = json.trainServices[i].std.split(':');
-                    }
-                    else if (json.trainServices[i].etd == 'Delayed') {
-                        trainTimeTextArray = json.trainServices[i].std.split(':');
-                    }
-                    else if (json.trainServices[i].etd == 'On time') {
-                        trainTimeTextArray = json.trainServices[i].std.split(':');
-                    }
-                    else {
-                        trainTimeTextArray = json.trainServices[i].std.split(':');
-                    }
+    var trains = createDepartureTable();
+
+    if (json.trainServices) {
+        for (var i = 0; i < json.trainServices.length && trains.time.length < maxTrains; i++) {
+            var service = json.trainServices[i];
+            var trainTimeText = service.std;
+            var cancelled = false;
+            var delayed = false;
+            
+            // check for known delays in 'etd' field
+//             console.log('etd: ' + service.etd + ', std: ' + service.std);
+            if (service.isCancelled === true) {
+                cancelled = true;
+            }
+            else if (service.etd !== null) {
+                if (service.etd.indexOf(':') > -1) {
+                    trainTimeText = service.etd;
                 }
-                else {
-                    trainTimeTextArray = json.trainServices[i].std.split(':');
+                else if (service.etd == 'Cancelled') {
+                    cancelled = true;
                 }
-                trainTime.setHours(trainTimeTextArray[0]);
-                trainTime.setMinutes(trainTimeTextArray[1]);
-                trainTime.setSeconds(0);
-
-//                 // cater for departures in early hours of following day
-                if (trainTime.getHours() >= 0 && trainTime.getHours() <= 3) {
-                    trainTime.setDate(trainTime.getDate() + 1);
+                else if (service.etd == 'Delayed') {
+                    delayed = true;
                 }
+                // otherwise 'On time' or unknown
+            }
+            var trainTime = parseBoardTime(now, trainTimeText);
+            
+            // skip trains that have already departed, e.g. in a cached response, or that are after the commute window;
+            // a train delayed without an estimate has not departed while it is on the board, however late it is
+            if (trainTime === null || (trainTime < now && !delayed) || trainTime >= windowEnd) {
+                continue;
+            }
 
-                if (i === 0) {
-                    if (cancelled) {
-                        dictionary.KEY_TRAIN1_IS_CANCELED = 1;
-                    }
-                    dictionary.KEY_TRAIN1_TIME = trainTime.getTime() / 1000;
-                    dictionary.KEY_TRAIN1_DEST = json.trainServices[i].destination[0].crs;
-
-                    var platform = -1;
-                    if (json.trainServices[i].platform) {
-                        platform = parseInt(json.trainServices[i].platform);
-                    }
-                    dictionary.KEY_TRAIN1_PLATFORM = platform;
-                } else if (i === 1) {
-                    if (cancelled) {
-                        dictionary.KEY_TRAIN2_IS_CANCELED = 1;
-                    }
-                    dictionary.KEY_TRAIN2_TIME = trainTime.getTime() / 1000;
-                    dictionary.KEY_TRAIN2_DEST = json.trainServices[i].destination[0].crs;
-                } else if (i === 2) {
-                    if (cancelled) {
-                        dictionary.KEY_TRAIN3_IS_CANCELED = 1;
-                    }
-                    dictionary.KEY_TRAIN3_TIME = trainTime.getTime() / 1000;
-                    dictionary.KEY_TRAIN3_DEST = json.trainServices[i].destination[0].crs;
-                }
+            var platform = 0;
+            if (service.platform) {
+                platform = parseInt(service.platform);
             }
+
+            trains.id.push(service.serviceID || (service.std + service.destination[0].crs));
+            trains.time.push(trainTime.getTime() / 1000);
+            trains.dest.push(service.destination[0].crs);
+            trains.platform.push(platform);
+            trains.cancelled.push(cancelled);
+            trains.delayed.push(delayed);
+        }
+    }
+//     else {
+//         console.log('no trains');
+//     }
+
+    return trains;
+}
+
+// the trains on a leg of a journey that have not departed, with their arrival at the end of the leg:
+// [{time, arrival: seconds since epoch, dest, platform}]; cancelled trains, and trains with an unknown arrival time,
+// e.g. one reported as 'Delayed', cannot be part of a journey
+function parseLeg(json, destination) {
+    var now = new Date();
+    now.setSeconds(0, 0);
+    
+    var trains = [];
+    for (var i = 0; json.trainServices && i < json.trainServices.length; i++) {
+        var service = json.trainServices[i];
+        if (service.isCancelled === true || service.etd === 'Cancelled' || !service.subsequentCallingPoints) {
+            continue;
         }
-//         else {
-//             console.log('no trains');
-//         }
         
-        if (check_time) {
-            xhrRequest('http://www.timeapi.org/utc/now', 'GET', function (responseText) {
-                var local_date = new Date();
-                var remote_date = new Date(responseText);
-                time_diff_ms = remote_date - local_date;    // this is the amount to add to the local time to correct it
-                
-                dictionary.TIME_DIFF_FROM_UTC = time_diff_ms;
-                
-                // send to Pebble
-                Pebble.sendAppMessage(dictionary, function (e) {}, function (e) {});
-            });
+        var point = null;
+        var points = service.subsequentCallingPoints[0] ? service.subsequentCallingPoints[0].callingPoint : [];
+        for (var j = 0; points && j < points.length && point === null; j++) {
+            if (points[j].crs === destination) {
+                point = points[j];
+            }
+        }
+        if (point === null || point.isCancelled === true) {
+            continue;
         }
-        else {
-            // send to Pebble
-            Pebble.sendAppMessage(dictionary, function (e) {
-    //             console.log('Data sent to Pebble successfully!');
-            }, function (e) {
-    //             console.log('Error sending data to Pebble!');
-            });
-        }
-    }, function() {
-        console.log('XHR failed');
         
-        var dictionary = {
-            'KEY_LAST_REQUEST_FAILED': 1
-        };
-        Pebble.sendAppMessage(dictionary, function (e) {}, function (e) {});
+        var time = parseBoardTime(now, service.etd) || parseBoardTime(now, service.std);
+        var arrival = parseBoardTime(now, point.et);
+        if (arrival === null && (point.et === 'On time' || !point.et)) {
+            arrival = parseBoardTime(now, point.st);
+        }
+        if (time === null || arrival === null || time < now) {
+            continue;
+        }
+        
+        trains.push({
+            time: time.getTime() / 1000,
+            arrival: arrival.getTime() / 1000,
+            dest: service.destination[0].crs,
+            platform: service.platform ? parseInt(service.platform) : 0
+        });
+    }
+    
+    return trains;
+}
+
+// joins the legs of a journey at the interchange: each first-leg train is joined to the second-leg train that arrives
+// soonest, of those leaving at least MIN_CHANGE_TIME after it arrives; a journey that leaves no later than another
+// but arrives no sooner is dropped, and the soonest arrivals are returned in departure order
+function planJourneys(first, second, maxJourneys) {
+    var journeys = [];
+    for (var i = 0; i < first.length; i++) {
+        var connection = null;
+        for (var j = 0; j < second.length; j++) {
+            if (second[j].time >= first[i].arrival + MIN_CHANGE_TIME && (connection === null || second[j].arrival < connection.arrival)) {
+                connection = second[j];
+            }
+        }
+        
+        if (connection !== null) {
+            journeys.push({time: first[i].time, arrival: connection.arrival, dest: connection.dest, platform: first[i].platform});
+        }
+    }
+    
+    // soonest arrival first, then the latest departure, so that each journey is only kept if it leaves later than all
+    // of the journeys that arrive sooner
+    journeys.sort(function (a, b) {
+        return (a.arrival - b.arrival) || (b.time - a.time);
+    });
+    
+    var best = [];
+    for (var k = 0; k < journeys.length && best.length < maxJourneys; k++) {
+        if (best.length === 0 || journeys[k].time > best[best.length - 1].time) {
+            best.push(journeys[k]);
+        }
+    }
+    
+    best.sort(function (a, b) {
+        return a.time - b.time;
+    });
+    return best;
+}
+
+// sends the journeys planned from the legs of an update; a failure of either leg fails the update
+function completeJourneys(pipeline, first, second) {
+    var failed = first.error !== null ? first : second;
+    if (failed.error !== null) {
+        sendRequestFailed(failed.error.reason, failed.error.xhr);
+        return;
+    }
+    
+    var planned = planJourneys(parseLeg(first.json, interchange_station), parseLeg(second.json, pipeline.route.destination),
+                               MAX_JOURNEYS);
+    var journeys = {time: [], arrival: [], dest: [], platform: [], cancelled: [], delayed: []};
+    for (var i = 0; i < planned.length; i++) {
+        journeys.time.push(planned[i].time);
+        journeys.arrival.push(planned[i].arrival);
+        journeys.dest.push(planned[i].dest);
+        journeys.platform.push(planned[i].platform);
+        journeys.cancelled.push(false);
+        journeys.delayed.push(false);
+    }
+    
+    // the journeys replace the watch's departure table, so the next direct trains are sent as a complete table
+    watch_timetable = null;
+    var base = Math.floor(Date.now() / 60000) * 60;
+    sendDepartures({
+        'KEY_JOURNEYS': codec.encodeJourneys(pipeline.route.origin, pipeline.route.destination, getTimeDiffSeconds(), base, journeys)
+    }, first.failure || second.failure, getBoards(pipeline), function () {}, function () {});
+}
+
+function sendDepartures(dictionary, failure, boards, success, error) {
+    dictionary.KEY_LAST_REQUEST_FAILED = 0;
+    if (dictionary.KEY_NEXT_SERVICE_DETAILS === null) {
+        delete dictionary.KEY_NEXT_SERVICE_DETAILS;
+    }
+    
+    // the last good response is being served; still report the failure, so that the watch backs off
+    if (failure !== null) {
+        dictionary.KEY_LAST_REQUEST_FAILED = failure.reason;
+        dictionary.KEY_RETRY_AFTER = getRetryAfter(failure.reason, failure.xhr);
+    }
+    
+    // only include the config if the watch's copy is out of date
+    var config_generation = codec.configGeneration(getConfig());
+    if (watch_config_generation !== config_generation) {
+        dictionary.KEY_CONFIG = codec.encodeConfig(getConfig());
+    }
+    
+    if (boards !== null) {
+        dictionary.KEY_BOARDS = codec.encodeBoards(getDeparturesBase(boards.boards.map(function (board) {
+            return board.trains;
+        })), boards.boards);
+    }
+    
+    // send to Pebble
+    Pebble.sendAppMessage(dictionary, function (e) {
+//         console.log('Data sent to Pebble successfully!');
+        if (dictionary.KEY_CONFIG) {
+            watch_config_generation = config_generation;
+        }
+        if (boards !== null) {
+            watch_boards = {routes: boards.routes, sent: Date.now()};
+        }
+        success();
+    }, function (e) {
+//         console.log('Error sending data to Pebble!');
+        if (boards !== null) {
+            watch_boards = null;
+        }
+        error();
+    });
+    finishUpdate();
+}
+
+// sends a complete departure table, which replaces the watch's table
+// the base time for departure tables sent to the watch: the current minute, or the scheduled time of an earlier train
+// that is delayed without an estimate, as times are sent as minutes after the base
+function getDeparturesBase(tables) {
+    var base = Math.floor(Date.now() / 60000) * 60;
+    for (var i = 0; i < tables.length; i++) {
+        for (var j = 0; j < tables[i].time.length; j++) {
+            base = Math.min(base, tables[i].time[j]);
+        }
+    }
+    
+    return base;
+}
+
+function sendTimetable(route, trains, windowEnd, failure, boards) {
+    var base = getDeparturesBase([trains]);
+    var timetable = {origin: route.origin, destination: route.destination, base: base, windowEnd: windowEnd, trains: trains};
+    
+    sendDepartures({
+        'KEY_DEPARTURES': codec.encodeDepartures(route.origin, route.destination, getTimeDiffSeconds(), base, trains),
+        'KEY_NEXT_SERVICE_DETAILS': getNextServiceDetails(route.destination, trains)
+    }, failure, boards, function () {
+        watch_timetable = timetable;
+    }, function () {
+        watch_timetable = null;
+    });
+}
+
+// sends only the trains that have changed since the watch's departure table was sent
+function sendDepartureUpdates(latest, failure, boards) {
+    var timetable = watch_timetable;
+    var trains = copyDepartureTable(timetable.trains);
+    var slots = mergeDepartures(trains, latest);
+    
+    // the watch's table is full; replace it with the trains that have not departed
+    if (trains.id.length > MAX_TIMETABLE_TRAINS) {
+        sendTimetable(timetable, compactDepartureTable(trains), timetable.windowEnd, failure, boards);
+        return;
+    }
+    
+    sendDepartures({
+        'KEY_DEPARTURE_UPDATES': codec.encodeDepartureUpdates(getTimeDiffSeconds(), timetable.base, trains, slots),
+        'KEY_NEXT_SERVICE_DETAILS': getNextServiceDetails(timetable.destination, trains)
+    }, failure, boards, function () {
+        if (watch_timetable === timetable) {
+            timetable.trains = trains;
+        }
+    }, function () {
+        // the watch's table is unknown; send a complete table next time
+        watch_timetable = null;
+    });
+}
+
+function getClockOffset(now) {
+    if (clock_offset === null) {
+        return 0;
+    }
+    
+    return clock_offset.offset + clock_offset.drift * (now - clock_offset.measured);
+}
+
+function getTimeDiffSeconds() {
+    return check_time ? Math.round(getClockOffset(Date.now()) / 1000) : 0;
+}
+
+function isClockCheckDue(now) {
+    return clock_offset === null || now - clock_offset.measured >= CLOCK_CHECK_INTERVAL;
+}
+
+function recordClockOffset(offset, now) {
+    // estimate the drift of the phone's clock from successive measurements, so that the offset stays accurate between them
+    var drift = 0;
+    if (clock_offset !== null) {
+        drift = clock_offset.drift;
+        if (now - clock_offset.measured >= CLOCK_DRIFT_MIN_INTERVAL) {
+            drift = (offset - clock_offset.offset) / (now - clock_offset.measured);
+            drift = Math.max(-MAX_CLOCK_DRIFT, Math.min(MAX_CLOCK_DRIFT, drift));
+        }
+    }
+    
+    clock_offset = {offset: offset, drift: drift, measured: now};
+    localStorage.setItem('clock_offset', JSON.stringify(clock_offset));
+}
+
+function checkClock(callback) {
+    var sent = Date.now();
+    xhrRequest('http://www.timeapi.org/utc/now', 'GET', function (responseText) {
+        var received = Date.now();
+        var remote_date = new Date(responseText);
+        
+        // assume that the server read its clock halfway through the request
+        if (!isNaN(remote_date.getTime())) {
+            var local_ms = (sent + received) / 2;
+            recordClockOffset(remote_date.getTime() - local_ms, local_ms);    // this is the amount to add to the local time to correct it
+        }
+        
+        callback();
+    }, function (reason, xhr) {
+        // the train times are still useful without a clock check
+        callback();
     });
 }
 
+function getConfig() {
+    return {
+        customisedDays: customisedDays,
+        days: [use_sunday, use_monday, use_tuesday, use_wednesday, use_thursday, use_friday, use_saturday],
+        customisedTimes: customisedTimes,
+        hours: [morning_start, morning_end, afternoon_start, afternoon_end],
+        updateOnlyOnTap: update_only_on_tap,
+        learnedTimes: learned_times
+    };
+}
+
+function sendConfig() {
+    var config_generation = codec.configGeneration(getConfig());
+    var dictionary = {
+        'KEY_CONFIG': codec.encodeConfig(getConfig())
+    };
+    
+    Pebble.sendAppMessage(dictionary, function (e) {
+        watch_config_generation = config_generation;
+    }, function (e) {});
+}
+
 function getConfigFromLocalStorage() {
     HOME_STATION = localStorage.getItem('home');
     if (HOME_STATION === null) {
@@ -311,6 +1343,12 @@ function getConfigFromLocalStorage() {
         WORK_STATION = 'EDB';
     }
     
+    // other routes to show on the watch, e.g. 'SUR-WAT, WIM-WAT'
+    saved_routes = parseRoutes(localStorage.getItem('routes')) || [];
+    
+    // the station at which to change trains, if the commute needs a change
+    interchange_station = localStorage.getItem('interchange');
+    
     useLocation = localStorage.getItem('useLocation');
     if (useLocation === null) {
         useLocation = true;
@@ -436,6 +1474,30 @@ function getConfigFromLocalStorage() {
         update_only_on_tap = parseLocalStorage(localStorage.getItem('update_only_on_tap'));
     }
     
+    // learn the update times from when the watch is glanced at, instead of using the configured days and times
+    learned_times = localStorage.getItem('learned_times');
+    if (learned_times === null) {
+        learned_times = false;
+    }
+    else {
+        learned_times = parseLocalStorage(localStorage.getItem('learned_times'));
+    }
+    
+    // seconds for which a departures response is reused without contacting the server
+    cache_ttl = localStorage.getItem('cache_ttl');
+    if (cache_ttl === null) {
+        cache_ttl = 60;
+    }
+    else {
+        cache_ttl = parseInt(localStorage.getItem('cache_ttl'));
+    }
+    
+    // null for the default departures service
+    endpoint = parseEndpoint(localStorage.getItem('endpoint'));
+    
+    debug_stats = localStorage.getItem('debug_stats');
+    debug_stats = debug_stats !== null && parseLocalStorage(debug_stats);
+    
 //     console.log('configured stations: ' + HOME_STATION + ', ' + WORK_STATION);
 //     console.log('configured useLocation: ' + useLocation);
 //     console.log('customisedDays: ' + customisedDays);
@@ -464,48 +1526,36 @@ function getConfigFromLocalStorage() {
 //     });
 // }
 
+// asks the watch for its instrumentation counters, which are logged when they arrive
+function requestStats() {
+    Pebble.sendAppMessage({'KEY_STATS': 1}, function (e) {}, function (e) {});
+}
+
 Pebble.addEventListener('ready', function (e) {
     getConfigFromLocalStorage();
+    clock_offset = JSON.parse(localStorage.getItem('clock_offset'));
     
-    // if using custom days or times, push this data to the watch
-    if (customisedDays || customisedTimes) {
-        var dictionary = {
-            'KEY_UPDATE': 0,
-            'KEY_CURRENT_ORIGIN': current_origin,
-            'KEY_CURRENT_DESTINATION': current_destination,
-            'CUSTOMISED_DAYS': customisedDays,
-            'USE_MONDAY': use_monday,
-            'USE_TUESDAY': use_tuesday,
-            'USE_WEDNESDAY': use_wednesday,
-            'USE_THURSDAY': use_thursday,
-            'USE_FRIDAY': use_friday,
-            'USE_SATURDAY': use_saturday,
-            'USE_SUNDAY': use_sunday,
-            'CUSTOMISED_TIMES': customisedTimes,
-            'MORNING_START': parseInt(morning_start),
-            'MORNING_END': parseInt(morning_end),
-            'AFTERNOON_START': parseInt(afternoon_start),
-            'AFTERNOON_END': parseInt(afternoon_end),
-            'TIME_DIFF_FROM_UTC': time_diff_ms,
-            'KEY_LAST_REQUEST_FAILED': 0,
-            'KEY_UPDATE_ONLY_ON_TAP': update_only_on_tap
-        };
+    // the k-d tree of station coordinates is pre-built by tools/stations_index.py
+    stations_tree = new datastructure.StaticKDTree(stations_index);
     
-        Pebble.sendAppMessage(dictionary, function (e) {}, function (e) {});
+    // each request costs a round trip and a reply from the watch, so it is only made when debugging
+    if (debug_stats) {
+        setTimeout(requestStats, STATS_REQUEST_DELAY);
     }
-    
-    // build k-d tree data structure from station coordinate data
-    stations_tree = new datastructure.KDTree(stations);
 });
 
 Pebble.addEventListener('appmessage', function (e) {
 //     console.log('AppMessage received, useLocation: ' + useLocation);
-    if (useLocation === true) {
-        getLocation();
+    if ('KEY_STATS' in e.payload) {
+        console.log('watch stats: ' + JSON.stringify(codec.decodeStats(e.payload.KEY_STATS)));
+        return;
     }
-    else {
-        locationError(null);
+    
+    if ('KEY_CONFIG_GENERATION' in e.payload) {
+        watch_config_generation = e.payload.KEY_CONFIG_GENERATION;
     }
+    
+    requestUpdate(false);
 });
 
 Pebble.addEventListener('showConfiguration', function(e) {
@@ -529,6 +1579,17 @@ Pebble.addEventListener('webviewclosed', function(e) {
     if ('useLocation' in configData) {
         localStorage.setItem('useLocation', configData.useLocation);
     }
+    if ('routes' in configData && parseRoutes(configData.routes) !== null) {
+        localStorage.setItem('routes', configData.routes);
+    }
+    if ('interchange' in configData) {
+        if (configData.interchange === '') {
+            localStorage.removeItem('interchange');
+        }
+        else if (/^[A-Za-z]{3}$/.test(configData.interchange)) {
+            localStorage.setItem('interchange', configData.interchange.toUpperCase());
+        }
+    }
     
     if ('customisedDays' in configData) {
         localStorage.setItem('customisedDays', configData.customisedDays);
@@ -583,12 +1644,36 @@ Pebble.addEventListener('webviewclosed', function(e) {
         localStorage.setItem('update_only_on_tap', configData.update_only_on_tap);
     }
     
-    getConfigFromLocalStorage();
+    if ('learned_times' in configData) {
+        localStorage.setItem('learned_times', configData.learned_times);
+    }
     
-    if (useLocation === true) {
-        getLocation();
+    if ('debug_stats' in configData) {
+        localStorage.setItem('debug_stats', configData.debug_stats);
     }
-    else {
-        locationError(null);
+    if ('cache_ttl' in configData) {
+        localStorage.setItem('cache_ttl', configData.cache_ttl);
     }
+    
+    // an empty endpoint restores the default service; responses from the previous service are not reused
+    if ('endpoint' in configData && (configData.endpoint === '' || parseEndpoint(configData.endpoint) !== null)) {
+        var configured = configData.endpoint === '' ? null : parseEndpoint(configData.endpoint);
+        if (configured !== localStorage.getItem('endpoint')) {
+            departures_cache = {};
+            localStorage.removeItem('departures_cache');
+        }
+        if (configured === null) {
+            localStorage.removeItem('endpoint');
+        }
+        else {
+            localStorage.setItem('endpoint', configured);
+        }
+    }
+    
+    getConfigFromLocalStorage();
+    sendConfig();
+    
+    // the stations or update times may have changed, so send a complete timetable
+    watch_timetable = null;
+    requestUpdate(true);
 });
\ No newline at end of file
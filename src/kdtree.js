@@ -224,8 +224,91 @@ var datastructure = (function() {
 		return dx * dx + dy * dy;
 	}
 	
+	/**
+	 * StaticKDTree class that searches a pre-balanced k-d tree stored in packed arrays, as generated by tools/stations_index.py.
+	 * The tree is implicit: for the entries [lo, hi) of a subtree, the node is at (lo + hi) >> 1. No construction is needed.
+	 * @param index {scale, x: Int32Array, y: Int32Array, crs: Uint16Array}, in tree order; coordinates are multiplied by
+	 * scale, and CRS codes are base-26 integers
+	 * @returns {StaticKDTree}
+	 */
+	function StaticKDTree(index) {
+		this.scale = index.scale;
+		this.x = index.x;
+		this.y = index.y;
+		this.crs = index.crs;
+	}
+	
+	/**
+	 * Decodes a base-26 CRS code, e.g. 0 is 'AAA'.
+	 */
+	function decodeCRS(value) {
+		return String.fromCharCode(65 + Math.floor(value / 676), 65 + Math.floor(value / 26) % 26, 65 + value % 26);
+	}
+	
+	/**
+	 * Finds the nearest neighbour to a point within the k-d tree
+	 * @param searchCoord The search point {x:?, y:?} of which the nearest neighbour are desired.
+	 * @returns The nearest neighbour point {x:?, y:?, CRS:?} to the searchCoord, or null if the tree is empty.
+	 */
+	StaticKDTree.prototype.getNearestNeighbour = function(searchCoord) {
+		var results = this.getNearestNeighbours(searchCoord, 1);
+		return results.length === 0 ? null : results[0];
+	};
+	
+	/**
+	 * Finds a specified number of nearest neighbours to a point within the k-d tree.
+	 * @param searchCoord The search point {x:?, y:?} of which the nearest neighbours are desired.
+	 * @param maxResults The maximum number of nearest neighbours to find
+	 * @returns The nearest neighbour points [{x:?, y:?, CRS:?}, ...], sorted nearest first.
+	 */
+	StaticKDTree.prototype.getNearestNeighbours = function(searchCoord, maxResults) {
+		var results = [];
+		var scaledCoord = {x: searchCoord.x * this.scale, y: searchCoord.y * this.scale};
+		this.getNearestNeighbours_(0, this.x.length, 0, scaledCoord, results, maxResults);
+		
+		var points = [];
+		for (var i = 0; i < results.length; i++) {
+			points.push({
+				x: this.x[results[i].node] / this.scale,
+				y: this.y[results[i].node] / this.scale,
+				CRS: decodeCRS(this.crs[results[i].node])
+			});
+		}
+		return points;
+	};
+	
+	/**
+	 * Internal recursive function to search the subtree of entries [lo, hi).
+	 * @param searchCoord The search point {x:?, y:?}, multiplied by the index's scale
+	 * @param results A sorted array of the best {node, distance} results seen so far; updated in place
+	 * @param maxResults The maximum number of nearest neighbours to find
+	 */
+	StaticKDTree.prototype.getNearestNeighbours_ = function(lo, hi, depth, searchCoord, results, maxResults) {
+		if (lo >= hi) {
+			return;
+		}
+		
+		var node = (lo + hi) >> 1;
+		var distance = getSquaredEuclidianDistance(searchCoord.x, searchCoord.y, this.x[node], this.y[node]);
+		insertResult_(results, {node: node, distance: distance}, maxResults);
+		
+		var axis = depth % K;
+		var delta = axis == AXIS_X ? searchCoord.x - this.x[node] : searchCoord.y - this.y[node];
+		var nearLo = delta < 0 ? lo : node + 1;
+		var nearHi = delta < 0 ? node : hi;
+		var farLo = delta < 0 ? node + 1 : lo;
+		var farHi = delta < 0 ? hi : node;
+		
+		// search target subtree, then the opposite subtree only if the splitting plane is closer than the worst result
+		this.getNearestNeighbours_(nearLo, nearHi, depth + 1, searchCoord, results, maxResults);
+		if (results.length < maxResults || delta * delta <= results[results.length - 1].distance) {
+			this.getNearestNeighbours_(farLo, farHi, depth + 1, searchCoord, results, maxResults);
+		}
+	};
+	
 	// export the data structure
 	var module = {};
 	module.KDTree = KDTree;  // KDTree constructor.
+	module.StaticKDTree = StaticKDTree;  // StaticKDTree constructor.
 	return module;
 })();
\ No newline at end of file
@@ -16,6 +16,9 @@
 
 
 #include <pebble.h>
+#include "scheduler.h"
+#include "stats.h"
+#include "usage.h"
 
 #define BATTERY_INDICATOR_X        138
 #define BATTERY_INDICATOR_Y        6
@@ -27,47 +30,71 @@
 
 #define MINUTE_ROLLOVER_THRESHOLD  2
 
+#define TIME_DIFF_X                3
+
 
 // AppMessage keys
 enum {
     KEY_UPDATE = 0,                 // used to trigger update from Pebble to phone
-    KEY_CURRENT_ORIGIN = 1,         // string of station code
-    KEY_CURRENT_DESTINATION = 2,    // string of station code
-    KEY_TRAIN1_TIME = 3,            // time_t value stored as int
-    KEY_TRAIN1_DEST = 4,            // string of station code
-    KEY_TRAIN1_PLATFORM = 5,        // int of origin station platform number
-    KEY_TRAIN2_TIME = 6,            // time_t value stored as int
-    KEY_TRAIN3_TIME = 7,            // time_t value stored as int
-    KEY_TRAIN1_IS_CANCELED = 8,     // boolean value stored as int
-    CUSTOMISED_DAYS = 9,            // boolean value stored as int
-    USE_MONDAY = 10,                // boolean value stored as int
-    USE_TUESDAY = 11,               // boolean value stored as int
-    USE_WEDNESDAY = 12,             // boolean value stored as int
-    USE_THURSDAY = 13,              // boolean value stored as int
-    USE_FRIDAY = 14,                // boolean value stored as int
-    USE_SATURDAY = 15,              // boolean value stored as int
-    USE_SUNDAY = 16,                // boolean value stored as int
-    CUSTOMISED_TIMES = 17,          // boolean value stored as int
-    MORNING_START = 18,             // int
-    MORNING_END = 19,               // int
-    AFTERNOON_START = 20,           // int
-    AFTERNOON_END = 21,             // int
-    KEY_TRAIN2_IS_CANCELED = 24,    // boolean value stored as int
-    KEY_TRAIN3_IS_CANCELED = 25,    // boolean value stored as int
-    TIME_DIFF_FROM_UTC = 26,        // int
-    KEY_LAST_REQUEST_FAILED = 27,   // boolean value stored as int
-    KEY_UPDATE_ONLY_ON_TAP = 28   // boolean value stored as int
+    KEY_LAST_REQUEST_FAILED = 27,   // int: 0 on success, otherwise the REQUEST_FAILED_* class from data.js
+    KEY_DEPARTURES = 29,            // byte array, see decode_departures()
+    KEY_CONFIG = 30,                // byte array, see decode_config()
+    KEY_CONFIG_GENERATION = 31,     // uint16 generation of the stored config, sent with each update request
+    KEY_RETRY_AFTER = 32,           // int: seconds to wait before retrying a failed request
+    KEY_DEPARTURE_UPDATES = 33,     // byte array, see decode_departure_updates()
+    KEY_STATS = 34,                 // from the phone: any value, to request the stats; to the phone: byte array, see stats.c
+    KEY_BOARDS = 35,                // byte array, see decode_boards()
+    KEY_JOURNEYS = 36,              // byte array, see decode_journeys()
+    KEY_NEXT_SERVICE_DETAILS = 37   // byte array, see decode_service_details()
+};
+
+// packed AppMessage payloads; the layouts must match the encoders in codec.js
+#define PROTOCOL_VERSION                3
+#define DEPARTURES_HEADER_SIZE          16
+#define DEPARTURE_RECORD_SIZE           6
+#define MAX_DEPARTURE_RECORDS           36     // size of the departure table; must match MAX_TIMETABLE_TRAINS in data.js
+#define DEPARTURE_UPDATES_HEADER_SIZE   6
+#define DEPARTURE_UPDATE_RECORD_SIZE    (1 + DEPARTURE_RECORD_SIZE)
+#define MAX_DEPARTURE_UPDATE_RECORDS    6      // must be at least NUMBER_OF_TRAINS in data.js
+#define BOARDS_HEADER_SIZE              6
+#define BOARD_HEADER_SIZE               7
+#define MAX_BOARDS                      3      // must match MAX_BOARDS in data.js
+#define MAX_BOARD_RECORDS               4      // must match BOARD_TRAINS in data.js
+#define MAX_BOARDS_SIZE                 (BOARDS_HEADER_SIZE + MAX_BOARDS * (BOARD_HEADER_SIZE + MAX_BOARD_RECORDS * DEPARTURE_RECORD_SIZE))
+#define JOURNEY_RECORD_SIZE             (DEPARTURE_RECORD_SIZE + 2)
+#define MAX_JOURNEY_RECORDS             6      // must match MAX_JOURNEYS in data.js
+#define SERVICE_DETAILS_SIZE            10
+#define CRS_CODE_UNKNOWN                0xFFFF
+#define CONFIG_RECORD_SIZE              9
+#define TRAIN_FLAG_CANCELLED            0x01
+#define TRAIN_FLAG_DELAYED              0x02    // delayed without an estimate: kept past its time until an update clears it
+#define CONFIG_FLAG_CUSTOMISED_DAYS     0x01
+#define CONFIG_FLAG_CUSTOMISED_TIMES    0x02
+#define CONFIG_FLAG_UPDATE_ONLY_ON_TAP  0x04
+#define CONFIG_FLAG_LEARNED_TIMES       0x08
+
+// persistent storage keys
+enum {
+    PERSIST_KEY_SNAPSHOT = 0,       // PersistSnapshot struct
+    PERSIST_KEY_CONFIG = 1,         // config record, as received in KEY_CONFIG
+    PERSIST_KEY_STATS = 2,          // see stats.c
+    PERSIST_KEY_USAGE = 3,          // see usage.c
+    PERSIST_KEY_BOARDS = 4          // boards, as received in KEY_BOARDS
 };
 
 // train update settings
-const uint32_t INITIAL_UPDATE_DELAY_MILLISECONDS = 3000;
 const uint32_t REMOVE_TAP_UPDATE_DELAY_MILLISECONDS = 60000;
-const int32_t TRAIN_UPDATE_PERIOD_MINUTES = 15;
-const int32_t MAX_DURATION_WITHOUT_UPDATE_MINUTES = -99;
+const uint32_t BOARD_DISPLAY_MILLISECONDS = 30000;             // the current route is shown again this long after a tap shows another board
+const uint32_t RECONNECT_UPDATE_DELAY_MILLISECONDS = 3000;     // lets the connection settle, and merges repeated reconnections
+const time_t RECONNECT_UPDATE_MIN_AGE_SECONDS = 5 * 60;        // data at least this old are refreshed on reconnection
+const time_t STALE_DATA_AGE_SECONDS = 20 * 60;                 // the age of data at least this old is shown
+const time_t MAX_DATA_AGE_SECONDS = 3 * 60 * 60;               // train times at least this old are not shown at all
 
 // train update schedule
 //   time values use 24 h clock: 0-23
 //   AFTERNOON_UPDATES_END_HOUR can be after midnight
+//   with learned times, windows learned from glances replace the days and times, once there is enough history
+static int use_learned_times = 0;
 static int use_customised_days = 0;
 static int customised_days_array[7] = {1, 1, 1, 1, 1, 1, 1};
 static int use_customised_times = 0;
@@ -81,37 +108,137 @@ static int AFTERNOON_UPDATES_START_HOUR = 16;
 static int AFTERNOON_UPDATES_END_HOUR = 20;
 
 // UI
+//   the next train is shown in the first column, with its route on a third line across the full width; the following
+//   trains share the remaining columns, unless the next train's service details are shown across the full width
+#define MAX_DISPLAYED_TRAINS 3
 const uint16_t TRAIN_TIMES_X_OFFSET = 5;
 const uint16_t TRAIN_TIMES_Y_OFFSET = 105;
+const uint16_t TRAIN1_COLUMN_WIDTH = 48 + 6;
+const uint16_t TRAIN1_HEIGHT = 60;
+const uint16_t TRAIN_HEIGHT = 40;
 static Window *s_main_window;
 static TextLayer *s_time_layer;
 static TextLayer *s_date_layer;
-static TextLayer *s_next_train_col1_layer;
-static TextLayer *s_next_train_col2_layer;
-static TextLayer *s_next_train_col3_layer;
+static Layer *s_trains_layer;
 static Layer *s_info_layer;
-static TextLayer *s_time_diff_layer;
+static GFont s_train1_font;
+static GFont s_train_font;
+static GFont s_time_diff_font;
+static GRect train_rects[MAX_DISPLAYED_TRAINS];
 AppTimer *remove_tap_update_timer = NULL;
+AppTimer *reconnect_update_timer = NULL;
+AppTimer *low_power_timer = NULL;
+AppTimer *board_timer = NULL;
+
+// low-power state, outside update periods: only the clock and date are drawn, no train updates are requested, and taps
+// are ignored unless they may open a learned update window; AppMessage stays open, so that a config change is still
+// received; a single timer ends the state at the start of the next update period
+static bool low_power = false;
 
 // train data
 static char current_origin[] = "XXX";
 static char current_destination[] = "XXX";
-static time_t train1_time = 0;
-static time_t train2_time = 0;
-static time_t train3_time = 0;
-static char train1_time_buf[] = "999 min\n00:00\nXXX to XXX (99)";
-static char train2_time_buf[] = "999 min\n00:00";
-static char train3_time_buf[] = "999 min\n00:00";
-static char train1_dest[] = "XXX";
-static int train1_platform = 0;
-static int train1_is_cancelled = 0;
-static int train2_is_cancelled = 0;
-static int train3_is_cancelled = 0;
 static time_t last_update = 0;
+static time_t scheduled_departure = 0;     // the next departure when the update schedule was last calculated
 static int time_diff_s = 0;
-static char time_diff_buf[] = "-99999";
 static int last_request_failed = 0;
 static int update_only_on_tap = 0;
+static uint16_t config_generation = 0;     // 0 if no config has been received
+
+// departure table: the services in the commute window, in the slots assigned by the phone, so that later updates
+// only need to send the services that have changed; departed trains are skipped locally, without a round trip to the
+// phone
+typedef struct {
+    time_t base;                    // departure times are sent as minutes after this time
+    uint8_t head;                   // slots before this have departed
+    uint8_t count;                  // number of slots in use
+    time_t time[MAX_DEPARTURE_RECORDS];
+    char dest[MAX_DEPARTURE_RECORDS][4];
+    uint8_t platform[MAX_DEPARTURE_RECORDS];    // 0 if unknown
+    uint8_t flags[MAX_DEPARTURE_RECORDS];       // TRAIN_FLAG_*
+    bool journeys;                              // true if the table holds journeys with a change, from KEY_JOURNEYS
+    time_t arrival[MAX_JOURNEY_RECORDS];        // for journeys, the arrival time at the final destination
+} DepartureTable;
+
+static DepartureTable departures;
+
+// boards: the next few trains on each of the phone's saved routes other than the current route, shown in turn on tap
+// without a round trip to the phone; they are only refreshed occasionally, as updates are for the current route
+typedef struct {
+    char origin[4];
+    char destination[4];
+    uint8_t count;
+    time_t time[MAX_BOARD_RECORDS];
+    char dest[MAX_BOARD_RECORDS][4];
+    uint8_t platform[MAX_BOARD_RECORDS];
+    uint8_t flags[MAX_BOARD_RECORDS];
+} Board;
+
+static Board boards[MAX_BOARDS];
+static int board_count = 0;
+static int visible_board = 0;               // 0 for the departure table, otherwise boards[visible_board - 1]
+
+// details of the next train on the departure table, looked up by the phone once per service; they are only shown while
+// that train is the next train
+typedef struct {
+    time_t time;                    // departure time of the train, or 0 if no details have been received
+    char dest[4];
+    time_t arrival;                 // expected arrival at the route's destination
+    uint8_t stops;                  // stops before the route's destination
+} ServiceDetails;
+
+static ServiceDetails next_service;
+
+// the trains of a board, as drawn by update_UI()
+typedef struct {
+    const char *origin;
+    int head;
+    int count;
+    const time_t *time;
+    char (*dest)[4];
+    const uint8_t *platform;
+    const uint8_t *flags;
+    const time_t *arrival;          // NULL unless the trains are journeys with a change
+} BoardView;
+
+// snapshot of the last received data, restored on start-up so that trains are shown without waiting for the phone
+//   the departure table is stored as records in the KEY_DEPARTURES format; the whole struct must fit in one persist
+//   key, i.e. 256 bytes
+#define SNAPSHOT_VERSION 5
+typedef struct __attribute__((__packed__)) {
+    uint8_t version;
+    char current_origin[4];
+    char current_destination[4];
+    int32_t time_diff_s;
+    int32_t last_update;
+    uint32_t departure_base;
+    uint8_t departure_head;
+    uint8_t departure_count;
+    uint8_t departures[MAX_DEPARTURE_RECORDS * DEPARTURE_RECORD_SIZE];
+    uint8_t departure_journeys;
+    uint16_t arrivals[MAX_JOURNEY_RECORDS];     // minutes after departure_base
+} PersistSnapshot;
+
+// display record of each train drawn by trains_layer_update_callback(); the text is only reformatted, and the layer
+// only marked dirty, when the content changes
+typedef struct {
+    bool valid;                     // false forces the next update_UI() to reformat the train
+    bool shown;                     // false if the train is blank
+    time_t time;
+    int diff_min;
+    int is_cancelled;
+    int platform;
+    time_t arrival;                 // 0 unless the train is the first leg of a journey, or has service details
+    int stops;                      // -1 unless the train has service details
+    bool is_24h;
+    char text[sizeof("999 min, 255 stops\n00:00, arr 00:00\nXXX to XXX (99)")];
+} TrainDisplay;
+
+static int rendered_minute = -1;
+static int rendered_day = -1;
+static int rendered_battery_level = -1;
+static int rendered_data_age = -1;          // minutes, or -1 if the age of the data is not shown
+static TrainDisplay displayed_trains[MAX_DISPLAYED_TRAINS];
 
 
 static void remove_char(char *str, char to_remove) {
@@ -132,15 +259,220 @@ static void remove_char(char *str, char to_remove) {
     *dst = '\0';
 }
 
-static bool is_train_update_period() {
+static BoardView get_board_view(int board) {
+    if (board == 0) {
+        return (BoardView) {
+            .origin = current_origin,
+            .head = departures.head,
+            .count = departures.count,
+            .time = departures.time,
+            .dest = departures.dest,
+            .platform = departures.platform,
+            .flags = departures.flags,
+            .arrival = departures.journeys ? departures.arrival : NULL
+        };
+    }
+    
+    Board *b = &boards[board - 1];
+    return (BoardView) {
+        .origin = b->origin,
+        .head = 0,
+        .count = b->count,
+        .time = b->time,
+        .dest = b->dest,
+        .platform = b->platform,
+        .flags = b->flags,
+        .arrival = NULL
+    };
+}
+
+// a train has departed once the minute of its departure has passed, unless it is delayed without an estimate; that
+// train is late until the phone no longer lists it
+static bool has_departed(time_t time, uint8_t flags, time_t now) {
+    return time < now - now % 60 && (flags & TRAIN_FLAG_DELAYED) == 0;
+}
+
+static int next_departures(const BoardView *view, time_t now, int *slots, int max) {
+    // finds the slots of up to max trains that have not departed, in departure order
+    // updates can reorder trains, e.g. when one is delayed, so the slots are not necessarily in departure order
+    int found = 0;
+    
+    for (int slot = view->head; slot < view->count; slot++) {
+        if (has_departed(view->time[slot], view->flags[slot], now)) {
+            continue;
+        }
+        
+        int i = found;
+        while (i > 0 && view->time[slots[i - 1]] > view->time[slot]) {
+            if (i < max) {
+                slots[i] = slots[i - 1];
+            }
+            i--;
+        }
+        if (i < max) {
+            slots[i] = slot;
+            if (found < max) {
+                found++;
+            }
+        }
+    }
+    
+    return found;
+}
+
+static time_t next_departure_time() {
+    int slot;
+    BoardView view = get_board_view(0);
+    return next_departures(&view, time(NULL), &slot, 1) > 0 ? departures.time[slot] : 0;
+}
+
+static void clear_departures() {
+    departures.head = 0;
+    departures.count = 0;
+    departures.journeys = false;
+}
+
+static void drop_departed_trains(time_t now) {
+    // skip the leading slots once their trains have departed, so that they are not searched again
+    while (departures.head < departures.count &&
+            has_departed(departures.time[departures.head], departures.flags[departures.head], now)) {
+        departures.head++;
+    }
+}
+
+static void invalidate_train_render_cache() {
+    for (unsigned int i = 0; i < ARRAY_LENGTH(displayed_trains); i++) {
+        displayed_trains[i].valid = false;
+    }
+}
+
+static bool train_render_changed(TrainDisplay *display, time_t time, int diff_min, int is_cancelled, int platform,
+                                 time_t arrival, int stops) {
+    bool is_24h = clock_is_24h_style();
+    
+    if (display->valid && display->shown && display->time == time && display->diff_min == diff_min &&
+            display->is_cancelled == is_cancelled && display->platform == platform && display->arrival == arrival &&
+            display->stops == stops && display->is_24h == is_24h) {
+        return false;
+    }
+    
+    display->valid = true;
+    display->shown = true;
+    display->time = time;
+    display->diff_min = diff_min;
+    display->is_cancelled = is_cancelled;
+    display->platform = platform;
+    display->arrival = arrival;
+    display->stops = stops;
+    display->is_24h = is_24h;
+    return true;
+}
+
+static bool clear_train_display(TrainDisplay *display) {
+    if (!display->valid || display->shown) {
+        display->valid = true;
+        display->shown = false;
+        return true;
+    }
+    
+    return false;
+}
+
+static void append_time(char *text, size_t size, time_t time, bool is_24h) {
+    int str_next = strlen(text);
+    
+    struct tm *time_tm = localtime(&time);
+    if (is_24h) {
+        strftime(&text[str_next], size - str_next, "%H:%M", time_tm);
+    }
+    else {
+        strftime(&text[str_next], size - str_next, "%l:%M", time_tm);
+        
+        // remove initial space in 12 h format output
+        if (text[str_next] == ' ') {
+            remove_char(&text[str_next], ' ');
+        }
+    }
+}
+
+static void format_train(TrainDisplay *display, bool is_next_train, const char *origin, const char *dest) {
+    // the next train: "12 min\n08:15\nGLC to EDB (3)"; with service details, "12 min, 4 stops\n08:15, arr 09:02\nGLC to
+    // EDB (3)"; for a journey with a change, "12 min\n08:15\narr 09:02 (3)"; other trains: "27 min\n08:30"
+    bool has_details = is_next_train && !display->is_cancelled && display->stops >= 0;
+    if (is_next_train || !display->is_cancelled) {
+        snprintf(display->text, sizeof(display->text), "%d min", display->diff_min);
+    }
+    else {
+        snprintf(display->text, sizeof(display->text), "canc.");
+    }
+    
+    int str_next = strlen(display->text);
+    if (has_details && display->stops == 0) {
+        snprintf(&display->text[str_next], sizeof(display->text) - str_next, ", non-stop\n");
+    }
+    else if (has_details) {
+        snprintf(&display->text[str_next], sizeof(display->text) - str_next, ", %d stop%s\n", display->stops,
+                 display->stops == 1 ? "" : "s");
+    }
+    else {
+        snprintf(&display->text[str_next], sizeof(display->text) - str_next, "\n");
+    }
+    append_time(display->text, sizeof(display->text), display->time, display->is_24h);
+    
+    if (!is_next_train) {
+        return;
+    }
+    
+    if (has_details) {
+        str_next = strlen(display->text);
+        snprintf(&display->text[str_next], sizeof(display->text) - str_next, ", arr ");
+        append_time(display->text, sizeof(display->text), display->arrival, display->is_24h);
+    }
+    
+    str_next = strlen(display->text);
+    if (display->is_cancelled) {
+        snprintf(&display->text[str_next], sizeof(display->text) - str_next, "\nCancelled");
+    }
+    else if (display->arrival != 0 && !has_details) {
+        snprintf(&display->text[str_next], sizeof(display->text) - str_next, "\narr ");
+        append_time(display->text, sizeof(display->text), display->arrival, display->is_24h);
+        
+        str_next = strlen(display->text);
+        if (display->platform > 0) {
+            snprintf(&display->text[str_next], sizeof(display->text) - str_next, " (%i)", display->platform);
+        }
+    }
+    else if (display->platform > 0) {
+        snprintf(&display->text[str_next], sizeof(display->text) - str_next, "\n%s to %s (%i)", origin, dest, display->platform);
+    }
+    else {
+        snprintf(&display->text[str_next], sizeof(display->text) - str_next, "\n%s to %s", origin, dest);
+    }
+}
+
+static int battery_level(uint8_t percent) {
+    // the battery indicator only has three states; see info_layer_update_callback()
+    if (percent <= 10) {
+        return 2;
+    }
+    else if (percent <= 20) {
+        return 1;
+    }
+    return 0;
+}
+
+static bool is_train_update_period_at(time_t t) {
 //     return true;    // TODO for testing
     
     if (update_only_on_tap) {
         return true;
     }
     
-    time_t temp = time(NULL); 
-    struct tm *tick_time = localtime(&temp);
+    if (use_learned_times && usage_has_history()) {
+        return usage_is_active_at(t);
+    }
+    
+    struct tm *tick_time = localtime(&t);
     
 //     APP_LOG(APP_LOG_LEVEL_ERROR, "is_train_update_period() days: %i, %i, %i, %i, %i, %i, %i, %i, %i", tick_time->tm_wday, use_customised_days, customised_days_array[0], customised_days_array[1], customised_days_array[2], customised_days_array[3], customised_days_array[4], customised_days_array[5], customised_days_array[6]);
 //     APP_LOG(APP_LOG_LEVEL_ERROR, "is_train_update_period() hours: %i, %i, %i, %i, %i", tick_time->tm_hour, MORNING_UPDATES_START_HOUR, MORNING_UPDATES_END_HOUR, AFTERNOON_UPDATES_START_HOUR, AFTERNOON_UPDATES_END_HOUR);
@@ -175,209 +507,541 @@ static bool is_train_update_period() {
     return false;
 }
 
+static bool is_train_update_period() {
+    return is_train_update_period_at(time(NULL));
+}
+
+static time_t next_train_update_period_change(time_t from) {
+    if (!update_only_on_tap && use_learned_times && usage_has_history()) {
+        return usage_next_change(from);
+    }
+    
+    // configured update periods start and end on the hour, so only hour boundaries need to be checked; UK time zones
+    // are whole hours from UTC
+    time_t step = 3600;
+    bool in_period = is_train_update_period_at(from);
+    time_t t = from - (from % step) + step;
+    
+    for (int i = 0; i < 8 * 24 * 3600 / step; i++, t += step) {
+        if (is_train_update_period_at(t) != in_period) {
+            return t;
+        }
+    }
+    
+    return 0;
+}
+
 static void request_trains_update() {
-    if (is_train_update_period()) {
+    // coalesce requests, e.g. from repeated taps, and back off after failures
+    if (!low_power && is_train_update_period() && scheduler_request_allowed(time(NULL))) {
         DictionaryIterator *iter;
-        app_message_outbox_begin(&iter);        // begin dictionary
-        dict_write_uint8(iter, KEY_UPDATE, 1);  // add a key-value pair
-        app_message_outbox_send();              // send the message
+        AppMessageResult result = app_message_outbox_begin(&iter);     // begin dictionary
+        if (result == APP_MSG_OK) {
+            dict_write_uint8(iter, KEY_UPDATE, 1);  // add a key-value pair
+            dict_write_uint16(iter, KEY_CONFIG_GENERATION, config_generation);
+            result = app_message_outbox_send();     // send the message
+        }
+        
+        // the outbox may be busy, e.g. with the stats; the scheduler tries again after the minimum interval
+        if (result == APP_MSG_OK) {
+            scheduler_request_sent(time(NULL));
+            stats_request_sent();
+        }
+        else {
+            stats_message_failed(result);
+            scheduler_request_not_delivered(time(NULL));
+        }
     }
     
     layer_mark_dirty(s_info_layer);
 }
 
-static void initial_update() {
-    if (!update_only_on_tap) {
-        request_trains_update();
+static void reschedule_train_updates() {
+    // in tap-only mode, updates are only requested by tap_handler(); in the low-power state, the next update period is
+    // started by low_power_timer
+    if (update_only_on_tap || low_power) {
+        scheduler_stop();
+        return;
     }
+    
+    time_t now = time(NULL);
+    scheduled_departure = next_departure_time();
+    SchedulerInputs inputs = {
+        .next_departure = scheduled_departure
+    };
+    
+    if (is_train_update_period_at(now)) {
+        inputs.window_end = next_train_update_period_change(now);
+        if (inputs.window_end == 0) {
+            // update period never ends
+            inputs.window_end = now + 8 * 24 * 3600;
+        }
+        else {
+            inputs.next_window_start = next_train_update_period_change(inputs.window_end);
+        }
+    }
+    else {
+        inputs.next_window_start = next_train_update_period_change(now);
+    }
+    
+    scheduler_update(now, &inputs);
 }
 
-static bool update_UI(struct tm *tick_time) {
-//     APP_LOG(APP_LOG_LEVEL_DEBUG, "update_UI()");
-    bool need_train_update = false;
-    bool can_update = is_train_update_period();
+static void scheduled_update() {
+    request_trains_update();
+    reschedule_train_updates();
+}
+
+static uint32_t read_uint32(const uint8_t *data) {
+    return (uint32_t) data[0] | ((uint32_t) data[1] << 8) | ((uint32_t) data[2] << 16) | ((uint32_t) data[3] << 24);
+}
+
+static uint16_t read_uint16(const uint8_t *data) {
+    return (uint16_t) data[0] | ((uint16_t) data[1] << 8);
+}
+
+static void read_crs(char *dst, const uint8_t *src) {
+    memcpy(dst, src, 3);
+    dst[3] = '\0';
+}
+
+static void read_crs_code(char *dst, uint16_t code) {
+    // CRS codes are packed in base 26, first letter most significant
+    if (code == CRS_CODE_UNKNOWN || code >= 26 * 26 * 26) {
+        dst[0] = '\0';
+        return;
+    }
     
-    // get time structures
-    time_t temp = time(NULL); 
-    struct tm *tick_time_zero_seconds = localtime(&temp);
-    tick_time_zero_seconds->tm_sec = 0;                                   // set seconds to zero to ensure consist display
-    time_t now = mktime(tick_time_zero_seconds);
+    dst[0] = 'A' + code / (26 * 26);
+    dst[1] = 'A' + (code / 26) % 26;
+    dst[2] = 'A' + code % 26;
+    dst[3] = '\0';
+}
 
-    static char time_buffer[] = "00:00";
-    clock_copy_time_string(time_buffer, sizeof(time_buffer));
-    text_layer_set_text(s_time_layer, time_buffer);
+static uint16_t crs_code(const char *crs) {
+    if (strlen(crs) != 3) {
+        return CRS_CODE_UNKNOWN;
+    }
     
-    static char date_buffer[] = "Wednesday\n30 September";                // create maximum sized date buffer
-    strftime(date_buffer, sizeof(date_buffer), "%A\n%e %B", tick_time);   // comment-out this line to test max string length
-                
-    // remove initial ' ' in date format output i.e. if ' ' follows '\n'
-    char *quotPtr = strchr(date_buffer, '\n');
-    if (quotPtr != NULL) {
-        int position = quotPtr - date_buffer;
-        if (date_buffer[position + 1] == ' ') {
-            remove_char(date_buffer, ' ');
-        }
+    return (crs[0] - 'A') * 26 * 26 + (crs[1] - 'A') * 26 + (crs[2] - 'A');
+}
+
+static void read_train_record(const uint8_t *record, time_t base, time_t *time, char *dest, uint8_t *platform, uint8_t *flags) {
+    *time = base + read_uint16(&record[0]) * 60;
+    read_crs_code(dest, read_uint16(&record[2]));
+    *platform = record[4];
+    *flags = record[5];
+}
+
+static void read_departure_record(int slot, const uint8_t *record) {
+    read_train_record(record, departures.base, &departures.time[slot], departures.dest[slot], &departures.platform[slot],
+                      &departures.flags[slot]);
+}
+
+static void write_departure_record(int slot, uint8_t *record) {
+    uint16_t minutes = (departures.time[slot] - departures.base) / 60;
+    uint16_t dest = crs_code(departures.dest[slot]);
+    
+    record[0] = minutes & 0xFF;
+    record[1] = minutes >> 8;
+    record[2] = dest & 0xFF;
+    record[3] = dest >> 8;
+    record[4] = departures.platform[slot];
+    record[5] = departures.flags[slot];
+}
+
+static void read_departures_header(const uint8_t *data) {
+    read_crs(current_origin, &data[2]);
+    read_crs(current_destination, &data[5]);
+    time_diff_s = (int32_t) read_uint32(&data[8]);
+    
+    // a new departure table replaces the old one; any records beyond its size are ignored
+    clear_departures();
+    departures.base = read_uint32(&data[12]);
+}
+
+static bool decode_departures(const uint8_t *data, uint16_t length) {
+    if (length < DEPARTURES_HEADER_SIZE || data[0] != PROTOCOL_VERSION) {
+        return false;
     }
     
-    text_layer_set_text(s_date_layer, date_buffer);
-    layer_mark_dirty(s_info_layer);
+    int count = data[1];
+    if (length < DEPARTURES_HEADER_SIZE + count * DEPARTURE_RECORD_SIZE) {
+        return false;
+    }
     
-//     // for testing UI
-//     can_update = true;
-//     train1_time = mktime(tick_time) - 1000;
-//     train2_time = mktime(tick_time) + 2000;
-//     train3_time = mktime(tick_time) + 4000;
-//     train1_platform = 14;
-    
-    if (can_update) {
-        if (train1_time != 0) {
-            int diff_min = (train1_time - now) / 60;
-            
-            // no updates for while - give up and remove train times
-            if (diff_min < MAX_DURATION_WITHOUT_UPDATE_MINUTES) {
-                text_layer_set_text(s_next_train_col1_layer, "");
-                text_layer_set_text(s_next_train_col2_layer, "");
-                text_layer_set_text(s_next_train_col3_layer, "");
-                return false;
-            }
-            
-            // train arrival imminent - try to get latest info
-            if (diff_min <= 0) {
-                need_train_update = true;
-            }
-            
-            snprintf(train1_time_buf, sizeof(train1_time_buf), "%d min\n", diff_min);
-            int str_next = strlen(train1_time_buf);
-            
-            struct tm *train1_time_tm = localtime(&train1_time);
-            if (clock_is_24h_style()) {
-                strftime(&train1_time_buf[str_next], sizeof(train1_time_buf) - str_next, "%H:%M\n", train1_time_tm);
-            }
-            else {
-                strftime(&train1_time_buf[str_next], sizeof(train1_time_buf) - str_next, "%l:%M\n", train1_time_tm);
-                
-                // remove initial space in 12 h format output
-                if (train1_time_buf[str_next] == ' ') {
-                    remove_char(&train1_time_buf[str_next], ' ');
-                }
-            }
-            
-            str_next = strlen(train1_time_buf);
-            if (train1_is_cancelled) {
-                snprintf(&train1_time_buf[str_next], sizeof(train1_time_buf) - str_next, "Cancelled");
-    #ifdef PBL_COLOR
-                text_layer_set_text_color(s_next_train_col1_layer, GColorDarkCandyAppleRed);
-    #else
-                text_layer_set_text_color(s_next_train_col1_layer, GColorWhite);
-    #endif
-            }
-            else {
-    #ifdef PBL_COLOR
-                text_layer_set_text_color(s_next_train_col1_layer, GColorWhite);
-    #endif
-                if (train1_platform > 0) {
-                    snprintf(&train1_time_buf[str_next], sizeof(train1_time_buf) - str_next, "%s to %s (%i)", current_origin, train1_dest, train1_platform);
-                }
-                else {
-                    snprintf(&train1_time_buf[str_next], sizeof(train1_time_buf) - str_next, "%s to %s", current_origin, train1_dest);
-                }
-            }
-            
-            text_layer_set_text(s_next_train_col1_layer, train1_time_buf);
+    read_departures_header(data);
+    for (int i = 0; i < count && i < MAX_DEPARTURE_RECORDS; i++) {
+        read_departure_record(i, &data[DEPARTURES_HEADER_SIZE + i * DEPARTURE_RECORD_SIZE]);
+        departures.count++;
+    }
+    
+    return true;
+}
+
+static bool decode_journeys(const uint8_t *data, uint16_t length) {
+    if (length < DEPARTURES_HEADER_SIZE || data[0] != PROTOCOL_VERSION) {
+        return false;
+    }
+    
+    int count = data[1];
+    if (length < DEPARTURES_HEADER_SIZE + count * JOURNEY_RECORD_SIZE) {
+        return false;
+    }
+    
+    // the journeys replace the departure table, with the first leg of each journey in its slot
+    read_departures_header(data);
+    departures.journeys = true;
+    for (int i = 0; i < count && i < MAX_JOURNEY_RECORDS; i++) {
+        const uint8_t *record = &data[DEPARTURES_HEADER_SIZE + i * JOURNEY_RECORD_SIZE];
+        read_departure_record(i, record);
+        departures.arrival[i] = departures.base + read_uint16(&record[DEPARTURE_RECORD_SIZE]) * 60;
+        departures.count++;
+    }
+    
+    return true;
+}
+
+static bool decode_service_details(const uint8_t *data, uint16_t length) {
+    if (length < SERVICE_DETAILS_SIZE || data[0] != PROTOCOL_VERSION) {
+        return false;
+    }
+    
+    next_service.time = read_uint32(&data[1]);
+    read_crs_code(next_service.dest, read_uint16(&data[5]));
+    next_service.arrival = next_service.time + read_uint16(&data[7]) * 60;
+    next_service.stops = data[9];
+    return true;
+}
+
+static bool decode_departure_updates(const uint8_t *data, uint16_t length) {
+    if (length < DEPARTURE_UPDATES_HEADER_SIZE || data[0] != PROTOCOL_VERSION) {
+        return false;
+    }
+    
+    int count = data[1];
+    if (length < DEPARTURE_UPDATES_HEADER_SIZE + count * DEPARTURE_UPDATE_RECORD_SIZE) {
+        return false;
+    }
+    
+    time_diff_s = (int32_t) read_uint32(&data[2]);
+    
+    // updates are only sent for a table of direct trains, whose slots may go beyond the journeys' arrival times
+    departures.journeys = false;
+    
+    // each record replaces one slot of the departure table, or adds a service in the next free slot
+    for (int i = 0; i < count; i++) {
+        const uint8_t *record = &data[DEPARTURE_UPDATES_HEADER_SIZE + i * DEPARTURE_UPDATE_RECORD_SIZE];
+        int slot = record[0];
+        
+        if (slot > departures.count || slot >= MAX_DEPARTURE_RECORDS) {
+            continue;
         }
-        else {
-            text_layer_set_text(s_next_train_col1_layer, "");
+        if (slot == departures.count) {
+            departures.count++;
         }
+        read_departure_record(slot, &record[1]);
         
-        if (train2_time != 0) {
-            int diff_min = (train2_time - now) / 60;
-//             APP_LOG(APP_LOG_LEVEL_ERROR, "train2_time, now, diff_min: %i, %i, %i", (int) train2_time, (int) now, diff_min);
-            if (train2_is_cancelled) {
-                snprintf(train2_time_buf, sizeof(train2_time_buf), "canc.\n");
-            }
-            else {
-                snprintf(train2_time_buf, sizeof(train2_time_buf), "%d min\n", diff_min);
-            }
-            int str_next = strlen(train2_time_buf);
-            
-            struct tm *train2_time_tm = localtime(&train2_time);
-            if (clock_is_24h_style()) {
-                strftime(&train2_time_buf[str_next], sizeof(train2_time_buf) - str_next, "%H:%M\n", train2_time_tm);
-            }
-            else {
-                strftime(&train2_time_buf[str_next], sizeof(train2_time_buf) - str_next, "%l:%M\n", train2_time_tm);
-                
-                // remove initial space in 12 h format output
-                if (train2_time_buf[str_next] == ' ') {
-                    remove_char(&train2_time_buf[str_next], ' ');
-                }
-            }
-            
-    #ifdef PBL_COLOR
-            if (train2_is_cancelled) {
-                text_layer_set_text_color(s_next_train_col2_layer, GColorDarkCandyAppleRed);
-            }
-            else {
-                text_layer_set_text_color(s_next_train_col2_layer, GColorWhite);
-            }
-    #endif
-            
-            text_layer_set_text(s_next_train_col2_layer, train2_time_buf);
+        // a delayed train that had been skipped as departed is due again
+        if (slot < departures.head) {
+            departures.head = slot;
         }
-        else {
-            text_layer_set_text(s_next_train_col2_layer, "");
+    }
+    
+    return true;
+}
+
+static bool decode_boards(const uint8_t *data, uint16_t length) {
+    if (length < BOARDS_HEADER_SIZE || data[0] != PROTOCOL_VERSION) {
+        return false;
+    }
+    
+    // check the whole payload before replacing the boards
+    int count = data[1];
+    int offset = BOARDS_HEADER_SIZE;
+    for (int i = 0; i < count; i++) {
+        if (length < offset + BOARD_HEADER_SIZE || length < offset + BOARD_HEADER_SIZE + data[offset + 6] * DEPARTURE_RECORD_SIZE) {
+            return false;
         }
+        offset += BOARD_HEADER_SIZE + data[offset + 6] * DEPARTURE_RECORD_SIZE;
+    }
+    
+    // keep showing the visible board if its route is still a board
+    char visible_origin[4] = "";
+    char visible_destination[4] = "";
+    if (visible_board > 0) {
+        strcpy(visible_origin, boards[visible_board - 1].origin);
+        strcpy(visible_destination, boards[visible_board - 1].destination);
+    }
+    visible_board = 0;
+    
+    time_t base = read_uint32(&data[2]);
+    board_count = 0;
+    offset = BOARDS_HEADER_SIZE;
+    for (int i = 0; i < count && i < MAX_BOARDS; i++) {
+        Board *board = &boards[i];
+        read_crs(board->origin, &data[offset]);
+        read_crs(board->destination, &data[offset + 3]);
+        int records = data[offset + 6];
+        offset += BOARD_HEADER_SIZE;
         
-        if (train3_time != 0) {
-            int diff_min = (train3_time - now) / 60;
-            if (train3_is_cancelled) {
-                snprintf(train3_time_buf, sizeof(train3_time_buf), "canc.\n");
-            }
-            else {
-                snprintf(train3_time_buf, sizeof(train3_time_buf), "%d min\n", diff_min);
-            }
-            int str_next = strlen(train3_time_buf);
-            
-            struct tm *train3_time_tm = localtime(&train3_time);
-            if (clock_is_24h_style()) {
-                strftime(&train3_time_buf[str_next], sizeof(train3_time_buf) - str_next, "%H:%M\n", train3_time_tm);
-            }
-            else {
-                strftime(&train3_time_buf[str_next], sizeof(train3_time_buf) - str_next, "%l:%M\n", train3_time_tm);
-                
-                // remove initial space in 12 h format output
-                if (train3_time_buf[str_next] == ' ') {
-                    remove_char(&train3_time_buf[str_next], ' ');
-                }
-            }
-            
-    #ifdef PBL_COLOR
-            if (train3_is_cancelled) {
-                text_layer_set_text_color(s_next_train_col3_layer, GColorDarkCandyAppleRed);
-            }
-            else {
-                text_layer_set_text_color(s_next_train_col3_layer, GColorWhite);
-            }
-    #endif
-            
-            text_layer_set_text(s_next_train_col3_layer, train3_time_buf);
+        board->count = 0;
+        for (int j = 0; j < records && j < MAX_BOARD_RECORDS; j++) {
+            const uint8_t *record = &data[offset + j * DEPARTURE_RECORD_SIZE];
+            read_train_record(record, base, &board->time[j], board->dest[j], &board->platform[j], &board->flags[j]);
+            board->count++;
         }
-        else {
-            text_layer_set_text(s_next_train_col3_layer, "");
+        offset += records * DEPARTURE_RECORD_SIZE;
+        board_count++;
+        
+        if (strcmp(board->origin, visible_origin) == 0 && strcmp(board->destination, visible_destination) == 0) {
+            visible_board = i + 1;
         }
     }
+    
+    return true;
+}
+
+static bool decode_config(const uint8_t *data, uint16_t length) {
+    if (length < CONFIG_RECORD_SIZE || data[0] != PROTOCOL_VERSION) {
+        return false;
+    }
+    
+    config_generation = data[1] | (data[2] << 8);
+    
+    uint8_t flags = data[3];
+    use_customised_days = (flags & CONFIG_FLAG_CUSTOMISED_DAYS) != 0;
+    use_customised_times = (flags & CONFIG_FLAG_CUSTOMISED_TIMES) != 0;
+    update_only_on_tap = (flags & CONFIG_FLAG_UPDATE_ONLY_ON_TAP) != 0;
+    use_learned_times = (flags & CONFIG_FLAG_LEARNED_TIMES) != 0;
+    
+    for (int i = 0; i < 7; i++) {
+        customised_days_array[i] = (data[4] >> i) & 0x01;
+    }
+    
+    if (use_customised_times) {
+        MORNING_UPDATES_START_HOUR = data[5];
+        MORNING_UPDATES_END_HOUR = data[6];
+        AFTERNOON_UPDATES_START_HOUR = data[7];
+        AFTERNOON_UPDATES_END_HOUR = data[8];
+    }
     else {
-        text_layer_set_text(s_next_train_col1_layer, "");
-        text_layer_set_text(s_next_train_col2_layer, "");
-        text_layer_set_text(s_next_train_col3_layer, "");
+        // reset update times to defaults
+        MORNING_UPDATES_START_HOUR = DEFAULT_MORNING_UPDATES_START_HOUR;
+        MORNING_UPDATES_END_HOUR = DEFAULT_MORNING_UPDATES_END_HOUR;
+        AFTERNOON_UPDATES_START_HOUR = DEFAULT_AFTERNOON_UPDATES_START_HOUR;
+        AFTERNOON_UPDATES_END_HOUR = DEFAULT_AFTERNOON_UPDATES_END_HOUR;
+    }
+    
+    return true;
+}
+
+static void save_persist_data() {
+    PersistSnapshot snapshot = {
+        .version = SNAPSHOT_VERSION,
+        .time_diff_s = time_diff_s,
+        .last_update = last_update,
+        .departure_base = departures.base,
+        .departure_head = departures.head,
+        .departure_count = departures.count,
+        .departure_journeys = departures.journeys
+    };
+    
+    memcpy(snapshot.current_origin, current_origin, sizeof(snapshot.current_origin));
+    memcpy(snapshot.current_destination, current_destination, sizeof(snapshot.current_destination));
+    for (int slot = 0; slot < departures.count; slot++) {
+        write_departure_record(slot, &snapshot.departures[slot * DEPARTURE_RECORD_SIZE]);
+    }
+    for (int slot = 0; departures.journeys && slot < departures.count; slot++) {
+        snapshot.arrivals[slot] = (departures.arrival[slot] - departures.base) / 60;
+    }
+    
+    persist_write_data(PERSIST_KEY_SNAPSHOT, &snapshot, sizeof(snapshot));
+}
+
+static void get_persist_data() {
+    // the config is stored separately, as it is only sent by the phone when it changes
+    uint8_t config[CONFIG_RECORD_SIZE];
+    if (persist_exists(PERSIST_KEY_CONFIG)) {
+        int length = persist_read_data(PERSIST_KEY_CONFIG, config, sizeof(config));
+        if (length > 0) {
+            decode_config(config, length);
+        }
+    }
+    
+    uint8_t boards_data[MAX_BOARDS_SIZE];
+    if (persist_exists(PERSIST_KEY_BOARDS)) {
+        int length = persist_read_data(PERSIST_KEY_BOARDS, boards_data, sizeof(boards_data));
+        if (length > 0) {
+            decode_boards(boards_data, length);
+        }
+    }
+    
+    PersistSnapshot snapshot;
+    
+    if (!persist_exists(PERSIST_KEY_SNAPSHOT) ||
+            persist_read_data(PERSIST_KEY_SNAPSHOT, &snapshot, sizeof(snapshot)) != sizeof(snapshot) ||
+            snapshot.version != SNAPSHOT_VERSION) {
+        return;
+    }
+    
+    snprintf(current_origin, sizeof(current_origin), "%.3s", snapshot.current_origin);
+    snprintf(current_destination, sizeof(current_destination), "%.3s", snapshot.current_destination);
+    clear_departures();
+    departures.base = snapshot.departure_base;
+    for (int slot = 0; slot < snapshot.departure_count && slot < MAX_DEPARTURE_RECORDS; slot++) {
+        read_departure_record(slot, &snapshot.departures[slot * DEPARTURE_RECORD_SIZE]);
+        departures.count++;
+    }
+    departures.head = snapshot.departure_head < departures.count ? snapshot.departure_head : departures.count;
+    departures.journeys = snapshot.departure_journeys && departures.count <= MAX_JOURNEY_RECORDS;
+    for (int slot = 0; departures.journeys && slot < departures.count; slot++) {
+        departures.arrival[slot] = departures.base + snapshot.arrivals[slot] * 60;
+    }
+    
+    time_diff_s = snapshot.time_diff_s;
+    last_update = snapshot.last_update;
+    
+    // in tap-only mode, train times are only shown briefly after each tap
+    if (update_only_on_tap) {
+        clear_departures();
+    }
+    
+    drop_departed_trains(time(NULL));
+}
+
+// draws the time, date and battery level, which are all that is shown in the low-power state
+static void update_clock(struct tm *tick_time) {
+    int minute = tick_time->tm_hour * 60 + tick_time->tm_min;
+    if (minute != rendered_minute) {
+        rendered_minute = minute;
         
-        return can_update;
+        static char time_buffer[] = "00:00";
+        clock_copy_time_string(time_buffer, sizeof(time_buffer));
+        text_layer_set_text(s_time_layer, time_buffer);
+        stats_layer_redrawn(STATS_LAYER_TIME);
     }
     
-    return need_train_update;
+    if (tick_time->tm_yday != rendered_day) {
+        rendered_day = tick_time->tm_yday;
+        
+        static char date_buffer[] = "Wednesday\n30 September";                // create maximum sized date buffer
+        strftime(date_buffer, sizeof(date_buffer), "%A\n%e %B", tick_time);   // comment-out this line to test max string length
+                    
+        // remove initial ' ' in date format output i.e. if ' ' follows '\n'
+        char *quotPtr = strchr(date_buffer, '\n');
+        if (quotPtr != NULL) {
+            int position = quotPtr - date_buffer;
+            if (date_buffer[position + 1] == ' ') {
+                remove_char(date_buffer, ' ');
+            }
+        }
+        
+        text_layer_set_text(s_date_layer, date_buffer);
+        stats_layer_redrawn(STATS_LAYER_DATE);
+    }
+    
+    int level = battery_level(battery_state_service_peek().charge_percent);
+    if (level != rendered_battery_level) {
+        rendered_battery_level = level;
+        layer_mark_dirty(s_info_layer);
+    }
+}
+
+static void update_UI(struct tm *tick_time) {
+//     APP_LOG(APP_LOG_LEVEL_DEBUG, "update_UI()");
+    bool can_update = !low_power && is_train_update_period();
+    
+    // current time with seconds set to zero to ensure consistent display
+    time_t now = time(NULL);
+    now -= now % 60;
+    
+    update_clock(tick_time);
+    
+//     // for testing UI
+//     can_update = true;
+//     departures.time[0] = mktime(tick_time) - 1000;
+//     departures.time[1] = mktime(tick_time) + 2000;
+//     departures.time[2] = mktime(tick_time) + 4000;
+//     departures.platform[0] = 14;
+    
+    // no updates for while - give up and remove train times; last_update is 0 if only stale data have been received
+    time_t data_age = last_update != 0 ? now - last_update : 0;
+    if (data_age >= MAX_DATA_AGE_SECONDS) {
+        can_update = false;
+    }
+    
+    BoardView view = get_board_view(visible_board);
+    int slots[MAX_DISPLAYED_TRAINS];
+    int train_count = can_update ? next_departures(&view, now, slots, MAX_DISPLAYED_TRAINS) : 0;
+    
+    // show the age of the train times once they are likely to be out of date
+    int age = train_count > 0 && data_age >= STALE_DATA_AGE_SECONDS ? data_age / 60 : -1;
+    if (age != rendered_data_age) {
+        rendered_data_age = age;
+        layer_mark_dirty(s_info_layer);
+    }
+    
+    bool trains_changed = false;
+    bool details_shown = false;
+    for (int i = 0; i < MAX_DISPLAYED_TRAINS; i++) {
+        TrainDisplay *display = &displayed_trains[i];
+        
+        // the next train's service details are wider than its column, so they take the following trains' place
+        if (i >= train_count || details_shown) {
+            trains_changed |= clear_train_display(display);
+            continue;
+        }
+        
+        // only the destination and platform of the next train are displayed
+        int slot = slots[i];
+        int diff_min = (view.time[slot] - now) / 60;
+        int is_cancelled = (view.flags[slot] & TRAIN_FLAG_CANCELLED) != 0;
+        int platform = i == 0 ? view.platform[slot] : 0;
+        time_t arrival = i == 0 && view.arrival != NULL ? view.arrival[slot] : 0;
+        int stops = -1;
+        
+        // the details of the next train on the departure table are matched by departure time and destination, as
+        // they may have been sent for a train that has since departed
+        if (i == 0 && visible_board == 0 && view.arrival == NULL && (view.flags[slot] & TRAIN_FLAG_DELAYED) == 0 &&
+                next_service.time == view.time[slot] && strcmp(next_service.dest, view.dest[slot]) == 0) {
+            arrival = next_service.arrival;
+            stops = next_service.stops;
+            details_shown = !is_cancelled;
+        }
+        if (train_render_changed(display, view.time[slot], diff_min, is_cancelled, platform, arrival, stops)) {
+            format_train(display, i == 0, view.origin, view.dest[slot]);
+            trains_changed = true;
+        }
+    }
+    
+    if (trains_changed) {
+        layer_mark_dirty(s_trains_layer);
+    }
+}
+
+static void trains_layer_update_callback(Layer *layer, GContext *ctx) {
+    stats_layer_redrawn(STATS_LAYER_TRAINS);
+    
+    for (int i = 0; i < MAX_DISPLAYED_TRAINS; i++) {
+        TrainDisplay *display = &displayed_trains[i];
+        if (!display->shown) {
+            continue;
+        }
+        
+#ifdef PBL_COLOR
+        graphics_context_set_text_color(ctx, display->is_cancelled ? GColorDarkCandyAppleRed : GColorWhite);
+#else
+        graphics_context_set_text_color(ctx, GColorWhite);
+#endif
+        graphics_draw_text(ctx, display->text, i == 0 ? s_train1_font : s_train_font, train_rects[i],
+                           GTextOverflowModeWordWrap, GTextAlignmentLeft, NULL);
+    }
 }
 
 static void info_layer_update_callback(Layer *layer, GContext *ctx) {
+    stats_layer_redrawn(STATS_LAYER_INFO);
+    
     BatteryChargeState chargeState = battery_state_service_peek();
     uint8_t percent = chargeState.charge_percent;
     
@@ -398,24 +1062,54 @@ static void info_layer_update_callback(Layer *layer, GContext *ctx) {
         graphics_fill_circle(ctx, GPoint(BATTERY_INDICATOR_X, BATTERY_INDICATOR_Y), BATTERY_INDICATOR_RADIUS);
     }
     
+    // the clock and train status are only relevant in update periods
+    if (low_power) {
+        return;
+    }
+    
     if (abs(time_diff_s) >= 30) {
+        char time_diff_buf[sizeof("-2147483648")];
         snprintf(time_diff_buf, sizeof(time_diff_buf), "%i", time_diff_s);
-        text_layer_set_text(s_time_diff_layer, time_diff_buf);
+        graphics_context_set_text_color(ctx, GColorWhite);
+        graphics_draw_text(ctx, time_diff_buf, s_time_diff_font, GRect(TIME_DIFF_X, 0, 144 - TIME_DIFF_X, 16),
+                           GTextOverflowModeWordWrap, GTextAlignmentLeft, NULL);
     }
-    else {
-        text_layer_set_text(s_time_diff_layer, "");
+    
+    if (rendered_data_age >= 0) {
+        char data_age_buf[sizeof("-2147483648 min old")];
+        if (rendered_data_age < 60) {
+            snprintf(data_age_buf, sizeof(data_age_buf), "%d min old", rendered_data_age);
+        }
+        else {
+            snprintf(data_age_buf, sizeof(data_age_buf), "%d h old", rendered_data_age / 60);
+        }
+        graphics_context_set_text_color(ctx, GColorWhite);
+        graphics_draw_text(ctx, data_age_buf, s_time_diff_font, GRect(0, 0, BATTERY_INDICATOR_X - 2 * BATTERY_INDICATOR_RADIUS, 16),
+                           GTextOverflowModeWordWrap, GTextAlignmentRight, NULL);
     }
     
-    if (last_request_failed == 1) {
+    // filled square: the last request failed; outline: requests suspended after repeated failures
+    if (last_request_failed != 0) {
+//         GRect rect = GRect(0, 0, NETWORK_INDICATOR_X, NETWORK_INDICATOR_Y);
+        GRect rect = GRect(3, 3, 6, 6);
+        
+        if (scheduler_circuit_state(time(NULL)) == SCHEDULER_CIRCUIT_OPEN) {
 #ifdef PBL_COLOR
-        graphics_context_set_fill_color(ctx, GColorDarkCandyAppleRed);
+            graphics_context_set_stroke_color(ctx, GColorDarkCandyAppleRed);
 #else
-        graphics_context_set_fill_color(ctx, GColorWhite);
+            graphics_context_set_stroke_color(ctx, GColorWhite);
 #endif
-//         GRect rect = GRect(0, 0, NETWORK_INDICATOR_X, NETWORK_INDICATOR_Y);
-        GRect rect = GRect(3, 3, 6, 6);
-//         graphics_draw_round_rect(ctx, rect, 1);//NETWORK_INDICATOR_RADIUS);
-        graphics_fill_rect(ctx, rect, 0, GCornerNone);//NETWORK_INDICATOR_RADIUS);
+            graphics_draw_rect(ctx, rect);
+        }
+        else {
+#ifdef PBL_COLOR
+            graphics_context_set_fill_color(ctx, GColorDarkCandyAppleRed);
+#else
+            graphics_context_set_fill_color(ctx, GColorWhite);
+#endif
+//             graphics_draw_round_rect(ctx, rect, 1);//NETWORK_INDICATOR_RADIUS);
+            graphics_fill_rect(ctx, rect, 0, GCornerNone);//NETWORK_INDICATOR_RADIUS);
+        }
     }
 }
 
@@ -443,94 +1137,71 @@ static void main_window_load(Window *window) {
     text_layer_set_text_alignment(s_date_layer, GTextAlignmentCenter);
     layer_add_child(window_get_root_layer(window), text_layer_get_layer(s_date_layer));
     
-    // create train info layers
-    s_next_train_col1_layer = text_layer_create(GRect(TRAIN_TIMES_X_OFFSET, TRAIN_TIMES_Y_OFFSET, 144 - TRAIN_TIMES_X_OFFSET, 60));
-    text_layer_set_background_color(s_next_train_col1_layer, GColorClear);
-    text_layer_set_text_color(s_next_train_col1_layer, GColorWhite);
-    text_layer_set_font(s_next_train_col1_layer, fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD));
-    text_layer_set_text_alignment(s_next_train_col1_layer, GTextAlignmentLeft);
-//     text_layer_set_text(s_next_train_col1_layer, "one\ntwo\nthree three three");
-    layer_add_child(window_get_root_layer(window), text_layer_get_layer(s_next_train_col1_layer));
-    
-    s_next_train_col2_layer = text_layer_create(GRect(48 + 6 + TRAIN_TIMES_X_OFFSET, TRAIN_TIMES_Y_OFFSET, 43, 40));
-    text_layer_set_background_color(s_next_train_col2_layer, GColorClear);
-    text_layer_set_text_color(s_next_train_col2_layer, GColorWhite);
-    text_layer_set_font(s_next_train_col2_layer, fonts_get_system_font(FONT_KEY_GOTHIC_18));
-    text_layer_set_text_alignment(s_next_train_col2_layer, GTextAlignmentLeft);
-//     text_layer_set_text(s_next_train_col2_layer, "one\ntwo");
-    layer_add_child(window_get_root_layer(window), text_layer_get_layer(s_next_train_col2_layer));
-    
-    s_next_train_col3_layer = text_layer_create(GRect(96 + 1 + TRAIN_TIMES_X_OFFSET, TRAIN_TIMES_Y_OFFSET, 46, 40));
-    text_layer_set_background_color(s_next_train_col3_layer, GColorClear);
-    text_layer_set_text_color(s_next_train_col3_layer, GColorWhite);
-    text_layer_set_font(s_next_train_col3_layer, fonts_get_system_font(FONT_KEY_GOTHIC_18));
-    text_layer_set_text_alignment(s_next_train_col3_layer, GTextAlignmentLeft);
-//     text_layer_set_text(s_next_train_col3_layer, "one\ntwo");
-    layer_add_child(window_get_root_layer(window), text_layer_get_layer(s_next_train_col3_layer));
-    
-    // create battery info layer
+    // create train info layer, which draws all trains
+    s_train1_font = fonts_get_system_font(FONT_KEY_GOTHIC_18_BOLD);
+    s_train_font = fonts_get_system_font(FONT_KEY_GOTHIC_18);
+    s_time_diff_font = fonts_get_system_font(FONT_KEY_GOTHIC_09);
+    
+    s_trains_layer = layer_create(GRect(0, TRAIN_TIMES_Y_OFFSET, 144, 168 - TRAIN_TIMES_Y_OFFSET));
+    layer_set_update_proc(s_trains_layer, trains_layer_update_callback);
+    layer_add_child(window_get_root_layer(window), s_trains_layer);
+    
+    train_rects[0] = GRect(TRAIN_TIMES_X_OFFSET, 0, 144 - TRAIN_TIMES_X_OFFSET, TRAIN1_HEIGHT);
+    int column_x = TRAIN1_COLUMN_WIDTH + TRAIN_TIMES_X_OFFSET;
+    int column_width = MAX_DISPLAYED_TRAINS > 1 ? (144 - column_x) / (MAX_DISPLAYED_TRAINS - 1) : 0;
+    for (int i = 1; i < MAX_DISPLAYED_TRAINS; i++) {
+        train_rects[i] = GRect(column_x + (i - 1) * column_width, 0, column_width, TRAIN_HEIGHT);
+    }
+    
+    // create battery and time info layer
     s_info_layer = layer_create(GRect(0, 0, 144, 16));
 //     layer_set_background_color(s_info_layer, GColorClear);
     layer_set_update_proc(s_info_layer, info_layer_update_callback);
     layer_add_child(window_get_root_layer(window), s_info_layer);
     
-    // create time info layer
-    s_time_diff_layer = text_layer_create(GRect(3, 0, 144, 16));
-    text_layer_set_background_color(s_time_diff_layer, GColorClear);
-    text_layer_set_text_color(s_time_diff_layer, GColorWhite);
-    text_layer_set_font(s_time_diff_layer, fonts_get_system_font(FONT_KEY_GOTHIC_09));
-    text_layer_set_text_alignment(s_time_diff_layer, GTextAlignmentLeft);
-    layer_add_child(s_info_layer, text_layer_get_layer(s_time_diff_layer));
-    
     // make sure the time is displayed from the start
+    rendered_minute = -1;
+    rendered_day = -1;
+    rendered_battery_level = -1;
+    rendered_data_age = -1;
+    invalidate_train_render_cache();
     time_t temp = time(NULL); 
     struct tm *tick_time = localtime(&temp);
     update_UI(tick_time);
     
-    // schedule an update of train times after initialisation
-    app_timer_register(INITIAL_UPDATE_DELAY_MILLISECONDS, initial_update, NULL);
+    // schedule an update of train times after initialisation; restored data count as the last update
+    reschedule_train_updates();
 }
 
 static void main_window_unload(Window *window) {
     // destroy TextLayers
     text_layer_destroy(s_time_layer);
     text_layer_destroy(s_date_layer);
-    text_layer_destroy(s_next_train_col1_layer);
-    text_layer_destroy(s_next_train_col2_layer);
-    text_layer_destroy(s_next_train_col3_layer);
-    text_layer_destroy(s_time_diff_layer);
+    layer_destroy(s_trains_layer);
     layer_destroy(s_info_layer);
 }
 
-static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
-//     APP_LOG(APP_LOG_LEVEL_DEBUG, "in tick_handler()");
-    
-//     if (update_only_on_tap) {
-// //         APP_LOG(APP_LOG_LEVEL_DEBUG, "reseting train times");
-// //         minute_rollovers_since_last_update++;
-        
-// //         if (minute_rollovers_since_last_update >= MINUTE_ROLLOVER_THRESHOLD) {
-// //             minute_rollovers_since_last_update = 0;
-//             train1_time = 0;
-//             train2_time = 0;
-//             train3_time = 0;
-// //       }
-//     }
+static void reconnect_update() {
+    reconnect_update_timer = NULL;
     
-    bool need_train_update = update_UI(tick_time);
-    
-    if (!update_only_on_tap) {
-//         APP_LOG(APP_LOG_LEVEL_DEBUG, "requesting update");
-       if (need_train_update || (tick_time->tm_sec == 0 && tick_time->tm_min % TRAIN_UPDATE_PERIOD_MINUTES == 0)) {
-            // get update when requested (for imminent trains) and periodically; ensure additional requests are made once per minute at most
-            request_trains_update();
-       }
+    // catch up on anything missed while disconnected, rather than waiting for the next scheduled update; in tap-only
+    // mode, trains are only shown after a tap
+    if (!update_only_on_tap && time(NULL) - last_update >= RECONNECT_UPDATE_MIN_AGE_SECONDS) {
+        request_trains_update();
+        reschedule_train_updates();
     }
 }
 
 void bluetooth_connection_callback(bool connected) {
     vibes_long_pulse();
     
+    if (connected) {
+        if (reconnect_update_timer != NULL) {
+            app_timer_cancel(reconnect_update_timer);
+        }
+        reconnect_update_timer = app_timer_register(RECONNECT_UPDATE_DELAY_MILLISECONDS, reconnect_update, NULL);
+    }
+    
 #ifdef PBL_COLOR
     if (connected) {
         window_set_background_color(s_main_window, GColorBlack);
@@ -541,106 +1212,65 @@ void bluetooth_connection_callback(bool connected) {
 #endif
 }
 
+static void send_stats() {
+    const uint8_t *stats;
+    size_t length = stats_get(&stats);
+    
+    // the stats are only for debugging, so they are not retried if the outbox is busy
+    DictionaryIterator *iter;
+    if (app_message_outbox_begin(&iter) == APP_MSG_OK) {
+        dict_write_data(iter, KEY_STATS, stats, length);
+        app_message_outbox_send();
+    }
+}
+
+static void reconfigure_low_power();
+
 static void inbox_received_callback(DictionaryIterator *iterator, void *context) {
+    bool departures_received = false;
+    bool config_received = false;
+    bool stats_requested = false;
+    bool request_result_received = false;
+    uint32_t retry_after = 0;
+    
     // read first item
     Tuple *t = dict_read_first(iterator);
 
     // for all items
     while(t != NULL) {
         switch(t->key) {
-            case KEY_UPDATE:
-                break;
-            case KEY_CURRENT_ORIGIN:
-                snprintf(current_origin, sizeof(current_origin), "%s", t->value->cstring);
-                break;
-            case KEY_CURRENT_DESTINATION:
-                snprintf(current_destination, sizeof(current_destination), "%s", t->value->cstring);
-                break;
-            case KEY_TRAIN1_TIME:
-                train1_time = t->value->int32;
-                break;
-            case KEY_TRAIN1_DEST:
-                snprintf(train1_dest, sizeof(train1_dest), "%s", t->value->cstring);
-                break;
-            case KEY_TRAIN1_PLATFORM:
-//                 APP_LOG(APP_LOG_LEVEL_DEBUG, "KEY_TRAIN1_PLATFORM: len: %d, %d, %s", t->length, t->value->int16, t->value->cstring);
-                train1_platform = t->value->int32;
-                break;
-            case KEY_TRAIN2_TIME:
-                train2_time = t->value->int32;
-                break;
-            case KEY_TRAIN3_TIME:
-                train3_time = t->value->int32;
-                break;
-            case KEY_TRAIN1_IS_CANCELED:
-                train1_is_cancelled = t->value->int16;
-                break;
-            case CUSTOMISED_DAYS:
-//                 use_customised_days = (strcmp(t->value->cstring, "true") == 0);
-//                 APP_LOG(APP_LOG_LEVEL_DEBUG, "CUSTOMISED_DAYS: len: %d, %d, %s", t->length, t->value->int16, t->value->cstring);
-                use_customised_days = t->value->int16;
-                break;
-            case USE_MONDAY:
-//                 customised_days_array[1] = (strcmp(t->value->cstring, "true") == 0);
-                customised_days_array[1] = t->value->int16;
-                break;
-            case USE_TUESDAY:
-//                 customised_days_array[2] = (strcmp(t->value->cstring, "true") == 0);
-                customised_days_array[2] = t->value->int16;
-                break;
-            case USE_WEDNESDAY:
-//                 customised_days_array[3] = (strcmp(t->value->cstring, "true") == 0);
-                customised_days_array[3] = t->value->int16;
-                break;
-            case USE_THURSDAY:
-//                 customised_days_array[4] = (strcmp(t->value->cstring, "true") == 0);
-                customised_days_array[4] = t->value->int16;
+            case KEY_DEPARTURES:
+                departures_received = decode_departures(t->value->data, t->length);
                 break;
-            case USE_FRIDAY:
-//                 customised_days_array[5] = (strcmp(t->value->cstring, "true") == 0);
-//                 APP_LOG(APP_LOG_LEVEL_DEBUG, "USE_FRIDAY: len: %d, %d, %s", t->length, t->value->int16, t->value->cstring);
-                customised_days_array[5] = t->value->int16;
+            case KEY_JOURNEYS:
+                departures_received = decode_journeys(t->value->data, t->length);
                 break;
-            case USE_SATURDAY:
-//                 customised_days_array[6] = (strcmp(t->value->cstring, "true") == 0);
-//                 APP_LOG(APP_LOG_LEVEL_DEBUG, "USE_SATURDAY: len: %d, %d, %s", t->length, t->value->int16, t->value->cstring);
-                customised_days_array[6] = t->value->int16;
+            case KEY_NEXT_SERVICE_DETAILS:
+                decode_service_details(t->value->data, t->length);
                 break;
-            case USE_SUNDAY:
-//                 customised_days_array[0] = (strcmp(t->value->cstring, "true") == 0);
-                customised_days_array[0] = t->value->int16;
+            case KEY_DEPARTURE_UPDATES:
+                departures_received = decode_departure_updates(t->value->data, t->length);
                 break;
-            case CUSTOMISED_TIMES:
-//                 use_customised_times = (strcmp(t->value->cstring, "true") == 0);
-                use_customised_times = t->value->int16;
-                break;
-            case MORNING_START:
-                MORNING_UPDATES_START_HOUR = t->value->int32;
-                break;
-            case MORNING_END:
-//                 APP_LOG(APP_LOG_LEVEL_DEBUG, "MORNING_UPDATES_END_HOUR: len: %d, %d, %d, %s", t->length, t->value->int16, (int) t->value->int32, t->value->cstring);
-                MORNING_UPDATES_END_HOUR = t->value->int32;
-                break;
-            case AFTERNOON_START:
-                AFTERNOON_UPDATES_START_HOUR = t->value->int32;
-                break;
-            case AFTERNOON_END:
-                AFTERNOON_UPDATES_END_HOUR = t->value->int32;
-                break;
-            case KEY_TRAIN2_IS_CANCELED:
-                train2_is_cancelled = t->value->int16;
-                break;
-            case KEY_TRAIN3_IS_CANCELED:
-                train3_is_cancelled = t->value->int16;
+            case KEY_BOARDS:
+                if (decode_boards(t->value->data, t->length)) {
+                    persist_write_data(PERSIST_KEY_BOARDS, t->value->data, t->length < MAX_BOARDS_SIZE ? t->length : MAX_BOARDS_SIZE);
+                }
                 break;
-            case TIME_DIFF_FROM_UTC:
-                time_diff_s = t->value->int32 / 1000;
+            case KEY_CONFIG:
+                if (decode_config(t->value->data, t->length)) {
+                    persist_write_data(PERSIST_KEY_CONFIG, t->value->data, CONFIG_RECORD_SIZE);
+                    config_received = true;
+                }
                 break;
             case KEY_LAST_REQUEST_FAILED:
-                last_request_failed = t->value->int16;
+                last_request_failed = t->value->int32;
+                request_result_received = true;
                 break;
-            case KEY_UPDATE_ONLY_ON_TAP:
-                update_only_on_tap = t->value->int16;
+            case KEY_RETRY_AFTER:
+                retry_after = t->value->int32 > 0 ? t->value->int32 : 0;
+                break;
+            case KEY_STATS:
+                stats_requested = true;
                 break;
             default:
                 break;
@@ -650,44 +1280,177 @@ static void inbox_received_callback(DictionaryIterator *iterator, void *context)
         t = dict_read_next(iterator);
     }
     
-//     APP_LOG(APP_LOG_LEVEL_ERROR, "%i, %i, %i, %i, %i, %i, %i", customised_days_array[0], customised_days_array[1], customised_days_array[2], customised_days_array[3], customised_days_array[4], customised_days_array[5], customised_days_array[6]);
-//     APP_LOG(APP_LOG_LEVEL_ERROR, "before: %i, %i, %i, %i, %i", use_customised_times, MORNING_UPDATES_START_HOUR, MORNING_UPDATES_END_HOUR, AFTERNOON_UPDATES_START_HOUR, AFTERNOON_UPDATES_END_HOUR);
+    time_t now = time(NULL);
     
-    // reset update times to defaults
-    if (!use_customised_times) {
-        MORNING_UPDATES_START_HOUR = DEFAULT_MORNING_UPDATES_START_HOUR;
-        MORNING_UPDATES_END_HOUR = DEFAULT_MORNING_UPDATES_END_HOUR;
-        AFTERNOON_UPDATES_START_HOUR = DEFAULT_AFTERNOON_UPDATES_START_HOUR;
-        AFTERNOON_UPDATES_END_HOUR = DEFAULT_AFTERNOON_UPDATES_END_HOUR;
+    if (departures_received) {
+        drop_departed_trains(now);
+        
+        // after a failed request, the phone may still send its last good departures, which are not new
+        if (last_request_failed == 0) {
+            last_update = now;
+        }
+        save_persist_data();
     }
     
-//     APP_LOG(APP_LOG_LEVEL_ERROR, "after: %i, %i, %i, %i, %i", use_customised_times, MORNING_UPDATES_START_HOUR, MORNING_UPDATES_END_HOUR, AFTERNOON_UPDATES_START_HOUR, AFTERNOON_UPDATES_END_HOUR);
+    if (request_result_received) {
+        scheduler_response_received(now, last_request_failed != 0, retry_after);
+        stats_response_received();
+    }
+    
+    if (stats_requested) {
+        send_stats();
+    }
     
-    // update display
-    last_update = time(NULL);
-    struct tm *tick_time = localtime(&last_update);
+    // update display; new data may change the route text and info layer without changing the train times
+    invalidate_train_render_cache();
+    layer_mark_dirty(s_info_layer);
+    struct tm *tick_time = localtime(&now);
     update_UI(tick_time);
+    
+    reschedule_train_updates();
+    if (config_received) {
+        reconfigure_low_power();
+    }
 }
 
 static void inbox_dropped_callback(AppMessageResult reason, void *context) {
 //     APP_LOG(APP_LOG_LEVEL_ERROR, "Message dropped!");
+    stats_message_dropped(reason);
 }
 
 static void outbox_failed_callback(DictionaryIterator *iterator, AppMessageResult reason, void *context) {
 //     APP_LOG(APP_LOG_LEVEL_ERROR, "Outbox send failed!");
+    stats_message_failed(reason);
+    if (dict_find(iterator, KEY_UPDATE) != NULL) {
+        scheduler_request_not_delivered(time(NULL));
+    }
 }
 
 static void outbox_sent_callback(DictionaryIterator *iterator, void *context) {
 //     APP_LOG(APP_LOG_LEVEL_INFO, "Outbox send success!");
+    stats_message_sent();
+}
+
+static void open_app_message() {
+    // there is no way to close AppMessage, so it is opened once, at launch; a config change must reach the watch
+    // outside the update periods too
+    
+    // register callbacks for AppMessage
+    app_message_register_inbox_received(inbox_received_callback);
+    app_message_register_inbox_dropped(inbox_dropped_callback);
+    app_message_register_outbox_failed(outbox_failed_callback);
+    app_message_register_outbox_sent(outbox_sent_callback);
+
+    // open AppMessage, with buffers sized for the largest expected messages
+    uint32_t inbox_size = dict_calc_buffer_size(8, DEPARTURES_HEADER_SIZE + MAX_DEPARTURE_RECORDS * DEPARTURE_RECORD_SIZE,
+                                                DEPARTURES_HEADER_SIZE + MAX_JOURNEY_RECORDS * JOURNEY_RECORD_SIZE,
+                                                SERVICE_DETAILS_SIZE,
+                                                DEPARTURE_UPDATES_HEADER_SIZE + MAX_DEPARTURE_UPDATE_RECORDS * DEPARTURE_UPDATE_RECORD_SIZE,
+                                                MAX_BOARDS_SIZE, CONFIG_RECORD_SIZE, sizeof(int32_t), sizeof(int32_t));
+    const uint8_t *stats;
+    uint32_t outbox_size = dict_calc_buffer_size(2, sizeof(uint8_t), sizeof(uint16_t));
+    uint32_t stats_size = dict_calc_buffer_size(1, stats_get(&stats));
+    if (stats_size > outbox_size) {
+        outbox_size = stats_size;
+    }
+    app_message_open(inbox_size, outbox_size);
+}
+
+static void tap_handler(AccelAxisType axis, int32_t direction);
+
+static void leave_low_power() {
+    if (low_power_timer != NULL) {
+        app_timer_cancel(low_power_timer);
+        low_power_timer = NULL;
+    }
+    
+    low_power = false;
+    accel_tap_service_subscribe(tap_handler);
+    
+    // a single refresh: the request is sent before the schedule is recalculated, so the scheduler does not repeat it
+    request_trains_update();
+    reschedule_train_updates();
+    
+    invalidate_train_render_cache();
+    layer_mark_dirty(s_info_layer);
+    time_t now = time(NULL);
+    struct tm *tick_time = localtime(&now);
+    update_UI(tick_time);
+}
+
+static void low_power_timer_callback() {
+    low_power_timer = NULL;
+    
+    // if the update period has moved, e.g. with the clock, the next tick returns to the low-power state
+    leave_low_power();
+}
+
+// waits for the next update period, or for a tap that may start one
+static void arm_low_power() {
+    if (low_power_timer != NULL) {
+        app_timer_cancel(low_power_timer);
+        low_power_timer = NULL;
+    }
+    
+    // with learned update times, a tap outside an update period may start one
+    if (use_learned_times) {
+        accel_tap_service_subscribe(tap_handler);
+    }
+    else {
+        accel_tap_service_unsubscribe();
+    }
+    
+    time_t now = time(NULL);
+    time_t next_period = next_train_update_period_change(now);
+    if (next_period != 0) {
+        low_power_timer = app_timer_register((next_period - now) * 1000, low_power_timer_callback, NULL);
+    }
+}
+
+static void enter_low_power() {
+    low_power = true;
+    scheduler_stop();
+    
+    visible_board = 0;
+    if (board_timer != NULL) {
+        app_timer_cancel(board_timer);
+        board_timer = NULL;
+    }
+    
+    // blank the trains and train status once, rather than on every tick
+    bool trains_changed = false;
+    for (int i = 0; i < MAX_DISPLAYED_TRAINS; i++) {
+        trains_changed |= clear_train_display(&displayed_trains[i]);
+    }
+    if (trains_changed) {
+        layer_mark_dirty(s_trains_layer);
+    }
+    rendered_data_age = -1;
+    layer_mark_dirty(s_info_layer);
+    
+    arm_low_power();
+}
+
+// after a config change, the update periods may have moved, or the current one may have started or ended
+static void reconfigure_low_power() {
+    bool update_period = is_train_update_period();
+    
+    if (low_power && update_period) {
+        leave_low_power();
+    }
+    else if (!low_power && !update_period) {
+        enter_low_power();
+    }
+    else if (low_power) {
+        arm_low_power();
+    }
 }
 
 static void remove_tap_update() {
     if (update_only_on_tap) {
         remove_tap_update_timer = NULL;
         
-        train1_time = 0;
-        train2_time = 0;
-        train3_time = 0;
+        clear_departures();
         
         // update display
         last_update = time(NULL);
@@ -707,18 +1470,104 @@ static void schedule_remove_tap_update() {
     }
 }
 
+static void show_board(int board);
+
+static void show_current_route() {
+    board_timer = NULL;
+    show_board(0);
+}
+
+static void show_board(int board) {
+    visible_board = board;
+    
+    if (board_timer != NULL) {
+        app_timer_cancel(board_timer);
+        board_timer = NULL;
+    }
+    if (board != 0) {
+        board_timer = app_timer_register(BOARD_DISPLAY_MILLISECONDS, show_current_route, NULL);
+    }
+    
+    invalidate_train_render_cache();
+    time_t now = time(NULL);
+    struct tm *tick_time = localtime(&now);
+    update_UI(tick_time);
+}
+
+// the board after the visible one that has trains to show, or 0 for the current route
+static int next_board() {
+    time_t now = time(NULL);
+    
+    for (int board = visible_board + 1; board <= board_count; board++) {
+        int slot;
+        BoardView view = get_board_view(board);
+        if (next_departures(&view, now, &slot, 1) > 0) {
+            return board;
+        }
+    }
+    
+    return 0;
+}
+
 static void tap_handler(AccelAxisType axis, int32_t direction) {
+    // a glance may open an update window, if update times are learned
+    usage_record_glance(time(NULL));
+    
+    if (low_power) {
+        if (is_train_update_period()) {
+            leave_low_power();
+        }
+        return;
+    }
+    
+    // with boards, a tap shows the next board without contacting the phone; returning to the current route updates it
+    if (!update_only_on_tap && (visible_board != 0 || next_board() != 0)) {
+        show_board(next_board());
+        if (visible_board != 0) {
+            return;
+        }
+    }
+    
     request_trains_update();
+    reschedule_train_updates();
     schedule_remove_tap_update();
 }
 
-// static void get_persist_data() {
-//     if (persist_read_string(KEY_CURRENT_ORIGIN) {
+static void tick_handler(struct tm *tick_time, TimeUnits units_changed) {
+//     APP_LOG(APP_LOG_LEVEL_DEBUG, "in tick_handler()");
+    uint32_t start_ms = stats_time_ms();
+    
+    if (!low_power && !is_train_update_period()) {
+        enter_low_power();
+    }
+    
+    if (low_power) {
+        update_clock(tick_time);
+    }
+    else {
+        // promote the following trains as each train departs; the next departure drives the update schedule
+        drop_departed_trains(time(NULL));
+        if (next_departure_time() != scheduled_departure) {
+            reschedule_train_updates();
+        }
         
-//     }
-// }
+        // update requests are made by the scheduler, not on each tick
+        update_UI(tick_time);
+    }
+    
+    stats_tick_handled(start_ms);
+    if (tick_time->tm_min == 0) {
+        stats_save();
+    }
+}
 
 static void init() {
+    // restore the last received data before the first frame is drawn
+    get_persist_data();
+    scheduler_init(scheduled_update, last_update);
+    stats_init(PERSIST_KEY_STATS);
+    usage_init(PERSIST_KEY_USAGE);
+    
     // create main Window element and assign to pointer
     s_main_window = window_create();
 
@@ -737,20 +1586,18 @@ static void init() {
     // register Bluetooth connection monitoring
     bluetooth_connection_service_subscribe(bluetooth_connection_callback);
   
-    // register callbacks for AppMessage
-    app_message_register_inbox_received(inbox_received_callback);
-    app_message_register_inbox_dropped(inbox_dropped_callback);
-    app_message_register_outbox_failed(outbox_failed_callback);
-    app_message_register_outbox_sent(outbox_sent_callback);
-
-    // open AppMessage
-    app_message_open(app_message_inbox_size_maximum(), app_message_outbox_size_maximum());
-    
     // register callback for tap events
     accel_tap_service_subscribe(tap_handler);
+    
+    open_app_message();
+    if (!is_train_update_period()) {
+        enter_low_power();
+    }
 }
 
 static void deinit() {
+    scheduler_deinit();
+    stats_deinit();
     window_destroy(s_main_window);
     bluetooth_connection_service_unsubscribe();
     accel_tap_service_unsubscribe();
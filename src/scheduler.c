@@ -0,0 +1,252 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+#include "scheduler.h"
+
+// request timing settings
+const time_t INITIAL_UPDATE_DELAY_SECONDS = 3;
+const time_t TRAIN_UPDATE_PERIOD_SECONDS = 15 * 60;
+const time_t DEPARTURE_LEAD_SECONDS = 60;           // check for changes just before the next train departs
+const time_t LATE_BACKOFF_INITIAL_SECONDS = 60;     // while the next train is due or late, the interval between requests doubles...
+const int LATE_BACKOFF_MAX_STEP = 3;                // ...up to 8 minutes
+
+// request coalescing settings
+const time_t MIN_REQUEST_INTERVAL_SECONDS = 20;     // e.g. for repeated taps
+const time_t REQUEST_TIMEOUT_SECONDS = 45;          // a request with no response is no longer outstanding after this time
+
+// failure handling settings
+const time_t RETRY_BACKOFF_INITIAL_SECONDS = 30;    // after each consecutive failure, the retry delay doubles...
+const time_t RETRY_BACKOFF_MAX_SECONDS = 30 * 60;   // ...up to 30 minutes, plus up to 25 % random jitter
+const int CIRCUIT_BREAKER_THRESHOLD = 4;            // consecutive failures before the circuit opens
+const time_t CIRCUIT_OPEN_MIN_SECONDS = 15 * 60;
+
+static SchedulerRequestHandler s_handler = NULL;
+static AppTimer *s_timer = NULL;
+static time_t s_last_request = 0;
+static time_t s_not_before = 0;
+static time_t s_backoff_departure = 0;              // departure time for which s_backoff_step applies
+static int s_backoff_step = 0;
+static bool s_request_in_flight = false;
+static int s_failures = 0;                          // consecutive failed requests
+static time_t s_retry_not_before = 0;
+static SchedulerInputs s_inputs;
+
+
+static void timer_callback(void *data) {
+    s_timer = NULL;
+    
+    // the handler is expected to call scheduler_request_sent(), which re-arms the timer
+    if (s_handler != NULL) {
+        s_handler();
+    }
+}
+
+static time_t retry_delay(int failures) {
+    int step = failures > 1 ? failures - 1 : 0;
+    time_t delay = RETRY_BACKOFF_MAX_SECONDS;
+    
+    if (step < 16 && (RETRY_BACKOFF_INITIAL_SECONDS << step) < RETRY_BACKOFF_MAX_SECONDS) {
+        delay = RETRY_BACKOFF_INITIAL_SECONDS << step;
+    }
+    if (failures >= CIRCUIT_BREAKER_THRESHOLD && delay < CIRCUIT_OPEN_MIN_SECONDS) {
+        delay = CIRCUIT_OPEN_MIN_SECONDS;
+    }
+    
+    return delay;
+}
+
+static time_t next_useful_request_time(time_t now) {
+    // outside update periods, the only useful request is at the start of the next period
+    if (s_inputs.window_end == 0) {
+        return s_inputs.next_window_start;
+    }
+    
+    // periodic update, or immediately if there has been no update
+    time_t next = s_last_request != 0 ? s_last_request + TRAIN_UPDATE_PERIOD_SECONDS : now;
+    
+    if (s_inputs.next_departure != 0) {
+        time_t departure_check = s_inputs.next_departure - DEPARTURE_LEAD_SECONDS;
+        
+        if (departure_check > now) {
+            if (departure_check < next) {
+                next = departure_check;
+            }
+        }
+        else {
+            // train due or late: each request usually just confirms the delay, so back off
+            if (s_backoff_departure != s_inputs.next_departure) {
+                s_backoff_departure = s_inputs.next_departure;
+                s_backoff_step = 0;
+            }
+            
+            time_t backoff = s_last_request + (LATE_BACKOFF_INITIAL_SECONDS << s_backoff_step);
+            if (backoff < next) {
+                next = backoff;
+            }
+        }
+    }
+    
+    // no requests after the end of the update period
+    if (next >= s_inputs.window_end) {
+        return s_inputs.next_window_start;
+    }
+    
+    return next;
+}
+
+static time_t earliest_request_time() {
+    time_t earliest = s_not_before;
+    
+    if (s_retry_not_before > earliest) {
+        earliest = s_retry_not_before;
+    }
+    
+    // single-flight: wait for the outstanding request, and limit the rate of requests
+    if (s_last_request != 0) {
+        time_t interval = s_request_in_flight ? REQUEST_TIMEOUT_SECONDS : MIN_REQUEST_INTERVAL_SECONDS;
+        if (s_last_request + interval > earliest) {
+            earliest = s_last_request + interval;
+        }
+    }
+    
+    return earliest;
+}
+
+static time_t next_request_time(time_t now) {
+    time_t next = next_useful_request_time(now);
+    time_t earliest = earliest_request_time();
+    
+    if (next != 0 && next < earliest) {
+        next = earliest;
+    }
+    
+    return next;
+}
+
+static void arm_timer(time_t now) {
+    time_t next = next_request_time(now);
+    
+    if (next == 0) {
+        scheduler_stop();
+        return;
+    }
+    
+    if (next < now) {
+        next = now;
+    }
+    
+    uint32_t delay_ms = (uint32_t) (next - now) * 1000;
+    
+    if (s_timer == NULL || !app_timer_reschedule(s_timer, delay_ms)) {
+        s_timer = app_timer_register(delay_ms, timer_callback, NULL);
+    }
+}
+
+void scheduler_init(SchedulerRequestHandler handler, time_t last_update) {
+    s_handler = handler;
+    
+    // data restored from persistent storage count as the last update
+    s_last_request = last_update;
+    s_not_before = time(NULL) + INITIAL_UPDATE_DELAY_SECONDS;
+    
+    srand(time(NULL));
+}
+
+void scheduler_deinit(void) {
+    scheduler_stop();
+    s_handler = NULL;
+}
+
+void scheduler_request_sent(time_t now) {
+    s_last_request = now;
+    s_request_in_flight = true;
+    
+    // while failing, assume that this request will also fail until a response is received; in the half-open state, this allows a single trial request
+    if (s_failures > 0 && s_retry_not_before < now + retry_delay(s_failures)) {
+        s_retry_not_before = now + retry_delay(s_failures);
+    }
+    
+    // count the requests made while the next train is due or late
+    if (s_inputs.next_departure != 0 && s_inputs.next_departure == s_backoff_departure && s_backoff_step < LATE_BACKOFF_MAX_STEP) {
+        s_backoff_step++;
+    }
+    
+    scheduler_update(now, &s_inputs);
+}
+
+void scheduler_request_not_delivered(time_t now) {
+    // the phone never saw the request, so another can be made after the minimum interval; the interval runs from now,
+    // as the request may not have left the outbox at all, e.g. while it was busy
+    s_last_request = now;
+    s_request_in_flight = false;
+    scheduler_update(now, &s_inputs);
+}
+
+void scheduler_response_received(time_t now, bool failed, uint32_t retry_after) {
+    s_request_in_flight = false;
+    
+    if (!failed) {
+        s_failures = 0;
+        s_retry_not_before = 0;
+        return;
+    }
+    
+    if (s_failures < CIRCUIT_BREAKER_THRESHOLD * 4) {
+        s_failures++;
+    }
+    
+    time_t delay = retry_delay(s_failures);
+    if ((time_t) retry_after > delay) {
+        delay = retry_after;
+    }
+    
+    // random jitter, so that retries are not synchronised with other periodic activity
+    delay += rand() % (delay / 4 + 1);
+    
+    s_retry_not_before = now + delay;
+    scheduler_update(now, &s_inputs);
+}
+
+bool scheduler_request_allowed(time_t now) {
+    return now >= earliest_request_time();
+}
+
+SchedulerCircuitState scheduler_circuit_state(time_t now) {
+    if (s_failures < CIRCUIT_BREAKER_THRESHOLD) {
+        return SCHEDULER_CIRCUIT_CLOSED;
+    }
+    
+    return now < s_retry_not_before ? SCHEDULER_CIRCUIT_OPEN : SCHEDULER_CIRCUIT_HALF_OPEN;
+}
+
+void scheduler_update(time_t now, const SchedulerInputs *inputs) {
+    if (inputs != &s_inputs) {
+        s_inputs = *inputs;
+    }
+    
+    arm_timer(now);
+}
+
+void scheduler_stop(void) {
+    if (s_timer != NULL) {
+        app_timer_cancel(s_timer);
+        s_timer = NULL;
+    }
+    
+    // requests sent while stopped must not re-arm the timer
+    memset(&s_inputs, 0, sizeof(s_inputs));
+}
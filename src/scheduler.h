@@ -0,0 +1,61 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+#pragma once
+
+#include <pebble.h>
+
+// Decides when train updates should be requested from the phone, and arms a single AppTimer for the next
+// request that could change what is displayed.
+
+typedef void (*SchedulerRequestHandler)(void);
+
+typedef enum {
+    SCHEDULER_CIRCUIT_CLOSED,       // requests are made normally, although retries after a failure are backed off
+    SCHEDULER_CIRCUIT_OPEN,         // too many consecutive failures: no requests until the retry time
+    SCHEDULER_CIRCUIT_HALF_OPEN     // retry time has passed: a single trial request is allowed
+} SchedulerCircuitState;
+
+typedef struct {
+    time_t next_departure;      // departure time of the next train, or 0 if there is none
+    time_t window_end;          // end of the current update period, or 0 if outside an update period
+    time_t next_window_start;   // start of the next update period, or 0 if there is none
+} SchedulerInputs;
+
+void scheduler_init(SchedulerRequestHandler handler, time_t last_update);
+void scheduler_deinit(void);
+
+// must be called whenever a train update request is sent, including requests not made by the scheduler
+void scheduler_request_sent(time_t now);
+
+// must be called if a request could not be sent to the phone
+void scheduler_request_not_delivered(time_t now);
+
+// must be called for each response from the phone; retry_after is the phone's hint in seconds, or 0
+void scheduler_response_received(time_t now, bool failed, uint32_t retry_after);
+
+// false while a request is outstanding, within a minimum interval of the last request, or while backing off after
+// failed requests; applies to all requests, including those not made by the scheduler
+bool scheduler_request_allowed(time_t now);
+
+SchedulerCircuitState scheduler_circuit_state(time_t now);
+
+// recalculates the next request time; call after each response, and whenever the inputs change
+void scheduler_update(time_t now, const SchedulerInputs *inputs);
+
+// cancels any pending request, e.g. when updates are only made on request
+void scheduler_stop(void);
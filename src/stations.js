@@ -1,2558 +0,0 @@
-var stations = [
-    {'x': 53.295, 'y': -3.583, 'CRS': 'AGL'},
-    {'x': 52.97727, 'y': -0.29402, 'CRS': 'HEC'},
-    {'x': 51.8167, 'y': -3.0088, 'CRS': 'AGV'},
-    {'x': 50.83639, 'y': -0.18167, 'CRS': 'AGT'},
-    {'x': 55.857, 'y': -4.251, 'CRS': 'AGS'},
-    {'x': 51.6118, 'y': -0.0495, 'CRS': 'AGR'},
-    {'x': 53.588950, 'y': -1.705370, 'CRS': 'SPY'},
-    {'x': 52.7494111, 'y': -1.1455389, 'CRS': 'BWS'},
-    {'x': 51.1272, 'y': -2.9917, 'CRS': 'BWT'},
-    {'x': 51.4180, 'y': -2.4954, 'CRS': 'KYN'},
-    {'x': 57.2800, 'y': -5.7138, 'CRS': 'KYL'},
-    {'x': 52.430, 'y': 0.413, 'CRS': 'SPP'},
-    {'x': 55.8816, 'y': -4.2296, 'CRS': 'SPR'},
-    {'x': 55.8901, 'y': -4.1406, 'CRS': 'SPS'},
-    {'x': 53.40500, 'y': -2.16278, 'CRS': 'SPT'},
-    {'x': 51.171, 'y': 0.550, 'CRS': 'SPU'},
-    {'x': 51.188194, 'y': 1.22972, 'CRS': 'SPH'},
-    {'x': 53.3400, 'y': -2.9941, 'CRS': 'SPI'},
-    {'x': 52.004, 'y': -0.696, 'CRS': 'BWB'},
-    {'x': 53.11389, 'y': -1.24583, 'CRS': 'SPK'},
-    {'x': 53.4124, 'y': -2.5253, 'CRS': 'BWD'},
-    {'x': 52.5351, 'y': 1.0860, 'CRS': 'SPN'},
-    {'x': 55.9311, 'y': -4.4929, 'CRS': 'BWG'},
-    {'x': 52.7889, 'y': -0.1569, 'CRS': 'SPA'},
-    {'x': 51.505128, 'y': -0.217561, 'CRS': 'SPB'},
-    {'x': 55.775, 'y': -2.011, 'CRS': 'BWK'},
-    {'x': 52.626, 'y': -2.019, 'CRS': 'BWN'},
-    {'x': 51.7058, 'y': -0.359, 'CRS': 'BWO'},
-    {'x': 54.440, 'y': -3.543, 'CRS': 'BYS'},
-    {'x': 53.4996, 'y': -2.6477, 'CRS': 'BYN'},
-    {'x': 56.4932, 'y': -2.7456, 'CRS': 'BYL'},
-    {'x': 53.785, 'y': -2.249, 'CRS': 'BYM'},
-    {'x': 53.5440, 'y': -1.1510, 'CRS': 'BYK'},
-    {'x': 51.3924, 'y': -3.2736, 'CRS': 'BYI'},
-    {'x': 56.4677, 'y': -2.8741, 'CRS': 'BYF'},
-    {'x': 51.4024, 'y': -3.2615, 'CRS': 'BYD'},
-    {'x': 51.672, 'y': -4.099, 'CRS': 'BYE'},
-    {'x': 52.968, 'y': -2.067, 'CRS': 'BYB'},
-    {'x': 53.092, 'y': -3.801, 'CRS': 'BYC'},
-    {'x': 52.59000, 'y': 1.63083, 'CRS': 'BYA'},
-    {'x': 51.6307, 'y': 0.3297, 'CRS': 'SNF'},
-    {'x': 51.39222, 'y': -0.63306, 'CRS': 'SNG'},
-    {'x': 51.346, 'y': -0.804, 'CRS': 'SND'},
-    {'x': 51.3852889, 'y': 1.3721806, 'CRS': 'MAR'},
-    {'x': 53.43389, 'y': -2.2087500, 'CRS': 'MAU'},
-    {'x': 53.138, 'y': -1.559, 'CRS': 'MAT'},
-    {'x': 53.663000, 'y': -1.481000, 'CRS': 'SNA'},
-    {'x': 55.3546, 'y': -4.6855, 'CRS': 'MAY'},
-    {'x': 55.8376, 'y': -4.2888, 'CRS': 'MAX'},
-    {'x': 51.363, 'y': -0.2485, 'CRS': 'SNL'},
-    {'x': 53.3923, 'y': -2.6506, 'CRS': 'SNK'},
-    {'x': 53.4529, 'y': -2.730, 'CRS': 'SNH'},
-    {'x': 53.69279, 'y': -1.02600, 'CRS': 'SNI'},
-    {'x': 50.875656, 'y': -1.265852, 'CRS': 'SNW'},
-    {'x': 53.2595, 'y': -2.1217, 'CRS': 'MAC'},
-    {'x': 51.3484, 'y': -0.094, 'CRS': 'SNR'},
-    {'x': 51.432, 'y': -0.503, 'CRS': 'SNS'},
-    {'x': 53.5064, 'y': -2.9311, 'CRS': 'MAG'},
-    {'x': 51.519, 'y': -0.723, 'CRS': 'MAI'},
-    {'x': 51.385, 'y': -0.261, 'CRS': 'MAL'},
-    {'x': 51.408, 'y': -0.725, 'CRS': 'MAO'},
-    {'x': 53.477, 'y': -2.230, 'CRS': 'MAN'},
-    {'x': 52.479, 'y': -1.467, 'CRS': 'BEH'},
-    {'x': 54.1155, 'y': -2.5105, 'CRS': 'BEN'},
-    {'x': 57.4783, 'y': -4.4699, 'CRS': 'BEL'},
-    {'x': 54.12780, 'y': -0.17920, 'CRS': 'BEM'},
-    {'x': 53.358, 'y': -3.004, 'CRS': 'BEB'},
-    {'x': 51.4246, 'y': -0.0161, 'CRS': 'BEC'},
-    {'x': 56.1566, 'y': -3.9573, 'CRS': 'BEA'},
-    {'x': 51.544, 'y': 0.562, 'CRS': 'BEF'},
-    {'x': 51.204587, 'y': 0.405887, 'CRS': 'BEG'},
-    {'x': 52.92056, 'y': -1.20806, 'CRS': 'BEE'},
-    {'x': 50.841, 'y': 0.477, 'CRS': 'BEX'},
-    {'x': 53.9257, 'y': -1.7973, 'CRS': 'BEY'},
-    {'x': 52.2450, 'y': -1.7497, 'CRS': 'BER'},
-    {'x': 53.624, 'y': -2.915, 'CRS': 'BES'},
-    {'x': 53.842000, 'y': -0.421000, 'CRS': 'BEV'},
-    {'x': 51.523, 'y': -0.059, 'CRS': 'BET'},
-    {'x': 50.8544, 'y': -1.5047, 'CRS': 'BEU'},
-    {'x': 55.9016, 'y': -3.5435, 'CRS': 'LSN'},
-    {'x': 50.447, 'y': -4.469, 'CRS': 'LSK'},
-    {'x': 53.408, 'y': -3.100, 'CRS': 'LSW'},
-    {'x': 51.5186, 'y': -0.0813, 'CRS': 'LST'},
-    {'x': 51.3985, 'y': -0.1004, 'CRS': 'TTH'},
-    {'x': 50.9178, 'y': -1.4826, 'CRS': 'TTN'},
-    {'x': 52.4190, 'y': 0.7455, 'CRS': 'TTF'},
-    {'x': 51.4245, 'y': -0.0336, 'CRS': 'LSY'},
-    {'x': 51.4413167, 'y': 0.3666917, 'CRS': 'GRV'},
-    {'x': 51.170, 'y': -1.621, 'CRS': 'GRT'},
-    {'x': 55.8874, 'y': -4.3638, 'CRS': 'GRS'},
-    {'x': 51.4306, 'y': 0.0219, 'CRS': 'GRP'},
-    {'x': 51.476, 'y': 0.322, 'CRS': 'GRY'},
-    {'x': 53.7966, 'y': -1.3824, 'CRS': 'GRF'},
-    {'x': 51.852, 'y': 1.065, 'CRS': 'GRB'},
-    {'x': 52.060, 'y': 0.194, 'CRS': 'GRC'},
-    {'x': 52.906, 'y': -0.642, 'CRS': 'GRA'},
-    {'x': 53.306, 'y': -1.626, 'CRS': 'GRN'},
-    {'x': 55.9349, 'y': -3.9937, 'CRS': 'GRL'},
-    {'x': 51.5617, 'y': -0.0571, 'CRS': 'CPT'},
-    {'x': 55.9619, 'y': -4.8158, 'CRS': 'GRK'},
-    {'x': 55.8855, 'y': -4.0788, 'CRS': 'GRH'},
-    {'x': 55.8126, 'y': -3.9736, 'CRS': 'HLY'},
-    {'x': 55.8559, 'y': -4.3708, 'CRS': 'HLW'},
-    {'x': 56.0124, 'y': -4.7304, 'CRS': 'HLU'},
-    {'x': 50.828174, 'y': -1.058818, 'CRS': 'HLS'},
-    {'x': 53.4975, 'y': -3.0497, 'CRS': 'HLR'},
-    {'x': 53.563130, 'y': -1.075480, 'CRS': 'KKS'},
-    {'x': 53.7868, 'y': -2.8823, 'CRS': 'KKM'},
-    {'x': 51.962, 'y': -0.496, 'CRS': 'HLN'},
-    {'x': 51.181, 'y': -0.321, 'CRS': 'HLM'},
-    {'x': 51.5159, 'y': -3.1823, 'CRS': 'HLL'},
-    {'x': 55.8141, 'y': -4.1678, 'CRS': 'KKH'},
-    {'x': 53.581840, 'y': -0.160490, 'CRS': 'HLI'},
-    {'x': 52.437, 'y': -1.845, 'CRS': 'HLG'},
-    {'x': 53.4408, 'y': -2.9811, 'CRS': 'KKD'},
-    {'x': 55.8542, 'y': -4.3551, 'CRS': 'HLE'},
-    {'x': 54.011000, 'y': -2.228000, 'CRS': 'HLD'},
-    {'x': 56.0038, 'y': -4.7315, 'CRS': 'HLC'},
-    {'x': 51.2142, 'y': 0.2277, 'CRS': 'HLB'},
-    {'x': 53.700490, 'y': -1.423520, 'CRS': 'NOR'},
-    {'x': 53.10028, 'y': -1.25306, 'CRS': 'KKB'},
-    {'x': 52.5375, 'y': -2.8035, 'CRS': 'CTT'},
-    {'x': 53.750, 'y': -2.391, 'CRS': 'CTW'},
-    {'x': 53.1968, 'y': -2.8798, 'CRS': 'CTR'},
-    {'x': 55.7651, 'y': -4.0044, 'CRS': 'CTE'},
-    {'x': 51.4447, 'y': -0.0261, 'CRS': 'CTF'},
-    {'x': 53.452, 'y': -2.086, 'CRS': 'HYC'},
-    {'x': 53.997440, 'y': -1.319931, 'CRS': 'CTL'},
-    {'x': 51.3805, 'y': 0.5205, 'CRS': 'CTM'},
-    {'x': 51.48686, 'y': 0.03232, 'CRS': 'CTN'},
-    {'x': 52.96444, 'y': -1.07972, 'CRS': 'CTO'},
-    {'x': 51.5678, 'y': 0.1292, 'CRS': 'CTH'},
-    {'x': 51.5163, 'y': -0.1037, 'CRS': 'CTK'},
-    {'x': 51.5473, 'y': -0.1918, 'CRS': 'WHD'},
-    {'x': 53.824, 'y': -2.412, 'CRS': 'WHE'},
-    {'x': 53.5558, 'y': -2.5233, 'CRS': 'WHG'},
-    {'x': 51.095, 'y': 1.038, 'CRS': 'WHA'},
-    {'x': 51.583056, 'y': -0.019722, 'CRS': 'WHC'},
-    {'x': 51.605, 'y': -0.071, 'CRS': 'WHL'},
-    {'x': 50.768, 'y': -3.354, 'CRS': 'WHM'},
-    {'x': 53.414, 'y': -2.796, 'CRS': 'WHN'},
-    {'x': 51.3576000, 'y': 1.0334861, 'CRS': 'WHI'},
-    {'x': 51.5208, 'y': -3.2222, 'CRS': 'WHT'},
-    {'x': 51.5484, 'y': -0.1930, 'CRS': 'WHP'},
-    {'x': 51.5679, 'y': 0.3406, 'CRS': 'WHR'},
-    {'x': 51.3034, 'y': -0.0768, 'CRS': 'WHS'},
-    {'x': 53.4461, 'y': -2.3681, 'CRS': 'CSR'},
-    {'x': 51.3098, 'y': -0.0812, 'CRS': 'WHY'},
-    {'x': 50.18560, 'y': -5.42010, 'CRS': 'HYL'},
-    {'x': 52.91194, 'y': -1.41056, 'CRS': 'SPO'},
-    {'x': 55.9453, 'y': -3.2187, 'CRS': 'HYM'},
-    {'x': 55.952089, 'y': -3.189262, 'CRS': 'EDB'},
-    {'x': 50.892, 'y': -0.957, 'CRS': 'RLN'},
-    {'x': 53.40250, 'y': -2.94639, 'CRS': 'EDG'},
-    {'x': 51.589, 'y': 0.601, 'CRS': 'RLG'},
-    {'x': 52.2846, 'y': -1.5363, 'CRS': 'LMS'},
-    {'x': 51.39, 'y': -0.0262, 'CRS': 'EDN'},
-    {'x': 51.3741, 'y': 0.0885, 'CRS': 'ORP'},
-    {'x': 51.6242, 'y': -0.0614, 'CRS': 'EDR'},
-    {'x': 55.9276, 'y': -3.3077, 'CRS': 'EDP'},
-    {'x': 51.3765, 'y': 0.0102, 'CRS': 'HYS'},
-    {'x': 51.4616, 'y': -0.0804, 'CRS': 'EDW'},
-    {'x': 53.464, 'y': -2.086, 'CRS': 'HYT'},
-    {'x': 50.867, 'y': 0.592, 'CRS': 'ORE'},
-    {'x': 50.37849, 'y': -4.17018, 'CRS': 'DPT'},
-    {'x': 51.239, 'y': -0.325, 'CRS': 'DPD'},
-    {'x': 52.119, 'y': 0.057, 'CRS': 'FXN'},
-    {'x': 51.4646, 'y': -2.6109, 'CRS': 'CFN'},
-    {'x': 51.6679, 'y': -0.561, 'CRS': 'CFO'},
-    {'x': 53.858550, 'y': -1.844920, 'CRS': 'CFL'},
-    {'x': 50.12226, 'y': -5.53223, 'CRS': 'PNZ'},
-    {'x': 51.4859, 'y': 0.2876, 'CRS': 'CFH'},
-    {'x': 55.8182, 'y': -4.2282, 'CRS': 'CFF'},
-    {'x': 53.724, 'y': -1.355, 'CRS': 'CFD'},
-    {'x': 54.662, 'y': -2.758, 'CRS': 'PNR'},
-    {'x': 51.4446, 'y': -0.025, 'CRS': 'CFB'},
-    {'x': 51.4174, 'y': -0.0648, 'CRS': 'PNW'},
-    {'x': 50.1504, 'y': -5.0830, 'CRS': 'PNM'},
-    {'x': 53.958450, 'y': -1.532740, 'CRS': 'PNL'},
-    {'x': 51.659, 'y': -4.722, 'CRS': 'PNA'},
-    {'x': 51.455, 'y': -0.0367, 'CRS': 'CFT'},
-    {'x': 50.98306, 'y': -1.38444, 'CRS': 'CFR'},
-    {'x': 53.143, 'y': -3.055, 'CRS': 'PNF'},
-    {'x': 53.7560, 'y': -2.7072, 'CRS': 'PRE'},
-    {'x': 51.4691, 'y': -0.0225, 'CRS': 'SAJ'},
-    {'x': 55.8826, 'y': -4.3246, 'CRS': 'JOR'},
-    {'x': 52.6756, 'y': 1.3915, 'CRS': 'SAH'},
-    {'x': 55.5090, 'y': -4.6141, 'CRS': 'PRA'},
-    {'x': 50.657, 'y': -1.162, 'CRS': 'SAN'},
-    {'x': 53.7222, 'y': -0.8070, 'CRS': 'SAM'},
-    {'x': 53.293, 'y': -2.145, 'CRS': 'PRB'},
-    {'x': 51.7504, 'y': -0.3274, 'CRS': 'SAC'},
-    {'x': 51.551, 'y': 0.711, 'CRS': 'PRL'},
-    {'x': 51.7447, 'y': -0.3426, 'CRS': 'SAA'},
-    {'x': 54.570, 'y': -3.582, 'CRS': 'PRN'},
-    {'x': 52.929, 'y': -4.065, 'CRS': 'PRH'},
-    {'x': 53.8385, 'y': -1.7904, 'CRS': 'SAE'},
-    {'x': 52.508637, 'y': -2.011776, 'CRS': 'SAD'},
-    {'x': 54.965722, 'y': -1.865056, 'CRS': 'PRU'},
-    {'x': 53.336, 'y': -3.407, 'CRS': 'PRT'},
-    {'x': 50.21666, 'y': -5.11142, 'CRS': 'PRW'},
-    {'x': 52.2150, 'y': 1.4901, 'CRS': 'SAX'},
-    {'x': 50.84583, 'y': -0.15500, 'CRS': 'PRP'},
-    {'x': 52.8992, 'y': -2.6895, 'CRS': 'PRS'},
-    {'x': 51.718, 'y': -0.844, 'CRS': 'PRR'},
-    {'x': 53.7531, 'y': -3.0290, 'CRS': 'SAS'},
-    {'x': 51.5132, 'y': -2.6962, 'CRS': 'SAR'},
-    {'x': 52.516, 'y': -1.902, 'CRS': 'PRY'},
-    {'x': 52.194, 'y': -1.716, 'CRS': 'SAV'},
-    {'x': 50.3397, 'y': -4.79028, 'CRS': 'SAU'},
-    {'x': 51.4994, 'y': -0.2707, 'CRS': 'SAT'},
-    {'x': 55.8647, 'y': -4.2700, 'CRS': 'CHC'},
-    {'x': 53.238222, 'y': -1.41972, 'CRS': 'CHD'},
-    {'x': 51.356, 'y': -0.2147, 'CRS': 'CHE'},
-    {'x': 53.8263, 'y': -1.2275, 'CRS': 'CHF'},
-    {'x': 51.208, 'y': 0.790, 'CRS': 'CHG'},
-    {'x': 51.051, 'y': -0.364, 'CRS': 'CHH'},
-    {'x': 51.6331, 'y': 0.0094, 'CRS': 'CHI'},
-    {'x': 51.4813, 'y': -0.2683, 'CRS': 'CHK'},
-    {'x': 51.215, 'y': -0.525, 'CRS': 'CHL'},
-    {'x': 54.973, 'y': -1.605, 'CRS': 'MAS'},
-    {'x': 56.9690, 'y': -5.8222, 'CRS': 'MRR'},
-    {'x': 51.736, 'y': -0.829, 'CRS': 'MRS'},
-    {'x': 51.309, 'y': -0.169, 'CRS': 'CHP'},
-    {'x': 50.738, 'y': -1.785, 'CRS': 'CHR'},
-    {'x': 52.908, 'y': -2.155, 'CRS': 'SNE'},
-    {'x': 55.537, 'y': -1.706, 'CRS': 'CHT'},
-    {'x': 53.3763, 'y': -2.18778, 'CRS': 'CHU'},
-    {'x': 51.539, 'y': 0.671, 'CRS': 'CHW'},
-    {'x': 51.508, 'y': -0.125, 'CRS': 'CHX'},
-    {'x': 51.387, 'y': -0.510, 'CRS': 'CHY'},
-    {'x': 53.4086, 'y': -2.9892, 'CRS': 'MRF'},
-    {'x': 51.660, 'y': -4.792, 'CRS': 'MRB'},
-    {'x': 51.5749, 'y': 0.1827, 'CRS': 'RMF'},
-    {'x': 56.1857, 'y': -3.9657, 'CRS': 'DBL'},
-    {'x': 53.0462, 'y': -2.9994, 'CRS': 'WXC'},
-    {'x': 51.733, 'y': -0.463, 'CRS': 'APS'},
-    {'x': 54.580, 'y': -2.487, 'CRS': 'APP'},
-    {'x': 55.9426, 'y': -4.5542, 'CRS': 'DBE'},
-    {'x': 53.572670, 'y': -1.663050, 'CRS': 'DBD'},
-    {'x': 51.0339, 'y': -1.5469, 'CRS': 'DBG'},
-    {'x': 52.9161, 'y': -1.4633, 'CRS': 'DBY'},
-    {'x': 53.5148, 'y': -2.3367, 'CRS': 'SNN'},
-    {'x': 52.232, 'y': -0.247, 'CRS': 'SNO'},
-    {'x': 53.579, 'y': -2.719, 'CRS': 'APB'},
-    {'x': 52.051, 'y': 1.183, 'CRS': 'DBR'},
-    {'x': 51.640, 'y': -1.242, 'CRS': 'APF'},
-    {'x': 52.021, 'y': -0.632, 'CRS': 'APG'},
-    {'x': 51.0330, 'y': 0.8164, 'CRS': 'APD'},
-    {'x': 51.6407, 'y': -3.2417, 'CRS': 'YSM'},
-    {'x': 51.6436, 'y': -3.4668, 'CRS': 'YSR'},
-    {'x': 51.41952, 'y': -2.75030, 'CRS': 'NLS'},
-    {'x': 53.144, 'y': -3.803, 'CRS': 'NLR'},
-    {'x': 55.7619, 'y': -4.2205, 'CRS': 'HMY'},
-    {'x': 53.453, 'y': -2.614, 'CRS': 'NLW'},
-    {'x': 51.068, 'y': 0.855, 'CRS': 'HMT'},
-    {'x': 51.4141, 'y': -0.3107, 'CRS': 'HMW'},
-    {'x': 51.4159, 'y': -0.3717, 'CRS': 'HMP'},
-    {'x': 53.278, 'y': -2.841, 'CRS': 'SNT'},
-    {'x': 58.1177, 'y': -3.6590, 'CRS': 'HMS'},
-    {'x': 51.742, 'y': -0.491, 'CRS': 'HML'},
-    {'x': 53.996363, 'y': -1.284040, 'CRS': 'HMM'},
-    {'x': 51.547, 'y': -0.0431, 'CRS': 'HMN'},
-    {'x': 50.796, 'y': 0.279, 'CRS': 'HMD'},
-    {'x': 50.871, 'y': -1.329, 'CRS': 'HME'},
-    {'x': 51.4028, 'y': -0.3425, 'CRS': 'HMC'},
-    {'x': 53.186, 'y': -3.823, 'CRS': 'DLG'},
-    {'x': 51.1436, 'y': 0.87448, 'CRS': 'AFK'},
-    {'x': 51.5482, 'y': -0.0763, 'CRS': 'DLK'},
-    {'x': 51.54539, 'y': -0.07474, 'CRS': 'DLJ'},
-    {'x': 50.919, 'y': 0.611, 'CRS': 'DLH'},
-    {'x': 53.229, 'y': -2.667, 'CRS': 'DLM'},
-    {'x': 54.846, 'y': -2.989, 'CRS': 'DLS'},
-    {'x': 55.9472, 'y': -4.5770, 'CRS': 'DLR'},
-    {'x': 51.865, 'y': -2.239, 'CRS': 'GCR'},
-    {'x': 56.9351, 'y': -4.2463, 'CRS': 'DLW'},
-    {'x': 53.57581, 'y': -0.13007, 'CRS': 'GCT'},
-    {'x': 53.267, 'y': -3.798, 'CRS': 'GCW'},
-    {'x': 54.154, 'y': -3.179, 'CRS': 'DLT'},
-    {'x': 53.7416, 'y': -2.9934, 'CRS': 'AFV'},
-    {'x': 51.437, 'y': -0.468, 'CRS': 'AFS'},
-    {'x': 54.457, 'y': -1.094, 'CRS': 'BTT'},
-    {'x': 51.869, 'y': 0.567, 'CRS': 'BTP'},
-    {'x': 56.0573, 'y': -3.2335, 'CRS': 'BTS'},
-    {'x': 51.8753, 'y': 0.5569, 'CRS': 'BTR'},
-    {'x': 51.901, 'y': 0.200, 'CRS': 'SST'},
-    {'x': 51.181, 'y': -0.868, 'CRS': 'BTY'},
-    {'x': 51.4410, 'y': 0.7585, 'CRS': 'SSS'},
-    {'x': 50.918, 'y': -1.377, 'CRS': 'BTE'},
-    {'x': 53.51880, 'y': -1.31156, 'CRS': 'BTD'},
-    {'x': 52.3607, 'y': -1.9926, 'CRS': 'BTG'},
-    {'x': 52.94472, 'y': -0.79529, 'CRS': 'BTF'},
-    {'x': 53.57503, 'y': -0.40990, 'CRS': 'BTB'},
-    {'x': 50.83417, 'y': -0.27139, 'CRS': 'SSE'},
-    {'x': 53.709910, 'y': -1.623020, 'CRS': 'BTL'},
-    {'x': 51.248, 'y': -0.267, 'CRS': 'BTO'},
-    {'x': 50.8288, 'y': -0.1411, 'CRS': 'BTN'},
-    {'x': 51.3775, 'y': -2.3564, 'CRS': 'BTH'},
-    {'x': 54.396, 'y': -3.485, 'CRS': 'SSC'},
-    {'x': 52.380, 'y': -1.866, 'CRS': 'WYT'},
-    {'x': 50.60863, 'y': -2.44828, 'CRS': 'WYQ'},
-    {'x': 54.687, 'y': -1.207, 'CRS': 'HPL'},
-    {'x': 51.185, 'y': 0.929, 'CRS': 'WYE'},
-    {'x': 51.3616, 'y': -0.4575, 'CRS': 'WYB'},
-    {'x': 54.975, 'y': -1.814, 'CRS': 'WYM'},
-    {'x': 52.546, 'y': -1.831, 'CRS': 'WYL'},
-    {'x': 51.3577, 'y': -0.1714, 'CRS': 'CSB'},
-    {'x': 51.999, 'y': -2.109, 'CRS': 'ASC'},
-    {'x': 51.508, 'y': -0.542, 'CRS': 'LNY'},
-    {'x': 55.9213, 'y': -4.1542, 'CRS': 'LNZ'},
-    {'x': 52.105, 'y': -3.632, 'CRS': 'LNW'},
-    {'x': 53.43065, 'y': -2.7805, 'CRS': 'ECL'},
-    {'x': 51.963, 'y': -3.872, 'CRS': 'LNR'},
-    {'x': 53.0443, 'y': -3.9214, 'CRS': 'RMB'},
-    {'x': 53.4322, 'y': -1.3605, 'CRS': 'RMC'},
-    {'x': 52.47062, 'y': 0.96961, 'CRS': 'ECS'},
-    {'x': 51.3752, 'y': -0.0923, 'CRS': 'ECR'},
-    {'x': 55.6735, 'y': -3.7723, 'CRS': 'LNK'},
-    {'x': 55.9763, 'y': -2.8884, 'CRS': 'LND'},
-    {'x': 51.385, 'y': -0.595, 'CRS': 'LNG'},
-    {'x': 53.414, 'y': -2.089, 'CRS': 'RML'},
-    {'x': 51.6031, 'y': -3.2331, 'CRS': 'LNB'},
-    {'x': 53.746396, 'y': -2.479083, 'CRS': 'BBN'},
-    {'x': 51.2899, 'y': 0.1942, 'CRS': 'BBL'},
-    {'x': 52.624, 'y': -2.186, 'CRS': 'BBK'},
-    {'x': 55.9038, 'y': -4.2249, 'CRS': 'BBG'},
-    {'x': 51.3909, 'y': -2.8278, 'CRS': 'YAT'},
-    {'x': 52.0979, 'y': -1.9474, 'CRS': 'EVE'},
-    {'x': 54.189, 'y': -3.205, 'CRS': 'ASK'},
-    {'x': 53.6210, 'y': -1.7935, 'CRS': 'BBW'},
-    {'x': 52.471, 'y': -1.877, 'CRS': 'BBS'},
-    {'x': 51.5284, 'y': -0.1331, 'CRS': 'EUS'},
-    {'x': 51.250, 'y': -0.713, 'CRS': 'ASH'},
-    {'x': 51.6726, 'y': -0.0472, 'CRS': 'TUR'},
-    {'x': 52.864, 'y': -1.682, 'CRS': 'TUT'},
-    {'x': 51.4399, 'y': -0.1049, 'CRS': 'TUH'},
-    {'x': 56.8841, 'y': -4.7012, 'CRS': 'TUL'},
-    {'x': 54.5884, 'y': -5.9328, 'CRS': '17Q'},
-    {'x': 53.14444, 'y': -0.74917, 'CRS': 'CLM'},
-    {'x': 53.5223, 'y': -2.3141, 'CRS': 'CLI'},
-    {'x': 51.4891, 'y': -3.1793, 'CRS': 'CYS'},
-    {'x': 51.4182, 'y': -0.0726, 'CRS': 'CYP'},
-    {'x': 53.5660, 'y': -3.0719, 'CRS': 'FRE'},
-    {'x': 53.733, 'y': -2.518, 'CRS': 'CYT'},
-    {'x': 53.694, 'y': -1.319, 'CRS': 'POT'},
-    {'x': 53.296, 'y': -2.723, 'CRS': 'FRD'},
-    {'x': 51.6124, 'y': -3.4075, 'CRS': 'POR'},
-    {'x': 53.975954, 'y': -1.148157, 'CRS': 'POP'},
-    {'x': 51.6421, 'y': -0.03518, 'CRS': 'PON'},
-    {'x': 53.099, 'y': -3.031, 'CRS': 'CYB'},
-    {'x': 50.73119, 'y': -3.50169, 'CRS': 'POL'},
-    {'x': 50.731, 'y': -1.825, 'CRS': 'POK'},
-    {'x': 55.9006, 'y': -4.4042, 'CRS': 'CYK'},
-    {'x': 52.0515, 'y': -3.7483, 'CRS': 'CYN'},
-    {'x': 55.9917, 'y': -3.7924, 'CRS': 'FKK'},
-    {'x': 53.8459, 'y': -1.9245, 'CRS': ' '},
-    {'x': 52.516, 'y': -3.433, 'CRS': 'CWS'},
-    {'x': 51.0827, 'y': 1.1697, 'CRS': 'FKC'},
-    {'x': 50.889, 'y': 0.501, 'CRS': 'CWU'},
-    {'x': 51.264, 'y': -0.503, 'CRS': 'CLA'},
-    {'x': 51.6845, 'y': -0.1072, 'CRS': 'CWH'},
-    {'x': 51.6572, 'y': -3.0160, 'CRS': 'CWM'},
-    {'x': 52.080, 'y': -2.357, 'CRS': 'CWL'},
-    {'x': 51.156, 'y': 0.110, 'CRS': 'CWN'},
-    {'x': 51.926, 'y': 0.759, 'CRS': 'CWC'},
-    {'x': 51.0996, 'y': -2.5241, 'CRS': 'CLC'},
-    {'x': 53.5898, 'y': -0.8175, 'CRS': 'CWE'},
-    {'x': 53.26389, 'y': -1.21639, 'CRS': 'CWD'},
-    {'x': 51.085, 'y': 1.154, 'CRS': 'FKW'},
-    {'x': 53.373, 'y': -3.184, 'CRS': 'WKI'},
-    {'x': 53.679, 'y': -1.488, 'CRS': 'WKK'},
-    {'x': 51.411, 'y': -0.843, 'CRS': 'WKM'},
-    {'x': 51.470, 'y': -0.559, 'CRS': 'SNY'},
-    {'x': 53.5197, 'y': -2.3960, 'CRS': 'WKD'},
-    {'x': 54.645, 'y': -3.558, 'CRS': 'WKG'},
-    {'x': 53.6820, 'y': -1.5055, 'CRS': 'WKF'},
-    {'x': 50.355, 'y': -4.70465, 'CRS': 'PAR'},
-    {'x': 53.485, 'y': -2.357, 'CRS': 'PAT'},
-    {'x': 54.542, 'y': -3.582, 'CRS': 'CKL'},
-    {'x': 50.8736, 'y': -2.7771, 'CRS': 'CKN'},
-    {'x': 55.8373, 'y': -4.3341, 'CRS': 'CKH'},
-    {'x': 55.8422, 'y': -4.3653, 'CRS': 'CKT'},
-    {'x': 51.5173, 'y': -0.1774, 'CRS': 'PAD'},
-    {'x': 55.7894, 'y': -4.2755, 'CRS': 'CKS'},
-    {'x': 51.6208, 'y': -3.1259, 'CRS': 'CKY'},
-    {'x': 53.71682, 'y': -0.50600, 'CRS': 'FRY'},
-    {'x': 51.4853, 'y': -1.09, 'CRS': 'PAN'},
-    {'x': 51.520, 'y': -0.1053, 'CRS': 'ZFD'},
-    {'x': 50.709, 'y': -2.437, 'CRS': 'DCH'},
-    {'x': 57.3369, 'y': -5.6372, 'CRS': 'DCG'},
-    {'x': 54.809, 'y': -2.772, 'CRS': 'AWT'},
-    {'x': 52.031, 'y': -0.110, 'CRS': 'AWM'},
-    {'x': 53.5719, 'y': -1.1797, 'CRS': 'AWK'},
-    {'x': 50.711, 'y': -2.443, 'CRS': 'DCW'},
-    {'x': 51.5005, 'y': -3.2339, 'CRS': 'DCT'},
-    {'x': 51.5137, 'y': -0.3203, 'CRS': 'WEA'},
-    {'x': 51.853, 'y': 1.115, 'CRS': 'WEE'},
-    {'x': 52.951, 'y': -2.171, 'CRS': 'WED'},
-    {'x': 55.9315, 'y': -4.6567, 'CRS': 'WDL'},
-    {'x': 51.528, 'y': 0.004, 'CRS': 'WEH'},
-    {'x': 52.8564, 'y': -2.718, 'CRS': 'WEM'},
-    {'x': 52.304, 'y': -0.6764, 'CRS': 'WEL'},
-    {'x': 55.9048, 'y': -4.3351, 'CRS': 'WES'},
-    {'x': 53.923050, 'y': -1.581340, 'CRS': 'WET'},
-    {'x': 50.616, 'y': -2.455, 'CRS': 'WEY'},
-    {'x': 51.867, 'y': -0.187, 'CRS': 'KBW'},
-    {'x': 51.5099417, 'y': -0.4722639, 'CRS': 'WDT'},
-    {'x': 50.83194, 'y': -0.78222, 'CRS': 'CCH'},
-    {'x': 53.7479, 'y': -0.7300, 'CRS': 'GBD'},
-    {'x': 55.9047, 'y': -4.3630, 'CRS': 'DMC'},
-    {'x': 55.0728, 'y': -3.6045, 'CRS': 'DMF'},
-    {'x': 51.6174, 'y': -3.4371, 'CRS': 'DMG'},
-    {'x': 51.2490, 'y': -2.2079, 'CRS': 'DMH'},
-    {'x': 53.38600, 'y': -0.76914, 'CRS': 'GBL'},
-    {'x': 51.4683, 'y': -0.0894, 'CRS': 'DMK'},
-    {'x': 53.25139, 'y': -2.53389, 'CRS': 'GBK'},
-    {'x': 51.34583, 'y': 1.42583, 'CRS': 'DMP'},
-    {'x': 55.9120, 'y': -4.4270, 'CRS': 'DMR'},
-    {'x': 51.156, 'y': -0.004, 'CRS': 'DMS'},
-    {'x': 50.81778, 'y': -0.43250, 'CRS': 'GBS'},
-    {'x': 55.9046, 'y': -4.3854, 'CRS': 'DMY'},
-    {'x': 53.261, 'y': -1.913, 'CRS': 'BUX'},
-    {'x': 53.812, 'y': -1.578, 'CRS': 'BUY'},
-    {'x': 51.649, 'y': 0.682, 'CRS': 'NFA'},
-    {'x': 55.7805, 'y': -4.2623, 'CRS': 'BUS'},
-    {'x': 53.908160, 'y': -1.753500, 'CRS': 'BUW'},
-    {'x': 52.806, 'y': -1.642, 'CRS': 'BUT'},
-    {'x': 51.6336, 'y': 0.8120, 'CRS': 'BUU'},
-    {'x': 52.98306, 'y': -1.04167, 'CRS': 'BUJ'},
-    {'x': 52.3573, 'y': -2.948, 'CRS': 'BUK'},
-    {'x': 53.72670, 'y': -0.57700, 'CRS': 'BUH'},
-    {'x': 55.8169, 'y': -4.2030, 'CRS': 'BUI'},
-    {'x': 50.884, 'y': -1.305, 'CRS': 'BUO'},
-    {'x': 52.59306, 'y': -1.83889, 'CRS': 'BUL'},
-    {'x': 55.7972, 'y': -4.0867, 'CRS': 'BLT'},
-    {'x': 53.791, 'y': -2.258, 'CRS': 'BUB'},
-    {'x': 52.59734, 'y': 1.46852, 'CRS': 'BUC'},
-    {'x': 50.95306, 'y': -0.12750, 'CRS': 'BUG'},
-    {'x': 54.355, 'y': -2.766, 'CRS': 'BUD'},
-    {'x': 51.971, 'y': 0.769, 'CRS': 'BUE'},
-    {'x': 53.46194, 'y': -2.18028, 'CRS': 'BLV'},
-    {'x': 51.344, 'y': -0.1986, 'CRS': 'BLM'},
-    {'x': 52.130, 'y': -2.072, 'CRS': 'PSH'},
-    {'x': 51.43320, 'y': -2.60860, 'CRS': 'PSN'},
-    {'x': 53.349, 'y': -2.998, 'CRS': 'PSL'},
-    {'x': 51.4986, 'y': -0.2108, 'CRS': 'KPA'},
-    {'x': 53.7649, 'y': -2.9429, 'CRS': 'MOS'},
-    {'x': 51.3720528, 'y': -1.0356167, 'CRS': 'MOR'},
-    {'x': 51.3958, 'y': -0.2397, 'CRS': 'MOT'},
-    {'x': 57.5175, 'y': -4.4602, 'CRS': 'MOO'},
-    {'x': 56.4799, 'y': -2.8175, 'CRS': 'MON'},
-    {'x': 53.330, 'y': -2.333, 'CRS': 'MOB'},
-    {'x': 51.5186, 'y': -0.0886, 'CRS': 'MOG'},
-    {'x': 52.626, 'y': -1.610, 'CRS': 'PSW'},
-    {'x': 55.9529, 'y': -2.9750, 'CRS': 'PST'},
-    {'x': 50.753, 'y': -1.714, 'CRS': 'HNA'},
-    {'x': 55.9404, 'y': -4.8042, 'CRS': 'BCN'},
-    {'x': 51.3644944, 'y': 1.1178167, 'CRS': 'HNB'},
-    {'x': 51.377, 'y': 1.301, 'CRS': 'BCH'},
-    {'x': 51.825194, 'y': -1.3724111, 'CRS': 'HND'},
-    {'x': 53.597500, 'y': -2.840639, 'CRS': 'BCJ'},
-    {'x': 53.163, 'y': -3.056, 'CRS': 'BCK'},
-    {'x': 51.413, 'y': -0.752, 'CRS': 'BCE'},
-    {'x': 51.611, 'y': -0.644, 'CRS': 'BCF'},
-    {'x': 51.3621500, 'y': 0.7353361, 'CRS': 'KML'},
-    {'x': 55.6124, 'y': -4.4992, 'CRS': 'KMK'},
-    {'x': 52.291, 'y': -1.784, 'CRS': 'HNL'},
-    {'x': 53.605, 'y': -2.842, 'CRS': 'BCB'},
-    {'x': 52.092, 'y': -0.504, 'CRS': 'KMH'},
-    {'x': 51.011, 'y': 0.442, 'CRS': 'ETC'},
-    {'x': 51.297, 'y': 0.247, 'CRS': 'KMS'},
-    {'x': 51.4645, 'y': -0.0369, 'CRS': 'BCY'},
-    {'x': 55.7794, 'y': -4.0555, 'CRS': 'HNW'},
-    {'x': 51.4210, 'y': -0.4095, 'CRS': 'KMP'},
-    {'x': 53.3606, 'y': -2.8560, 'CRS': 'HNX'},
-    {'x': 51.594, 'y': -0.0704, 'CRS': 'BCV'},
-    {'x': 55.8567, 'y': -4.2240, 'CRS': 'BLG'},
-    {'x': 51.485, 'y': 0.413, 'CRS': 'ETL'},
-    {'x': 51.9035, 'y': -1.1500, 'CRS': 'BCS'},
-    {'x': 56.7653, 'y': -3.8496, 'CRS': 'BLA'},
-    {'x': 50.91700, 'y': -3.36012, 'CRS': 'TVP'},
-    {'x': 51.4187, 'y': -0.1362, 'CRS': 'SRC'},
-    {'x': 51.5422, 'y': -0.0033, 'CRS': 'SRA'},
-    {'x': 51.6098, 'y': -0.6079, 'CRS': 'SRG'},
-    {'x': 51.4675, 'y': -2.5661, 'CRS': 'SRD'},
-    {'x': 51.438, 'y': -0.1271, 'CRS': 'SRH'},
-    {'x': 52.444, 'y': -1.836, 'CRS': 'SRI'},
-    {'x': 53.375, 'y': -2.033, 'CRS': 'SRN'},
-    {'x': 53.325, 'y': -1.168, 'CRS': 'SRO'},
-    {'x': 52.403, 'y': -1.845, 'CRS': 'SRL'},
-    {'x': 51.5388, 'y': -3.5898, 'CRS': 'SRR'},
-    {'x': 51.3921, 'y': -0.0883, 'CRS': 'SRS'},
-    {'x': 51.4064, 'y': 0.0013, 'CRS': 'SRT'},
-    {'x': 51.5565, 'y': -0.3988, 'CRS': 'SRU'},
-    {'x': 51.531, 'y': 0.795, 'CRS': 'SRY'},
-    {'x': 52.809, 'y': -2.736, 'CRS': 'YRT'},
-    {'x': 52.1526, 'y': 1.0554, 'CRS': 'NMT'},
-    {'x': 52.2383, 'y': -0.9071, 'CRS': 'NMP'},
-    {'x': 53.365, 'y': -2.006, 'CRS': 'NMC'},
-    {'x': 53.360, 'y': -2.009, 'CRS': 'NMN'},
-    {'x': 52.2383, 'y': 0.4073, 'CRS': 'NMK'},
-    {'x': 51.5474, 'y': -3.5952, 'CRS': 'TDU'},
-    {'x': 52.396, 'y': -1.980, 'CRS': 'LOB'},
-    {'x': 55.1231, 'y': -3.3541, 'CRS': 'LOC'},
-    {'x': 51.5407, 'y': -0.0577, 'CRS': 'LOF'},
-    {'x': 53.724, 'y': -2.687, 'CRS': 'LOH'},
-    {'x': 50.3594, 'y': -4.45653, 'CRS': 'LOO'},
-    {'x': 55.4743, 'y': -4.6262, 'CRS': 'NOA'},
-    {'x': 50.40700, 'y': -4.66577, 'CRS': 'LOS'},
-    {'x': 53.00667, 'y': -0.99806, 'CRS': 'LOW'},
-    {'x': 53.573, 'y': -2.494, 'CRS': 'LOT'},
-    {'x': 51.4748, 'y': -0.147, 'CRS': 'QRB'},
-    {'x': 51.4736, 'y': -0.0573, 'CRS': 'QRP'},
-    {'x': 55.8890, 'y': -3.4332, 'CRS': 'KKN'},
-    {'x': 51.947, 'y': 1.255, 'CRS': 'HPQ'},
-    {'x': 52.3915, 'y': -2.912, 'CRS': 'HPT'},
-    {'x': 52.947, 'y': -1.146, 'CRS': 'NOT'},
-    {'x': 53.782, 'y': -2.317, 'CRS': 'HPN'},
-    {'x': 55.9203, 'y': -4.3199, 'CRS': 'HLF'},
-    {'x': 51.4501, 'y': -0.0456, 'CRS': 'HPA'},
-    {'x': 53.117, 'y': -3.037, 'CRS': 'HPE'},
-    {'x': 51.815, 'y': -0.352, 'CRS': 'HPD'},
-    {'x': 51.4430389, 'y': 0.3208833, 'CRS': 'EBD'},
-    {'x': 53.6607, 'y': -2.6718, 'CRS': 'EBA'},
-    {'x': 51.782, 'y': -3.206, 'CRS': 'EBB'},
-    {'x': 50.769, 'y': 0.281, 'CRS': 'EBN'},
-    {'x': 51.4379, 'y': -3.2061, 'CRS': 'EBK'},
-    {'x': 51.200, 'y': 0.067, 'CRS': 'EBT'},
-    {'x': 51.7567, 'y': -3.1961, 'CRS': 'EBV'},
-    {'x': 51.208, 'y': 0.061, 'CRS': 'EBR'},
-    {'x': 52.090, 'y': 1.318, 'CRS': 'WDB'},
-    {'x': 55.241, 'y': -1.616, 'CRS': 'WDD'},
-    {'x': 52.344, 'y': -1.845, 'CRS': 'WDE'},
-    {'x': 51.650, 'y': 0.607, 'CRS': 'WDF'},
-    {'x': 53.36382, 'y': -1.35753, 'CRS': 'WDH'},
-    {'x': 55.867, 'y': -3.9501, 'CRS': 'DRU'},
-    {'x': 53.5880, 'y': -1.5309, 'CRS': 'DRT'},
-    {'x': 53.696340, 'y': -2.104670, 'CRS': 'WDN'},
-    {'x': 51.3674, 'y': -0.117, 'CRS': 'WDO'},
-    {'x': 54.377, 'y': -3.443, 'CRS': 'DRI'},
-    {'x': 53.7568, 'y': -1.4430, 'CRS': 'WDS'},
-    {'x': 56.0051, 'y': -2.7854, 'CRS': 'DRM'},
-    {'x': 51.4409, 'y': -0.0906, 'CRS': 'WDU'},
-    {'x': 53.301278, 'y': -1.468944, 'CRS': 'DRO'},
-    {'x': 57.3199, 'y': -5.6915, 'CRS': 'DRN'},
-    {'x': 55.6561, 'y': -4.7096, 'CRS': 'KWN'},
-    {'x': 51.5165, 'y': -0.33, 'CRS': 'DRG'},
-    {'x': 54.00150, 'y': -0.43200, 'CRS': 'DRF'},
-    {'x': 52.471, 'y': -2.056, 'CRS': 'OHL'},
-    {'x': 51.4141, 'y': -0.0075, 'CRS': 'RVB'},
-    {'x': 53.675660, 'y': -1.655550, 'CRS': 'RVN'},
-    {'x': 51.219, 'y': -0.442, 'CRS': 'GOM'},
-    {'x': 53.668340, 'y': -1.752400, 'CRS': 'DHN'},
-    {'x': 53.705124, 'y': -0.872000, 'CRS': 'GOO'},
-    {'x': 52.931, 'y': -4.134, 'CRS': 'PTM'},
-    {'x': 55.8120, 'y': -4.3430, 'CRS': 'PTL'},
-    {'x': 55.8698, 'y': -4.3092, 'CRS': 'PTK'},
-    {'x': 55.8849, 'y': -4.3524, 'CRS': 'SCH'},
-    {'x': 56.3916, 'y': -3.4384, 'CRS': 'PTH'},
-    {'x': 51.5526, 'y': 0.0463, 'CRS': 'MNP'},
-    {'x': 51.779, 'y': -3.997, 'CRS': 'PTF'},
-    {'x': 53.395, 'y': -3.171, 'CRS': 'MNR'},
-    {'x': 52.484, 'y': -1.811, 'CRS': 'SCF'},
-    {'x': 54.279800, 'y': -0.405500, 'CRS': 'SCA'},
-    {'x': 51.7250, 'y': -3.3626, 'CRS': 'PTB'},
-    {'x': 51.592, 'y': -3.781, 'CRS': 'PTA'},
-    {'x': 51.3629, 'y': -0.0937, 'CRS': 'SCY'},
-    {'x': 53.89234, 'y': -1.73555, 'CRS': 'MNN'},
-    {'x': 53.58618, 'y': -0.65100, 'CRS': 'SCU'},
-    {'x': 58.4829, 'y': -3.5521, 'CRS': 'SCT'},
-    {'x': 55.7906, 'y': -4.3352, 'CRS': 'PTT'},
-    {'x': 51.007, 'y': -0.941, 'CRS': 'PTR'},
-    {'x': 50.62781, 'y': -3.44768, 'CRS': 'SCS'},
-    {'x': 50.39820, 'y': -4.94070, 'CRS': 'SCR'},
-    {'x': 51.697, 'y': -0.194, 'CRS': 'PBR'},
-    {'x': 51.684, 'y': -4.248, 'CRS': 'PBY'},
-    {'x': 53.591, 'y': -2.771, 'CRS': 'PBL'},
-    {'x': 52.5748, 'y': -0.2502, 'CRS': 'PBO'},
-    {'x': 52.8935, 'y': -3.0371, 'CRS': 'GOB'},
-    {'x': 52.544, 'y': -4.057, 'CRS': 'AVY'},
-    {'x': 53.401, 'y': -2.057, 'CRS': 'MPL'},
-    {'x': 51.8319, 'y': -0.8612, 'CRS': 'AVP'},
-    {'x': 55.8406, 'y': -4.3471, 'CRS': 'MPK'},
-    {'x': 57.1886, 'y': -3.8288, 'CRS': 'AVM'},
-    {'x': 55.1622, 'y': -1.6829, 'CRS': 'MPT'},
-    {'x': 51.3086, 'y': -0.078, 'CRS': 'UWL'},
-    {'x': 51.3395, 'y': -2.2821, 'CRS': 'AVF'},
-    {'x': 51.571, 'y': -0.766, 'CRS': 'MLW'},
-    {'x': 52.082, 'y': -3.687, 'CRS': 'SUG'},
-    {'x': 51.554, 'y': -0.3167, 'CRS': 'SUD'},
-    {'x': 51.3751, 'y': -0.1964, 'CRS': 'SUC'},
-    {'x': 51.3601, 'y': -0.1903, 'CRS': 'SUO'},
-    {'x': 54.906, 'y': -1.382, 'CRS': 'SUN'},
-    {'x': 55.8988, 'y': -4.2921, 'CRS': 'SUM'},
-    {'x': 51.4182, 'y': -0.4176, 'CRS': 'SUU'},
-    {'x': 52.564, 'y': -1.824, 'CRS': 'SUT'},
-    {'x': 51.3926, 'y': -0.3044, 'CRS': 'SUR'},
-    {'x': 51.4137, 'y': 0.0221, 'CRS': 'SUP'},
-    {'x': 52.036, 'y': 0.735, 'CRS': 'SUY'},
-    {'x': 51.398, 'y': -1.323, 'CRS': 'NBY'},
-    {'x': 51.67250, 'y': -4.70667, 'CRS': 'TEN'},
-    {'x': 51.692, 'y': -0.035, 'CRS': 'TEO'},
-    {'x': 54.5185, 'y': -1.4252, 'CRS': 'TEA'},
-    {'x': 51.4247, 'y': -0.3325, 'CRS': 'TED'},
-    {'x': 51.4124, 'y': -0.2838, 'CRS': 'NBT'},
-    {'x': 51.3333, 'y': 0.808, 'CRS': 'TEY'},
-    {'x': 53.437, 'y': -3.049, 'CRS': 'NBN'},
-    {'x': 51.4164, 'y': -0.0348, 'CRS': 'NBC'},
-    {'x': 51.6487, 'y': -0.1733, 'CRS': 'NBA'},
-    {'x': 51.6658083, 'y': -3.1428139, 'CRS': 'NBE'},
-    {'x': 51.212, 'y': -1.492, 'CRS': 'ADV'},
-    {'x': 55.8434, 'y': -3.6064, 'CRS': 'ADW'},
-    {'x': 51.2966, 'y': 0.1713, 'CRS': 'DNG'},
-    {'x': 55.8640, 'y': -3.9826, 'CRS': 'ADR'},
-    {'x': 55.6396, 'y': -4.8205, 'CRS': 'ADS'},
-    {'x': 52.595, 'y': -3.855, 'CRS': 'MCN'},
-    {'x': 51.579, 'y': -0.497, 'CRS': 'DNM'},
-    {'x': 55.7119, 'y': -4.5324, 'CRS': 'DNL'},
-    {'x': 57.9859, 'y': -3.9470, 'CRS': 'DNO'},
-    {'x': 53.50417, 'y': -2.18417, 'CRS': 'DNN'},
-    {'x': 51.5967, 'y': -3.6428, 'CRS': 'GMG'},
-    {'x': 53.574, 'y': -0.076, 'CRS': 'GMD'},
-    {'x': 54.282, 'y': -2.363, 'CRS': 'DNT'},
-    {'x': 52.483, 'y': -1.855, 'CRS': 'ADD'},
-    {'x': 53.320, 'y': -2.134, 'CRS': 'ADC'},
-    {'x': 51.4314, 'y': -3.2188, 'CRS': 'DNS'},
-    {'x': 55.6402, 'y': -4.8122, 'CRS': 'ADN'},
-    {'x': 53.613, 'y': -2.603, 'CRS': 'ADL'},
-    {'x': 51.2409, 'y': 1.1989, 'CRS': 'ADM'},
-    {'x': 54.466200, 'y': -0.911000, 'CRS': 'DNY'},
-    {'x': 53.4711, 'y': -2.2131, 'CRS': 'ADK'},
-    {'x': 54.436, 'y': -0.725, 'CRS': 'GMT'},
-    {'x': 51.3968, 'y': -3.2847, 'CRS': 'BRY'},
-    {'x': 51.4629, 'y': -0.1132, 'CRS': 'BRX'},
-    {'x': 53.3833, 'y': -2.9762, 'CRS': 'BRW'},
-    {'x': 52.427, 'y': -1.926, 'CRS': 'BRV'},
-    {'x': 51.11170, 'y': -2.44732, 'CRS': 'BRU'},
-    {'x': 52.943, 'y': -2.168, 'CRS': 'BRT'},
-    {'x': 51.3988, 'y': -0.2803, 'CRS': 'BRS'},
-    {'x': 55.8040, 'y': -4.3971, 'CRS': 'BRR'},
-    {'x': 52.3954, 'y': 1.5437, 'CRS': 'BRP'},
-    {'x': 56.5162, 'y': -4.7642, 'CRS': 'BRO'},
-    {'x': 55.9170, 'y': -4.3324, 'CRS': 'BRN'},
-    {'x': 52.723, 'y': -4.057, 'CRS': 'BRM'},
-    {'x': 55.0975, 'y': -4.7822, 'CRS': 'BRL'},
-    {'x': 50.840, 'y': 0.166, 'CRS': 'BRK'},
-    {'x': 51.449, 'y': -2.580, 'CRS': 'BRI'},
-    {'x': 52.491, 'y': -4.050, 'CRS': 'BRH'},
-    {'x': 51.29300, 'y': 0.30564, 'CRS': 'BRG'},
-    {'x': 53.825, 'y': -2.237, 'CRS': 'BRF'},
-    {'x': 51.6136, 'y': 0.3, 'CRS': 'BRE'},
-    {'x': 55.8275, 'y': -3.6675, 'CRS': 'BRC'},
-    {'x': 58.0131, 'y': -3.8523, 'CRS': 'BRA'},
-    {'x': 51.4504, 'y': -0.3296, 'CRS': 'TWI'},
-    {'x': 53.5430, 'y': -2.9044, 'CRS': 'TWN'},
-    {'x': 51.476, 'y': -0.863, 'CRS': 'TWY'},
-    {'x': 53.04143, 'y': -0.38050, 'CRS': 'RKT'},
-    {'x': 51.5147, 'y': -0.3017, 'CRS': 'EAL'},
-    {'x': 55.8343, 'y': -4.5032, 'CRS': 'JHN'},
-    {'x': 53.4319, 'y': -2.1341, 'CRS': 'BNT'},
-    {'x': 51.4424, 'y': -0.1877, 'CRS': 'EAD'},
-    {'x': 54.529, 'y': -1.349, 'CRS': 'EAG'},
-    {'x': 53.5301, 'y': -2.7090, 'CRS': 'ORR'},
-    {'x': 51.441, 'y': -0.918, 'CRS': 'EAR'},
-    {'x': 54.477760, 'y': -1.068100, 'CRS': 'KLD'},
-    {'x': 53.5201, 'y': -2.1467, 'CRS': 'HOD'},
-    {'x': 55.8599, 'y': -4.1066, 'CRS': 'EST'},
-    {'x': 51.604, 'y': 0.659, 'CRS': 'HOC'},
-    {'x': 50.797, 'y': -3.187, 'CRS': 'HON'},
-    {'x': 53.297, 'y': -2.977, 'CRS': 'HOO'},
-    {'x': 50.711, 'y': -2.078, 'CRS': 'HOL'},
-    {'x': 51.280, 'y': -0.962, 'CRS': 'HOK'},
-    {'x': 51.5794, 'y': -0.337, 'CRS': 'HOH'},
-    {'x': 50.83528, 'y': -0.17083, 'CRS': 'HOV'},
-    {'x': 53.764735, 'y': -0.860000, 'CRS': 'HOW'},
-    {'x': 51.534, 'y': -0.900, 'CRS': 'HOT'},
-    {'x': 51.462, 'y': -0.3622, 'CRS': 'HOU'},
-    {'x': 51.169, 'y': -0.161, 'CRS': 'HOR'},
-    {'x': 53.346, 'y': -1.729, 'CRS': 'HOP'},
-    {'x': 51.921, 'y': 0.228, 'CRS': 'ESM'},
-    {'x': 50.96944, 'y': -1.34944, 'CRS': 'ESL'},
-    {'x': 55.8106, 'y': -4.5625, 'CRS': 'HOZ'},
-    {'x': 51.3246, 'y': -0.1007, 'CRS': 'KLY'},
-    {'x': 54.515, 'y': -1.467, 'CRS': 'DND'},
-    {'x': 51.38, 'y': -0.3526, 'CRS': 'ESH'},
-    {'x': 53.485, 'y': -2.335, 'CRS': 'ECC'},
-    {'x': 55.9335, 'y': -4.6902, 'CRS': 'PTG'},
-    {'x': 51.4513972, 'y': 0.2639250, 'CRS': 'SCG'},
-    {'x': 51.775, 'y': 0.036, 'CRS': 'RYN'},
-    {'x': 51.7170, 'y': -4.0454, 'CRS': 'PTD'},
-    {'x': 51.769, 'y': 0.006, 'CRS': 'RYH'},
-    {'x': 55.8611, 'y': -4.2828, 'CRS': 'EXG'},
-    {'x': 50.84889, 'y': -1.12500, 'CRS': 'PTC'},
-    {'x': 50.733, 'y': -1.160, 'CRS': 'RYD'},
-    {'x': 50.952, 'y': 0.731, 'CRS': 'RYE'},
-    {'x': 56.8884, 'y': -4.8376, 'CRS': 'RYB'},
-    {'x': 50.724, 'y': -1.157, 'CRS': 'RYR'},
-    {'x': 52.053, 'y': -0.027, 'CRS': 'RYS'},
-    {'x': 50.739, 'y': -1.160, 'CRS': 'RYP'},
-    {'x': 53.406, 'y': -2.893, 'CRS': 'BGE'},
-    {'x': 50.897, 'y': -0.542, 'CRS': 'AMY'},
-    {'x': 51.734, 'y': -4.317, 'CRS': 'KWL'},
-    {'x': 54.712, 'y': -3.495, 'CRS': 'MRY'},
-    {'x': 50.66792, 'y': -3.44374, 'CRS': 'EXN'},
-    {'x': 56.8554, 'y': -5.1929, 'CRS': 'LHE'},
-    {'x': 51.299, 'y': -0.333, 'CRS': 'LHD'},
-    {'x': 53.281, 'y': -4.563, 'CRS': 'VAL'},
-    {'x': 53.805, 'y': -2.448, 'CRS': 'LHO'},
-    {'x': 54.460550, 'y': -0.825630, 'CRS': 'LHM'},
-    {'x': 55.7867, 'y': -4.6164, 'CRS': 'LHW'},
-    {'x': 55.5020, 'y': -4.6143, 'CRS': 'PTW'},
-    {'x': 51.5124, 'y': -0.0397, 'CRS': 'LHS'},
-    {'x': 51.853, 'y': -1.469, 'CRS': 'FIN'},
-    {'x': 54.20950, 'y': -0.29200, 'CRS': 'FIL'},
-    {'x': 56.2005, 'y': -3.1308, 'CRS': 'MNC'},
-    {'x': 52.498, 'y': 0.178, 'CRS': 'MNE'},
-    {'x': 51.949, 'y': 1.045, 'CRS': 'MNG'},
-    {'x': 56.0062, 'y': -3.8182, 'CRS': 'CMO'},
-    {'x': 51.853, 'y': -4.306, 'CRS': 'CMN'},
-    {'x': 55.8343, 'y': -4.1581, 'CRS': 'CML'},
-    {'x': 51.7011, 'y': -3.4144, 'CRS': 'CMH'},
-    {'x': 53.113, 'y': -1.549, 'CRS': 'CMF'},
-    {'x': 51.832, 'y': -1.393, 'CRS': 'CME'},
-    {'x': 51.5418, 'y': -0.1388, 'CRS': 'CMD'},
-    {'x': 55.8402, 'y': -4.4227, 'CRS': 'PCN'},
-    {'x': 53.36443, 'y': -1.81663, 'CRS': 'EDL'},
-    {'x': 55.8338, 'y': -4.2847, 'CRS': 'CMY'},
-    {'x': 52.9305, 'y': 1.2926, 'CRS': 'CMR'},
-    {'x': 51.5233, 'y': -3.5022, 'CRS': 'PCD'},
-    {'x': 53.4868, 'y': -2.9508, 'CRS': 'ORN'},
-    {'x': 51.381, 'y': 1.338, 'CRS': 'WGA'},
-    {'x': 51.801, 'y': -0.204, 'CRS': 'WGC'},
-    {'x': 53.5394, 'y': -2.5153, 'CRS': 'DSY'},
-    {'x': 55.8590, 'y': -4.2122, 'CRS': 'DST'},
-    {'x': 53.5430, 'y': -2.6320, 'CRS': 'WGN'},
-    {'x': 54.829, 'y': -3.164, 'CRS': 'WGT'},
-    {'x': 53.358, 'y': -2.042, 'CRS': 'DSL'},
-    {'x': 52.2730, 'y': 1.5236, 'CRS': 'DSM'},
-    {'x': 51.5487, 'y': 0.0454, 'CRS': 'WGR'},
-    {'x': 53.40917, 'y': -2.2218056, 'CRS': 'EDY'},
-    {'x': 55.9190, 'y': -3.5022, 'CRS': 'UHA'},
-    {'x': 51.6669528, 'y': 0.3839806, 'CRS': 'INT'},
-    {'x': 57.4800, 'y': -4.2230, 'CRS': 'INV'},
-    {'x': 55.9060, 'y': -4.8724, 'CRS': 'INP'},
-    {'x': 57.2867, 'y': -2.3737, 'CRS': 'INR'},
-    {'x': 57.3374, 'y': -2.6168, 'CRS': 'INS'},
-    {'x': 57.9249, 'y': -4.3995, 'CRS': 'INH'},
-    {'x': 56.0351, 'y': -3.3954, 'CRS': 'INK'},
-    {'x': 53.277, 'y': -2.816, 'CRS': 'INE'},
-    {'x': 56.4563, 'y': -3.0578, 'CRS': 'ING'},
-    {'x': 52.67250, 'y': -0.73444, 'CRS': 'OKM'},
-    {'x': 51.6379, 'y': -0.1667, 'CRS': 'OKL'},
-    {'x': 53.5391, 'y': -2.6126, 'CRS': 'INC'},
-    {'x': 53.70861, 'y': -1.34056, 'CRS': 'GLH'},
-    {'x': 53.5225, 'y': -1.1395, 'CRS': 'DON'},
-    {'x': 51.3865694, 'y': 0.5498861, 'CRS': 'GLM'},
-    {'x': 52.295, 'y': -3.264, 'CRS': 'DOL'},
-    {'x': 53.444, 'y': -1.949, 'CRS': 'GLO'},
-    {'x': 50.38246, 'y': -4.17609, 'CRS': 'DOC'},
-    {'x': 55.858, 'y': -4.258, 'CRS': 'GLC'},
-    {'x': 51.237, 'y': -0.580, 'CRS': 'GLD'},
-    {'x': 56.2750, 'y': -3.7310, 'CRS': 'GLE'},
-    {'x': 53.544160, 'y': -1.531950, 'CRS': 'DOD'},
-    {'x': 55.7389, 'y': -4.6752, 'CRS': 'GLG'},
-    {'x': 50.859, 'y': 0.070, 'CRS': 'GLY'},
-    {'x': 53.4282, 'y': -2.4598, 'CRS': 'GLZ'},
-    {'x': 53.327570, 'y': -1.515440, 'CRS': 'DOR'},
-    {'x': 55.8622, 'y': -4.2512, 'CRS': 'GLQ'},
-    {'x': 54.4394, 'y': -0.7939, 'CRS': 'GLS'},
-    {'x': 56.1623, 'y': -3.1426, 'CRS': 'GLT'},
-    {'x': 52.60560, 'y': 0.36724, 'CRS': 'DOW'},
-    {'x': 54.94972, 'y': -1.64139, 'CRS': 'DOT'},
-    {'x': 51.5451, 'y': -0.202, 'CRS': 'BSY'},
-    {'x': 55.9419, 'y': -3.1007, 'CRS': 'BSU'},
-    {'x': 53.674, 'y': -2.663, 'CRS': 'BSV'},
-    {'x': 52.483, 'y': -1.899, 'CRS': 'BSW'},
-    {'x': 51.5407, 'y': -0.2103, 'CRS': 'BSP'},
-    {'x': 51.36056, 'y': 1.43361, 'CRS': 'BSR'},
-    {'x': 55.5614, 'y': -4.6514, 'CRS': 'BSS'},
-    {'x': 53.222, 'y': -4.136, 'CRS': 'BNG'},
-    {'x': 50.728, 'y': -1.919, 'CRS': 'BSM'},
-    {'x': 52.978, 'y': -0.031, 'CRS': 'BSN'},
-    {'x': 51.5679, 'y': 0.4566, 'CRS': 'BSO'},
-    {'x': 51.644, 'y': -0.385, 'CRS': 'BSH'},
-    {'x': 56.4747, 'y': -2.8384, 'CRS': 'BSI'},
-    {'x': 52.1294, 'y': -0.4677, 'CRS': 'BSJ'},
-    {'x': 51.2683, 'y': -1.0878, 'CRS': 'BSK'},
-    {'x': 51.276, 'y': 0.578, 'CRS': 'BSD'},
-    {'x': 52.254, 'y': 0.713, 'CRS': 'BSE'},
-    {'x': 53.04167, 'y': -0.94333, 'CRS': 'BSB'},
-    {'x': 52.562, 'y': -1.991, 'CRS': 'BSC'},
-    {'x': 52.0045, 'y': 0.2073, 'CRS': 'AUD'},
-    {'x': 53.5542, 'y': -2.8953, 'CRS': 'AUG'},
-    {'x': 56.3019, 'y': -4.7217, 'CRS': 'AUI'},
-    {'x': 55.4698, 'y': -4.2955, 'CRS': 'AUK'},
-    {'x': 56.0549, 'y': -3.3005, 'CRS': 'AUR'},
-    {'x': 51.867, 'y': -1.564, 'CRS': 'AUW'},
-    {'x': 50.957, 'y': -0.517, 'CRS': 'PUL'},
-    {'x': 54.493, 'y': -3.591, 'CRS': 'SBS'},
-    {'x': 51.5441, 'y': -0.2754, 'CRS': 'SBP'},
-    {'x': 51.3469, 'y': -0.0987, 'CRS': 'PUO'},
-    {'x': 50.40210, 'y': -4.18765, 'CRS': 'SBV'},
-    {'x': 52.455, 'y': -2.142, 'CRS': 'SBT'},
-    {'x': 51.6484, 'y': -0.0530, 'CRS': 'SBU'},
-    {'x': 53.783000, 'y': -1.063440, 'CRS': 'SBY'},
-    {'x': 52.761, 'y': -0.886, 'CRS': 'MMO'},
-    {'x': 50.40141, 'y': -4.18680, 'CRS': 'SBF'},
-    {'x': 53.999004, 'y': -1.500653, 'CRS': 'SBE'},
-    {'x': 51.4611, 'y': -0.2162, 'CRS': 'PUT'},
-    {'x': 54.584, 'y': -1.177, 'CRS': 'SBK'},
-    {'x': 53.369568, 'y': -2.236635, 'CRS': 'HDG'},
-    {'x': 51.3377, 'y': -0.1135, 'CRS': 'PUR'},
-    {'x': 51.4878, 'y': -0.0544, 'CRS': 'SBM'},
-    {'x': 53.697426, 'y': -0.392933, 'CRS': 'BAV'},
-    {'x': 51.332, 'y': -0.777, 'CRS': 'BAW'},
-    {'x': 50.913, 'y': 0.495, 'CRS': 'BAT'},
-    {'x': 53.689, 'y': -0.443, 'CRS': 'BAU'},
-    {'x': 54.075, 'y': -2.836, 'CRS': 'BAR'},
-    {'x': 50.4863, 'y': -4.19982, 'CRS': 'BAS'},
-    {'x': 51.352, 'y': 0.445, 'CRS': 'HAI'},
-    {'x': 51.530746, 'y': -0.22479, 'CRS': 'KNL'},
-    {'x': 51.758, 'y': -0.096, 'CRS': 'BAY'},
-    {'x': 52.528, 'y': -1.839, 'CRS': 'ERD'},
-    {'x': 51.364, 'y': -0.689, 'CRS': 'BAG'},
-    {'x': 51.3292, 'y': -0.2132, 'CRS': 'BAD'},
-    {'x': 51.05611, 'y': -0.13750, 'CRS': 'BAB'},
-    {'x': 53.3077, 'y': -2.9813, 'CRS': 'ERA'},
-    {'x': 50.83111, 'y': -0.64056, 'CRS': 'BAA'},
-    {'x': 53.451, 'y': -2.638, 'CRS': 'ERL'},
-    {'x': 51.4426, 'y': -0.152, 'CRS': 'BAL'},
-    {'x': 53.3389, 'y': -1.6890, 'CRS': 'BAM'},
-    {'x': 51.61444, 'y': -3.80944, 'CRS': 'BAJ'},
-    {'x': 51.4779, 'y': -0.1477, 'CRS': 'BAK'},
-    {'x': 53.4376, 'y': -2.9875, 'CRS': 'BAH'},
-    {'x': 55.8665, 'y': -4.0427, 'CRS': 'BAI'},
-    {'x': 51.5001, 'y': -2.6992, 'CRS': 'AVN'},
-    {'x': 51.4671, 'y': -0.242, 'CRS': 'BNS'},
-    {'x': 53.60603, 'y': -0.26885, 'CRS': 'HAB'},
-    {'x': 51.745, 'y': -2.219, 'CRS': 'STD'},
-    {'x': 51.426, 'y': -0.1314, 'CRS': 'STE'},
-    {'x': 57.3523, 'y': -5.5509, 'CRS': 'STF'},
-    {'x': 52.2772, 'y': 0.4902, 'CRS': 'KNE'},
-    {'x': 52.80359, 'y': -2.12307, 'CRS': 'STA'},
-    {'x': 57.4228, 'y': -5.4286, 'CRS': 'STC'},
-    {'x': 51.506, 'y': -0.3783, 'CRS': 'STL'},
-    {'x': 53.4534, 'y': -2.9946, 'CRS': 'BNW'},
-    {'x': 56.9667, 'y': -2.2256, 'CRS': 'STN'},
-    {'x': 51.5802, 'y': -0.072, 'CRS': 'STO'},
-    {'x': 52.114, 'y': 0.031, 'CRS': 'STH'},
-    {'x': 51.5842, 'y': -2.7771, 'CRS': 'STJ'},
-    {'x': 54.5697, 'y': -1.3183, 'CRS': 'STK'},
-    {'x': 55.6821, 'y': -4.5181, 'CRS': 'STT'},
-    {'x': 51.301056, 'y': 1.12222, 'CRS': 'STU'},
-    {'x': 55.6343, 'y': -4.7499, 'CRS': 'STV'},
-    {'x': 51.4389, 'y': -0.3388, 'CRS': 'STW'},
-    {'x': 51.530, 'y': -0.125, 'CRS': 'STP'},
-    {'x': 54.9093, 'y': -5.0249, 'CRS': 'STR'},
-    {'x': 50.40719, 'y': -4.20924, 'CRS': 'STS'},
-    {'x': 52.422, 'y': -2.147, 'CRS': 'HAG'},
-    {'x': 53.08056, 'y': -0.81333, 'CRS': 'NCT'},
-    {'x': 51.4722, 'y': -0.2523, 'CRS': 'BNI'},
-    {'x': 52.681, 'y': -2.441, 'CRS': 'TFC'},
-    {'x': 55.4022, 'y': -4.1832, 'CRS': 'NCK'},
-    {'x': 54.9686, 'y': -1.6171, 'CRS': 'NCL'},
-    {'x': 51.276, 'y': -0.731, 'CRS': 'NCM'},
-    {'x': 53.574, 'y': -0.059, 'CRS': 'NCE'},
-    {'x': 53.5503, 'y': -2.3882, 'CRS': 'FNW'},
-    {'x': 53.349, 'y': -1.989, 'CRS': 'FNV'},
-    {'x': 50.786, 'y': -3.285, 'CRS': 'FNT'},
-    {'x': 51.401575, 'y': 0.236222, 'CRS': 'FNR'},
-    {'x': 53.720650, 'y': -1.853790, 'CRS': 'HFX'},
-    {'x': 55.9764, 'y': -3.5957, 'CRS': 'LIN'},
-    {'x': 51.194, 'y': 0.211, 'CRS': 'LIH'},
-    {'x': 51.5499, 'y': -0.1837, 'CRS': 'FNY'},
-    {'x': 50.81028, 'y': -0.54639, 'CRS': 'LIT'},
-    {'x': 53.794, 'y': -2.245, 'CRS': 'BNC'},
-    {'x': 53.4075, 'y': -2.9784, 'CRS': 'LIV'},
-    {'x': 51.197, 'y': -0.605, 'CRS': 'FNC'},
-    {'x': 51.297, 'y': -0.756, 'CRS': 'FNB'},
-    {'x': 51.044, 'y': -0.893, 'CRS': 'LIS'},
-    {'x': 51.302, 'y': -0.743, 'CRS': 'FNN'},
-    {'x': 51.5821, 'y': -0.3172, 'CRS': 'KNT'},
-    {'x': 51.212, 'y': -0.792, 'CRS': 'FNH'},
-    {'x': 55.8353, 'y': -4.2669, 'CRS': 'QPK'},
-    {'x': 51.2493, 'y': 0.4225, 'CRS': 'WTR'},
-    {'x': 52.360, 'y': -3.097, 'CRS': 'KNU'},
-    {'x': 52.512, 'y': -1.883, 'CRS': 'WTT'},
-    {'x': 51.764, 'y': -0.216, 'CRS': 'HAT'},
-    {'x': 55.8134, 'y': -4.3247, 'CRS': 'KNS'},
-    {'x': 55.9144, 'y': -3.2838, 'CRS': 'WTA'},
-    {'x': 54.485, 'y': -0.615, 'CRS': 'WTB'},
-    {'x': 52.9682, 'y': -2.6717, 'CRS': 'WTC'},
-    {'x': 50.854, 'y': -0.982, 'CRS': 'HAV'},
-    {'x': 52.67273, 'y': 0.38270, 'CRS': 'WTG'},
-    {'x': 54.553, 'y': -3.587, 'CRS': 'WTH'},
-    {'x': 51.437, 'y': -0.891, 'CRS': 'WTI'},
-    {'x': 51.818, 'y': -4.614, 'CRS': 'WTL'},
-    {'x': 51.5339, 'y': -0.2063, 'CRS': 'QPW'},
-    {'x': 51.4495, 'y': -0.3578, 'CRS': 'WTN'},
-    {'x': 52.518611, 'y': -1.743889, 'CRS': 'WTO'},
-    {'x': 51.4156417, 'y': 0.7497444, 'CRS': 'QBR'},
-    {'x': 51.5774, 'y': -0.0977, 'CRS': 'HRY'},
-    {'x': 51.538, 'y': 0.762, 'CRS': 'TPB'},
-    {'x': 51.6478, 'y': -3.4863, 'CRS': 'TPN'},
-    {'x': 51.5925, 'y': -0.3355, 'CRS': 'HRW'},
-    {'x': 53.8476, 'y': -1.6302, 'CRS': 'HRS'},
-    {'x': 54.613, 'y': -3.566, 'CRS': 'HRR'},
-    {'x': 51.245, 'y': 0.672, 'CRS': 'HRM'},
-    {'x': 52.861605, 'y': -4.109531, 'CRS': 'HRL'},
-    {'x': 51.5928, 'y': 0.2343, 'CRS': 'HRO'},
-    {'x': 51.5862, 'y': -0.1116, 'CRS': 'HRN'},
-    {'x': 51.066, 'y': -0.319, 'CRS': 'HRH'},
-    {'x': 52.45326, 'y': 0.90808, 'CRS': 'HRD'},
-    {'x': 51.7589, 'y': -3.2896, 'CRS': 'RHY'},
-    {'x': 51.5211, 'y': -3.2140, 'CRS': 'RHI'},
-    {'x': 51.3313, 'y': -0.1233, 'CRS': 'RHM'},
-    {'x': 53.318, 'y': -3.489, 'CRS': 'RHL'},
-    {'x': 53.235, 'y': -4.507, 'CRS': 'RHO'},
-    {'x': 54.2057, 'y': -2.3609, 'CRS': 'RHD'},
-    {'x': 51.6635, 'y': -0.3958, 'CRS': 'WFJ'},
-    {'x': 51.652597, 'y': -0.391812, 'CRS': 'WFH'},
-    {'x': 52.081, 'y': 1.166, 'CRS': 'WFI'},
-    {'x': 51.676, 'y': -0.390, 'CRS': 'WFN'},
-    {'x': 53.105, 'y': 0.235, 'CRS': 'WFL'},
-    {'x': 51.799, 'y': -0.092, 'CRS': 'HFN'},
-    {'x': 55.8539, 'y': -4.0188, 'CRS': 'WFF'},
-    {'x': 51.6467, 'y': -0.4083, 'CRS': 'WFS'},
-    {'x': 51.6485, 'y': -0.4143, 'CRS': 'WFW'},
-    {'x': 55.9704, 'y': -4.5863, 'CRS': 'RTN'},
-    {'x': 52.0614, 'y': -2.7083, 'CRS': 'HFD'},
-    {'x': 51.3853, 'y': 0.5109, 'CRS': 'RTR'},
-    {'x': 51.6529, 'y': -0.0908, 'CRS': 'ENC'},
-    {'x': 51.6516, 'y': -0.0792, 'CRS': 'ENF'},
-    {'x': 51.258, 'y': -0.005, 'CRS': 'OXT'},
-    {'x': 53.373, 'y': -3.011, 'CRS': 'RFY'},
-    {'x': 51.6709, 'y': -0.0284, 'CRS': 'ENL'},
-    {'x': 51.336, 'y': -0.362, 'CRS': 'OXS'},
-    {'x': 54.305, 'y': -2.722, 'CRS': 'OXN'},
-    {'x': 53.656, 'y': -2.415, 'CRS': 'ENT'},
-    {'x': 51.582, 'y': 0.702, 'CRS': 'RFD'},
-    {'x': 51.7534, 'y': -1.2703, 'CRS': 'OXF'},
-    {'x': 52.2315, 'y': -2.1920, 'CRS': 'WOS'},
-    {'x': 52.5708, 'y': -1.2032, 'CRS': 'NBR'},
-    {'x': 52.5424, 'y': 1.1353, 'CRS': 'ATB'},
-    {'x': 53.529, 'y': -2.479, 'CRS': 'ATN'},
-    {'x': 56.0566, 'y': -2.7310, 'CRS': 'NBW'},
-    {'x': 52.51428, 'y': 1.02119, 'CRS': 'ATL'},
-    {'x': 51.826, 'y': -1.238, 'CRS': 'ISP'},
-    {'x': 52.579, 'y': -1.553, 'CRS': 'ATH'},
-    {'x': 57.3945, 'y': -5.4553, 'CRS': 'ATT'},
-    {'x': 51.4749, 'y': -0.337, 'CRS': 'ISL'},
-    {'x': 51.27639, 'y': 0.18167, 'CRS': 'SEV'},
-    {'x': 54.0670, 'y': -2.2808, 'CRS': 'SET'},
-    {'x': 53.5948, 'y': -1.2854, 'CRS': 'SES'},
-    {'x': 50.17140, 'y': -5.44374, 'CRS': 'SER'},
-    {'x': 51.2772111, 'y': 0.9411056, 'CRS': 'SEG'},
-    {'x': 50.773, 'y': 0.100, 'CRS': 'SEF'},
-    {'x': 50.83056, 'y': 0.03056, 'CRS': 'SEE'},
-    {'x': 52.149, 'y': 0.140, 'CRS': 'SED'},
-    {'x': 54.658, 'y': -1.200, 'CRS': 'SEC'},
-    {'x': 54.837, 'y': -1.341, 'CRS': 'SEA'},
-    {'x': 52.639, 'y': -1.844, 'CRS': 'SEN'},
-    {'x': 54.24058, 'y': -0.41707, 'CRS': 'SEM'},
-    {'x': 54.417, 'y': -3.510, 'CRS': 'SEL'},
-    {'x': 51.332, 'y': 0.189, 'CRS': 'SEH'},
-    {'x': 50.839, 'y': 0.458, 'CRS': 'CLL'},
-    {'x': 52.696, 'y': -4.049, 'CRS': 'FRB'},
-    {'x': 53.462300, 'y': -1.466250, 'CRS': 'CLN'},
-    {'x': 53.87389, 'y': -2.39417, 'CRS': 'CLH'},
-    {'x': 53.471, 'y': -2.145, 'CRS': 'FRF'},
-    {'x': 51.4646, 'y': -0.1705, 'CRS': 'CLJ'},
-    {'x': 51.4085, 'y': -0.0410, 'CRS': 'CLK'},
-    {'x': 51.3565, 'y': 0.1076, 'CRS': 'CLD'},
-    {'x': 53.562, 'y': -0.029, 'CRS': 'CLE'},
-    {'x': 51.838, 'y': 1.243, 'CRS': 'FRI'},
-    {'x': 51.361, 'y': -0.348, 'CRS': 'CLG'},
-    {'x': 51.2263, 'y': -2.3107, 'CRS': 'FRO'},
-    {'x': 57.7780, 'y': -3.9940, 'CRS': 'FRN'},
-    {'x': 50.852934, 'y': -1.191898, 'CRS': 'FRM'},
-    {'x': 55.7515, 'y': -4.8532, 'CRS': 'FRL'},
-    {'x': 58.3568, 'y': -3.8971, 'CRS': 'FRS'},
-    {'x': 51.4940, 'y': -3.2339, 'CRS': 'FRW'},
-    {'x': 53.340, 'y': -1.944, 'CRS': 'CLY'},
-    {'x': 51.47517, 'y': -0.18281, 'CRS': 'IMW'},
-    {'x': 51.104028, 'y': 0.29444, 'CRS': 'FRT'},
-    {'x': 51.7936, 'y': 1.1541, 'CRS': 'CLT'},
-    {'x': 55.73115, 'y': -3.8489, 'CRS': 'CLU'},
-    {'x': 52.2771, 'y': -1.6965, 'CRS': 'CLV'},
-    {'x': 51.6542, 'y': -0.5183, 'CRS': 'CLW'},
-    {'x': 51.4658, 'y': -0.1328, 'CRS': 'CLP'},
-    {'x': 51.852, 'y': -4.884, 'CRS': 'CLR'},
-    {'x': 54.855, 'y': -1.578, 'CRS': 'CLS'},
-    {'x': 53.526, 'y': -1.623, 'CRS': 'PNS'},
-    {'x': 51.5656, 'y': -1.7854, 'CRS': 'SWI'},
-    {'x': 50.83250, 'y': -0.23694, 'CRS': 'SWK'},
-    {'x': 53.7879, 'y': -3.0540, 'CRS': 'BPB'},
-    {'x': 51.449120, 'y': 0.309867, 'CRS': 'SWM'},
-    {'x': 51.3893083, 'y': 0.7472611, 'CRS': 'SWL'},
-    {'x': 51.215, 'y': 1.214, 'CRS': 'SWO'},
-    {'x': 53.4863, 'y': -1.3058, 'CRS': 'SWN'},
-    {'x': 51.6253, 'y': -3.9409, 'CRS': 'SWA'},
-    {'x': 51.721, 'y': -0.205, 'CRS': 'BPK'},
-    {'x': 52.96969, 'y': -0.18725, 'CRS': 'SWE'},
-    {'x': 53.16935, 'y': -0.70274, 'CRS': 'SWD'},
-    {'x': 50.9411, 'y': -1.3765, 'CRS': 'SWG'},
-    {'x': 53.8218, 'y': -3.0493, 'CRS': 'BPN'},
-    {'x': 50.785, 'y': -1.610, 'CRS': 'SWY'},
-    {'x': 53.7983, 'y': -3.0488, 'CRS': 'BPS'},
-    {'x': 55.9024, 'y': -4.5009, 'CRS': 'BPT'},
-    {'x': 51.51360, 'y': -2.54270, 'CRS': 'BPW'},
-    {'x': 52.5824, 'y': -1.1339, 'CRS': 'SWS'},
-    {'x': 52.069, 'y': -0.521, 'CRS': 'SWR'},
-    {'x': 53.623800, 'y': -1.881480, 'CRS': 'SWT'},
-    {'x': 51.704, 'y': -0.709, 'CRS': 'GMN'},
-    {'x': 51.5217, 'y': -3.1971, 'CRS': 'TGS'},
-    {'x': 52.6118, 'y': 1.7207, 'CRS': 'GYM'},
-    {'x': 54.533330, 'y': -1.180360, 'CRS': 'GYP'},
-    {'x': 50.54814, 'y': -3.49452, 'CRS': 'TGM'},
-    {'x': 52.0538, 'y': -0.5338, 'CRS': 'MLB'},
-    {'x': 57.9712, 'y': -3.9874, 'CRS': 'GOL'},
-    {'x': 54.7798, 'y': -1.5815, 'CRS': 'DHM'},
-    {'x': 51.163, 'y': -0.637, 'CRS': 'MLF'},
-    {'x': 57.0056, 'y': -5.8302, 'CRS': 'MLG'},
-    {'x': 53.232, 'y': -2.732, 'CRS': 'MLD'},
-    {'x': 53.533620, 'y': -1.313040, 'CRS': 'GOE'},
-    {'x': 51.187, 'y': -0.619, 'CRS': 'GOD'},
-    {'x': 53.735, 'y': -2.502, 'CRS': 'MLH'},
-    {'x': 56.4980, 'y': -2.7200, 'CRS': 'GOF'},
-    {'x': 55.9412, 'y': -4.3145, 'CRS': 'MLN'},
-    {'x': 54.211, 'y': -3.271, 'CRS': 'MLM'},
-    {'x': 53.6080, 'y': -2.1117, 'CRS': 'MLR'},
-    {'x': 53.67668, 'y': -0.33734, 'CRS': 'GOX'},
-    {'x': 54.132, 'y': -0.797, 'CRS': 'MLT'},
-    {'x': 53.750, 'y': -1.591, 'CRS': 'MLY'},
-    {'x': 52.903, 'y': -4.339, 'CRS': 'PNC'},
-    {'x': 54.195, 'y': -2.903, 'CRS': 'GOS'},
-    {'x': 51.5220000, 'y': -1.1335000, 'CRS': 'GOR'},
-    {'x': 57.5803, 'y': -3.8716, 'CRS': 'NRN'},
-    {'x': 51.398, 'y': -1.308, 'CRS': 'NRC'},
-    {'x': 51.4114, 'y': -0.1214, 'CRS': 'NRB'},
-    {'x': 51.5655, 'y': 0.1109, 'CRS': 'GMY'},
-    {'x': 54.5356, 'y': -1.5538, 'CRS': 'NRD'},
-    {'x': 51.40222, 'y': -1.13667, 'CRS': 'AMT'},
-    {'x': 52.627, 'y': 1.307, 'CRS': 'NRW'},
-    {'x': 54.457, 'y': -3.566, 'CRS': 'NRT'},
-    {'x': 51.236, 'y': -0.340, 'CRS': 'DKT'},
-    {'x': 53.5498, 'y': -2.1016, 'CRS': 'DKR'},
-    {'x': 50.46126, 'y': -3.54310, 'CRS': 'TQY'},
-    {'x': 53.275, 'y': -2.771, 'CRS': 'HSB'},
-    {'x': 53.597, 'y': -2.804, 'CRS': 'HSC'},
-    {'x': 53.326, 'y': -1.651, 'CRS': 'HSG'},
-    {'x': 52.530, 'y': -1.928, 'CRS': 'HSD'},
-    {'x': 50.92500, 'y': -0.14583, 'CRS': 'HSK'},
-    {'x': 53.764, 'y': -2.420, 'CRS': 'RIS'},
-    {'x': 51.089, 'y': -0.719, 'CRS': 'HSL'},
-    {'x': 52.109, 'y': -2.318, 'CRS': 'GMV'},
-    {'x': 53.4576, 'y': -2.9628, 'CRS': 'RIL'},
-    {'x': 53.330, 'y': -3.074, 'CRS': 'HSW'},
-    {'x': 55.8594, 'y': -4.2400, 'CRS': 'HST'},
-    {'x': 53.781702, 'y': -0.406376, 'CRS': 'CGM'},
-    {'x': 52.026, 'y': -0.595, 'CRS': 'RID'},
-    {'x': 51.279, 'y': -0.435, 'CRS': 'HSY'},
-    {'x': 51.64027, 'y': -0.47333, 'CRS': 'RIC'},
-    {'x': 51.3872, 'y': -3.3489, 'CRS': 'RIA'},
-    {'x': 52.413, 'y': -1.934, 'CRS': 'KNN'},
-    {'x': 53.7065, 'y': -1.2590, 'CRS': 'KNO'},
-    {'x': 53.554080, 'y': -1.477590, 'CRS': 'BNY'},
-    {'x': 53.37889, 'y': -2.34750, 'CRS': 'HAL'},
-    {'x': 50.72500, 'y': -2.01944, 'CRS': 'HAM'},
-    {'x': 51.5116, 'y': -0.3389, 'CRS': 'HAN'},
-    {'x': 52.345, 'y': -3.042, 'CRS': 'KNI'},
-    {'x': 53.30194, 'y': -2.37167, 'CRS': 'KNF'},
-    {'x': 51.4127, 'y': -0.3012, 'CRS': 'KNG'},
-    {'x': 51.295, 'y': -0.211, 'CRS': 'KND'},
-    {'x': 51.074, 'y': -4.063, 'CRS': 'BNP'},
-    {'x': 52.52887, 'y': 1.62239, 'CRS': 'HAD'},
-    {'x': 56.8439, 'y': -5.0960, 'CRS': 'BNV'},
-    {'x': 51.458, 'y': -0.445, 'CRS': 'HAF'},
-    {'x': 54.0090, 'y': -1.4703, 'CRS': 'KNA'},
-    {'x': 51.502, 'y': -0.4201, 'CRS': 'HAY'},
-    {'x': 53.3777, 'y': -2.1226, 'CRS': 'HAZ'},
-    {'x': 51.4648, 'y': 0.1595, 'CRS': 'BNH'},
-    {'x': 51.524, 'y': -0.646, 'CRS': 'BNM'},
-    {'x': 55.8778, 'y': -4.2235, 'CRS': 'BNL'},
-    {'x': 51.7797472, 'y': 0.5917528, 'CRS': 'HAP'},
-    {'x': 53.42194, 'y': -2.21528, 'CRS': 'BNA'},
-    {'x': 52.347, 'y': 1.506, 'CRS': 'HAS'},
-    {'x': 51.5342, 'y': -0.2208, 'CRS': 'KNR'},
-    {'x': 51.638, 'y': -3.819, 'CRS': 'BNF'},
-    {'x': 51.577, 'y': -0.710, 'CRS': 'BNE'},
-    {'x': 52.4539, 'y': 0.6243, 'CRS': 'BND'},
-    {'x': 53.4841, 'y': -2.0647, 'CRS': 'SYB'},
-    {'x': 53.348, 'y': -2.240, 'CRS': 'SYA'},
-    {'x': 50.777, 'y': -3.726, 'CRS': 'YEO'},
-    {'x': 51.4254, 'y': -0.0544, 'CRS': 'SYD'},
-    {'x': 51.4326, 'y': -0.0802, 'CRS': 'SYH'},
-    {'x': 51.4818, 'y': -0.3248, 'CRS': 'SYL'},
-    {'x': 52.6941667, 'y': -1.0825000, 'CRS': 'SYS'},
-    {'x': 52.5102, 'y': 1.6522, 'CRS': 'SYT'},
-    {'x': 50.8958, 'y': -2.5738, 'CRS': 'YET'},
-    {'x': 52.8625, 'y': -1.2632, 'CRS': 'EMD'},
-    {'x': 52.754, 'y': -1.937, 'CRS': 'RGT'},
-    {'x': 53.780, 'y': -2.479, 'CRS': 'RGW'},
-    {'x': 51.286, 'y': 0.439, 'CRS': 'EML'},
-    {'x': 51.5687, 'y': 0.2204, 'CRS': 'EMP'},
-    {'x': 50.85167, 'y': -0.93861, 'CRS': 'EMS'},
-    {'x': 52.770, 'y': -1.930, 'CRS': 'RGL'},
-    {'x': 52.836224, 'y': -4.123671, 'CRS': 'LDN'},
-    {'x': 53.794, 'y': -1.547, 'CRS': 'LDS'},
-    {'x': 56.2739, 'y': -3.1215, 'CRS': 'LDY'},
-    {'x': 57.6097, 'y': -3.6258, 'CRS': 'FOR'},
-    {'x': 54.259, 'y': -3.216, 'CRS': 'FOX'},
-    {'x': 50.82944, 'y': -0.57861, 'CRS': 'FOD'},
-    {'x': 51.5494, 'y': 0.0242, 'CRS': 'FOG'},
-    {'x': 56.3940, 'y': -5.1126, 'CRS': 'FOC'},
-    {'x': 51.439, 'y': -0.053, 'CRS': 'FOH'},
-    {'x': 52.58000, 'y': -1.82806, 'CRS': 'FOK'},
-    {'x': 52.266, 'y': -1.785, 'CRS': 'WWW'},
-    {'x': 51.47, 'y': -0.1384, 'CRS': 'WWR'},
-    {'x': 51.0705, 'y': -1.8055, 'CRS': 'SAL'},
-    {'x': 51.4913, 'y': 0.0536, 'CRS': 'WWD'},
-    {'x': 51.490, 'y': 0.069, 'CRS': 'WWA'},
-    {'x': 50.711, 'y': -1.155, 'CRS': 'SAB'},
-    {'x': 53.28000, 'y': -1.20056, 'CRS': 'WWL'},
-    {'x': 50.81833, 'y': -0.39278, 'CRS': 'WWO'},
-    {'x': 51.3813, 'y': -0.0145, 'CRS': 'WWI'},
-    {'x': 50.814, 'y': -3.752, 'CRS': 'COP'},
-    {'x': 52.6448, 'y': -2.3, 'CRS': 'COS'},
-    {'x': 52.489, 'y': -0.688, 'CRS': 'COR'},
-    {'x': 53.7679, 'y': -1.5876, 'CRS': 'COT'},
-    {'x': 56.1120, 'y': -3.3431, 'CRS': 'COW'},
-    {'x': 52.400874, 'y': -1.514053, 'CRS': 'COV'},
-    {'x': 51.3889, 'y': 0.0742, 'CRS': 'PET'},
-    {'x': 50.81583, 'y': 0.32475, 'CRS': 'PEV'},
-    {'x': 51.342, 'y': -1.771, 'CRS': 'PEW'},
-    {'x': 53.925, 'y': -1.822, 'CRS': 'ILK'},
-    {'x': 51.6702, 'y': -3.3601, 'CRS': 'PER'},
-    {'x': 52.830248, 'y': -4.110966, 'CRS': 'PES'},
-    {'x': 55.8644, 'y': -4.0050, 'CRS': 'COA'},
-    {'x': 53.5306, 'y': -2.6692, 'CRS': 'PEM'},
-    {'x': 51.4355, 'y': -3.1745, 'CRS': 'PEN'},
-    {'x': 50.833, 'y': 0.427, 'CRS': 'COB'},
-    {'x': 50.4449, 'y': -4.48109, 'CRS': 'COE'},
-    {'x': 55.8333, 'y': -4.2568, 'CRS': 'COI'},
-    {'x': 51.046, 'y': 0.188, 'CRS': 'COH'},
-    {'x': 55.178, 'y': -1.644, 'CRS': 'PEG'},
-    {'x': 54.4818, 'y': -0.9750, 'CRS': 'COM'},
-    {'x': 52.89728, 'y': -1.47285, 'CRS': 'PEA'},
-    {'x': 51.557, 'y': -0.722, 'CRS': 'COO'},
-    {'x': 56.4524, 'y': -5.3834, 'CRS': 'CON'},
-    {'x': 51.3934, 'y': 0.1690, 'CRS': 'SAY'},
-    {'x': 53.4562, 'y': -2.9661, 'CRS': 'WAO'},
-    {'x': 51.245, 'y': -0.668, 'CRS': 'WAN'},
-    {'x': 51.203, 'y': 1.383, 'CRS': 'WAM'},
-    {'x': 51.3728, 'y': -0.4143, 'CRS': 'WAL'},
-    {'x': 55.9405, 'y': -3.0147, 'CRS': 'WAF'},
-    {'x': 51.5037, 'y': -0.111, 'CRS': 'WAE'},
-    {'x': 51.073, 'y': 0.313, 'CRS': 'WAD'},
-    {'x': 53.3918, 'y': -2.5930, 'CRS': 'WAC'},
-    {'x': 51.757, 'y': -4.996, 'CRS': 'JOH'},
-    {'x': 53.406, 'y': -2.924, 'CRS': 'WAV'},
-    {'x': 51.5031, 'y': -0.1132, 'CRS': 'WAT'},
-    {'x': 51.8569, 'y': -0.1198, 'CRS': 'WAS'},
-    {'x': 51.808, 'y': -0.029, 'CRS': 'WAR'},
-    {'x': 53.339, 'y': -2.739, 'CRS': 'RUN'},
-    {'x': 51.814, 'y': 0.16, 'CRS': 'SAW'},
-    {'x': 52.987176, 'y': -3.043363, 'CRS': 'RUA'},
-    {'x': 53.635, 'y': -2.807, 'CRS': 'RUF'},
-    {'x': 52.379, 'y': -1.250, 'CRS': 'RUG'},
-    {'x': 53.327, 'y': -2.665, 'CRS': 'RUE'},
-    {'x': 54.470, 'y': -0.628, 'CRS': 'RUS'},
-    {'x': 55.8312, 'y': -4.2136, 'CRS': 'RUT'},
-    {'x': 54.24442, 'y': -3.24553, 'CRS': 'GNR'},
-    {'x': 57.5942, 'y': -4.4222, 'CRS': 'DIN'},
-    {'x': 52.035, 'y': -0.773, 'CRS': 'MKC'},
-    {'x': 51.4781, 'y': -0.014, 'CRS': 'GNW'},
-    {'x': 52.866, 'y': 1.349, 'CRS': 'GNT'},
-    {'x': 51.61197, 'y': -1.24348, 'CRS': 'DID'},
-    {'x': 51.3798, 'y': -2.1446, 'CRS': 'MKM'},
-    {'x': 50.71406, 'y': -3.47354, 'CRS': 'DIG'},
-    {'x': 55.782331, 'y': -3.994509, 'CRS': 'AIR'},
-    {'x': 53.3990, 'y': -0.7696, 'CRS': 'GNB'},
-    {'x': 53.4740, 'y': -2.9563, 'CRS': 'AIN'},
-    {'x': 53.5388, 'y': -2.0142, 'CRS': 'GNF'},
-    {'x': 53.384, 'y': -0.337, 'CRS': 'MKR'},
-    {'x': 53.3647, 'y': -2.9268, 'CRS': 'AIG'},
-    {'x': 53.383, 'y': -3.016, 'CRS': 'GNL'},
-    {'x': 52.374, 'y': 1.124, 'CRS': 'DIS'},
-    {'x': 51.4656, 'y': -0.2865, 'CRS': 'NSH'},
-    {'x': 56.1349, 'y': -3.3135, 'CRS': 'LCG'},
-    {'x': 50.826, 'y': 0.389, 'CRS': 'NSB'},
-    {'x': 53.0700, 'y': -1.2219, 'CRS': 'NSD'},
-    {'x': 51.6142, 'y': -0.1432, 'CRS': 'NSG'},
-    {'x': 53.408, 'y': -3.113, 'CRS': 'MRT'},
-    {'x': 53.594920, 'y': -1.304970, 'CRS': 'MRP'},
-    {'x': 55.6116, 'y': -4.6750, 'CRS': 'IRV'},
-    {'x': 51.7363806, 'y': 0.4688167, 'CRS': 'CHM'},
-    {'x': 53.4343, 'y': -2.4341, 'CRS': 'IRL'},
-    {'x': 51.703, 'y': -0.024, 'CRS': 'CHN'},
-    {'x': 52.8968, 'y': -1.8575, 'CRS': 'UTT'},
-    {'x': 51.5695000, 'y': -1.1579000, 'CRS': 'CHO'},
-    {'x': 55.8239, 'y': -4.3014, 'CRS': 'PWW'},
-    {'x': 51.270, 'y': 1.343, 'CRS': 'SDW'},
-    {'x': 50.3872, 'y': -4.46481, 'CRS': 'SDP'},
-    {'x': 51.676, 'y': -0.825, 'CRS': 'SDR'},
-    {'x': 51.175, 'y': 0.493, 'CRS': 'MRN'},
-    {'x': 51.5258, 'y': -2.5623, 'CRS': 'PWY'},
-    {'x': 51.5112, 'y': -0.0569, 'CRS': 'SDE'},
-    {'x': 51.722, 'y': -4.717, 'CRS': 'SDF'},
-    {'x': 55.8248, 'y': -4.2872, 'CRS': 'PWE'},
-    {'x': 51.330, 'y': 0.448, 'CRS': 'SDA'},
-    {'x': 53.150, 'y': -2.394, 'CRS': 'SDB'},
-    {'x': 51.5234, 'y': -0.0768, 'CRS': 'SDC'},
-    {'x': 53.4300, 'y': -2.9917, 'CRS': 'SDL'},
-    {'x': 55.7774, 'y': -3.9578, 'CRS': 'SDM'},
-    {'x': 52.888, 'y': -4.417, 'CRS': 'PWL'},
-    {'x': 51.5589, 'y': -0.3358, 'CRS': 'SDH'},
-    {'x': 51.265, 'y': 0.628, 'CRS': 'HBN'},
-    {'x': 51.6078, 'y': -0.1209, 'CRS': 'BOP'},
-    {'x': 53.7377, 'y': -2.0088, 'CRS': 'HBD'},
-    {'x': 53.204, 'y': -4.418, 'CRS': 'BOR'},
-    {'x': 53.4468, 'y': -2.9957, 'CRS': 'BOT'},
-    {'x': 51.334, 'y': -0.269, 'CRS': 'EPS'},
-    {'x': 52.97540, 'y': -0.11010, 'CRS': 'HBB'},
-    {'x': 50.84278, 'y': -0.84722, 'CRS': 'BOH'},
-    {'x': 50.832, 'y': -3.776, 'CRS': 'MRD'},
-    {'x': 53.3908, 'y': -2.1523, 'CRS': 'DVN'},
-    {'x': 52.334, 'y': -2.221, 'CRS': 'HBY'},
-    {'x': 53.3218, 'y': -2.9869, 'CRS': 'BOM'},
-    {'x': 51.4944, 'y': -0.0998, 'CRS': 'EPH'},
-    {'x': 51.3448, 'y': -2.2527, 'CRS': 'BOA'},
-    {'x': 51.3237, 'y': -0.2389, 'CRS': 'EPD'},
-    {'x': 54.290, 'y': -3.395, 'CRS': 'BOC'},
-    {'x': 50.4458, 'y': -4.6630, 'CRS': 'BOD'},
-    {'x': 53.979900, 'y': -1.526950, 'CRS': 'HBP'},
-    {'x': 50.787, 'y': -0.676, 'CRS': 'BOG'},
-    {'x': 50.761, 'y': -1.537, 'CRS': 'LYT'},
-    {'x': 50.758, 'y': -1.529, 'CRS': 'LYP'},
-    {'x': 50.8342, 'y': -0.2189, 'CRS': 'FSG'},
-    {'x': 51.715, 'y': -2.531, 'CRS': 'LYD'},
-    {'x': 52.46000, 'y': -2.11556, 'CRS': 'LYE'},
-    {'x': 50.6625, 'y': -3.4410, 'CRS': 'LYC'},
-    {'x': 50.64884, 'y': -3.43166, 'CRS': 'LYM'},
-    {'x': 54.375, 'y': -2.819, 'CRS': 'SVL'},
-    {'x': 53.06056, 'y': -0.91194, 'CRS': 'FSK'},
-    {'x': 50.9445, 'y': -2.6134, 'CRS': 'YVP'},
-    {'x': 51.5635, 'y': 0.0969, 'CRS': 'SVK'},
-    {'x': 51.902, 'y': -0.207, 'CRS': 'SVG'},
-    {'x': 51.5598, 'y': -2.6642, 'CRS': 'SVB'},
-    {'x': 53.170, 'y': -2.804, 'CRS': 'SVR'},
-    {'x': 51.582222, 'y': -0.075278, 'CRS': 'SVS'},
-    {'x': 50.9247, 'y': -2.6132, 'CRS': 'YVJ'},
-    {'x': 51.51167, 'y': -0.07881, 'CRS': 'FST'},
-    {'x': 55.9465, 'y': -4.5673, 'CRS': 'DBC'},
-    {'x': 51.967, 'y': 1.350, 'CRS': 'FLX'},
-    {'x': 53.3503, 'y': -2.1345, 'CRS': 'PYT'},
-    {'x': 53.5104, 'y': -2.1634, 'CRS': 'FLS'},
-    {'x': 50.6463, 'y': -1.1664, 'CRS': 'LKE'},
-    {'x': 52.004, 'y': -0.495, 'CRS': 'FLT'},
-    {'x': 51.4334, 'y': -0.3508, 'CRS': 'FLW'},
-    {'x': 53.4439, 'y': -2.3833, 'CRS': 'FLI'},
-    {'x': 54.690, 'y': -3.521, 'CRS': 'FLM'},
-    {'x': 53.250, 'y': -3.133, 'CRS': 'FLN'},
-    {'x': 51.291, 'y': -0.831, 'CRS': 'FLE'},
-    {'x': 55.8224, 'y': -3.7192, 'CRS': 'FLD'},
-    {'x': 53.462, 'y': -2.081, 'CRS': 'FLF'},
-    {'x': 52.051, 'y': 1.144, 'CRS': 'IPS'},
-    {'x': 50.839, 'y': -0.815, 'CRS': 'FSB'},
-    {'x': 55.8519, 'y': -4.4419, 'CRS': 'PYJ'},
-    {'x': 51.9006, 'y': 0.8929, 'CRS': 'COL'},
-    {'x': 52.5875, 'y': -2.1200, 'CRS': 'WVH'},
-    {'x': 50.8176, 'y': 0.3425, 'CRS': 'PEB'},
-    {'x': 55.6368, 'y': -4.5306, 'CRS': 'KLM'},
-    {'x': 54.380, 'y': -2.903, 'CRS': 'WDM'},
-    {'x': 52.75385, 'y': 0.403251, 'CRS': 'KLN'},
-    {'x': 51.801, 'y': -0.622, 'CRS': 'TRI'},
-    {'x': 51.6101, 'y': -3.3806, 'CRS': 'TRH'},
-    {'x': 51.9767, 'y': 1.3194, 'CRS': 'TRM'},
-    {'x': 51.3200, 'y': -2.2143, 'CRS': 'TRO'},
-    {'x': 55.5426, 'y': -4.6555, 'CRS': 'TRN'},
-    {'x': 53.4547, 'y': -2.3117, 'CRS': 'TRA'},
-    {'x': 51.6718, 'y': -3.5356, 'CRS': 'TRB'},
-    {'x': 51.56806, 'y': -3.29000, 'CRS': 'TRE'},
-    {'x': 51.7120, 'y': -3.3464, 'CRS': 'TRD'},
-    {'x': 51.5920, 'y': -3.3250, 'CRS': 'TRF'},
-    {'x': 51.6575, 'y': -3.5061, 'CRS': 'TRY'},
-    {'x': 52.25, 'y': 0.8086, 'CRS': 'TRS'},
-    {'x': 50.4729, 'y': -3.5463, 'CRS': 'TRR'},
-    {'x': 50.26400, 'y': -5.06432, 'CRS': 'TRU'},
-    {'x': 53.242, 'y': -2.554, 'CRS': 'HTF'},
-    {'x': 51.6095, 'y': -0.3681, 'CRS': 'HTE'},
-    {'x': 53.4259, 'y': -2.1793, 'CRS': 'HTC'},
-    {'x': 51.5308, 'y': -0.1202, 'CRS': 'KCM'},
-    {'x': 52.2952, 'y': -1.6730, 'CRS': 'HTN'},
-    {'x': 51.3459, 'y': 0.1307, 'CRS': 'KCK'},
-    {'x': 53.346, 'y': -2.213, 'CRS': 'HTH'},
-    {'x': 55.8112, 'y': -3.8389, 'CRS': 'HTW'},
-    {'x': 51.4168, 'y': 0.0441, 'CRS': 'ESD'},
-    {'x': 53.445, 'y': -2.040, 'CRS': 'HTY'},
-    {'x': 53.45694, 'y': -2.17389, 'CRS': 'RRB'},
-    {'x': 51.5318, 'y': -0.0754, 'CRS': 'HOX'},
-    {'x': 53.6082, 'y': -1.7809, 'CRS': 'HOY'},
-    {'x': 51.685, 'y': -0.317, 'CRS': 'RDT'},
-    {'x': 51.455142, 'y': -0.990516, 'CRS': 'RDW'},
-    {'x': 52.95167, 'y': -0.85583, 'CRS': 'ELO'},
-    {'x': 53.4361, 'y': -2.1580, 'CRS': 'RDS'},
-    {'x': 51.5165944, 'y': -3.24917, 'CRS': 'RDR'},
-    {'x': 56.2950, 'y': -3.0528, 'CRS': 'SPF'},
-    {'x': 57.6428, 'y': -3.3110, 'CRS': 'ELG'},
-    {'x': 51.227, 'y': -0.171, 'CRS': 'ELD'},
-    {'x': 51.3978, 'y': -0.0499, 'CRS': 'ELE'},
-    {'x': 51.3323, 'y': -0.0996, 'CRS': 'RDD'},
-    {'x': 51.4590, 'y': -0.9722, 'CRS': 'RDG'},
-    {'x': 52.39028, 'y': 0.26639, 'CRS': 'ELY'},
-    {'x': 51.4683, 'y': -2.5994, 'CRS': 'RDA'},
-    {'x': 52.306, 'y': -1.945, 'CRS': 'RDC'},
-    {'x': 50.9198, 'y': -1.4702, 'CRS': 'RDB'},
-    {'x': 53.499, 'y': -1.427, 'CRS': 'ELR'},
-    {'x': 51.6531, 'y': -0.2802, 'CRS': 'ELS'},
-    {'x': 53.2821, 'y': -2.8962, 'CRS': 'ELP'},
-    {'x': 53.449, 'y': -2.156, 'CRS': 'RDN'},
-    {'x': 51.4555, 'y': 0.0515, 'CRS': 'ELW'},
-    {'x': 51.905205, 'y': -0.458625, 'CRS': 'LEA'},
-    {'x': 52.045, 'y': -2.425, 'CRS': 'LED'},
-    {'x': 51.4497, 'y': 0.0135, 'CRS': 'LEE'},
-    {'x': 53.427, 'y': -2.724, 'CRS': 'LEG'},
-    {'x': 52.480, 'y': -1.786, 'CRS': 'LEH'},
-    {'x': 52.632, 'y': -1.124, 'CRS': 'LEI'},
-    {'x': 53.5535, 'y': -3.0708, 'CRS': 'FBY'},
-    {'x': 50.18380, 'y': -5.43650, 'CRS': 'LEL'},
-    {'x': 51.5693, 'y': -0.0072, 'CRS': 'LEM'},
-    {'x': 51.234, 'y': 0.708, 'CRS': 'LEN'},
-    {'x': 52.225, 'y': -2.730, 'CRS': 'LEO'},
-    {'x': 51.5634, 'y': 0.0087, 'CRS': 'LER'},
-    {'x': 51.541, 'y': 0.640, 'CRS': 'LES'},
-    {'x': 51.980721, 'y': -0.227677, 'CRS': 'LET'},
-    {'x': 56.3751, 'y': -2.8936, 'CRS': 'LEU'},
-    {'x': 51.4653, 'y': -0.0133, 'CRS': 'LEW'},
-    {'x': 53.699, 'y': -2.687, 'CRS': 'LEY'},
-    {'x': 51.5364, 'y': -0.2578, 'CRS': 'HDN'},
-    {'x': 51.6024, 'y': -0.3564, 'CRS': 'HDL'},
-    {'x': 51.4678, 'y': 0.1904, 'CRS': 'SGR'},
-    {'x': 50.39430, 'y': -4.30876, 'CRS': 'SGM'},
-    {'x': 55.9366, 'y': -3.2998, 'CRS': 'SGL'},
-    {'x': 51.5342, 'y': -0.3369, 'CRS': 'SGN'},
-    {'x': 52.50222, 'y': -1.98028, 'CRS': 'SGB'},
-    {'x': 53.280, 'y': -3.831, 'CRS': 'CNW'},
-    {'x': 52.2381, 'y': 0.9126, 'CRS': 'ESW'},
-    {'x': 53.489380, 'y': -1.234170, 'CRS': 'CNS'},
-    {'x': 53.393, 'y': -3.023, 'CRS': 'CNP'},
-    {'x': 51.564653, 'y': -0.106366, 'CRS': 'FPK'},
-    {'x': 52.57805, 'y': 1.51277, 'CRS': 'CNY'},
-    {'x': 53.130, 'y': -2.771, 'CRS': 'CNF'},
-    {'x': 53.158, 'y': -2.193, 'CRS': 'CNG'},
-    {'x': 53.8553, 'y': -2.1822, 'CRS': 'CNE'},
-    {'x': 51.5482, 'y': -0.0925, 'CRS': 'CNN'},
-    {'x': 50.8664, 'y': -2.5730, 'CRS': 'CNO'},
-    {'x': 52.399, 'y': -1.548, 'CRS': 'CNL'},
-    {'x': 51.897, 'y': -2.100, 'CRS': 'CNM'},
-    {'x': 51.5574, 'y': -0.3595, 'CRS': 'NLT'},
-    {'x': 53.6988, 'y': -1.3040, 'CRS': 'PFM'},
-    {'x': 51.481, 'y': 0.237, 'CRS': 'PFL'},
-    {'x': 51.498333, 'y': -0.05, 'CRS': 'ZCW'},
-    {'x': 53.8484, 'y': -2.9906, 'CRS': 'PFY'},
-    {'x': 50.93600, 'y': -3.90535, 'CRS': 'KGN'},
-    {'x': 51.866, 'y': -1.593, 'CRS': 'SIP'},
-    {'x': 50.20890, 'y': -5.47824, 'CRS': 'SIV'},
-    {'x': 51.3420083, 'y': 0.7348083, 'CRS': 'SIT'},
-    {'x': 54.226, 'y': -3.335, 'CRS': 'SIC'},
-    {'x': 53.797400, 'y': -1.232800, 'CRS': 'SIE'},
-    {'x': 51.4338, 'y': 0.104, 'CRS': 'SID'},
-    {'x': 51.3901, 'y': -0.1985, 'CRS': 'SIH'},
-    {'x': 55.9075, 'y': -4.4055, 'CRS': 'SIN'},
-    {'x': 52.7312278, 'y': -1.1095611, 'CRS': 'SIL'},
-    {'x': 51.3093, 'y': -0.2427, 'CRS': 'TAT'},
-    {'x': 51.0228, 'y': -3.1035, 'CRS': 'TAU'},
-    {'x': 51.524, 'y': -0.681, 'CRS': 'TAP'},
-    {'x': 53.356, 'y': -2.341, 'CRS': 'ASY'},
-    {'x': 56.4309, 'y': -5.2394, 'CRS': 'TAY'},
-    {'x': 51.292, 'y': -0.236, 'CRS': 'TAD'},
-    {'x': 51.5409, 'y': -3.2635, 'CRS': 'TAF'},
-    {'x': 52.552257, 'y': -1.975991, 'CRS': 'TAB'},
-    {'x': 51.881, 'y': -1.297, 'CRS': 'TAC'},
-    {'x': 52.904418, 'y': -4.068134, 'CRS': 'TAL'},
-    {'x': 52.6369, 'y': -1.6867, 'CRS': 'TAM'},
-    {'x': 57.8144, 'y': -4.0519, 'CRS': 'TAI'},
-    {'x': 56.1411, 'y': -3.2609, 'CRS': 'CDD'},
-    {'x': 55.2463, 'y': -4.8482, 'CRS': 'GIR'},
-    {'x': 51.4246, 'y': -0.084, 'CRS': 'GIP'},
-    {'x': 51.4755, 'y': -3.1780, 'CRS': 'CDF'},
-    {'x': 54.061800, 'y': -2.302760, 'CRS': 'GIG'},
-    {'x': 51.034, 'y': -2.273, 'CRS': 'GIL'},
-    {'x': 51.202, 'y': -0.162, 'CRS': 'SAF'},
-    {'x': 51.318, 'y': -0.308, 'CRS': 'AHD'},
-    {'x': 54.105394, 'y': -2.410208, 'CRS': 'CPY'},
-    {'x': 53.4913, 'y': -2.0943, 'CRS': 'AHN'},
-    {'x': 51.129, 'y': 0.153, 'CRS': 'AHS'},
-    {'x': 51.272, 'y': -0.722, 'CRS': 'AHV'},
-    {'x': 51.6974, 'y': -3.0133, 'CRS': 'PPL'},
-    {'x': 51.24639, 'y': -0.76000, 'CRS': 'AHT'},
-    {'x': 53.611, 'y': -2.868, 'CRS': 'NLN'},
-    {'x': 53.47444, 'y': -2.11278, 'CRS': 'GUI'},
-    {'x': 51.4918, 'y': -0.275, 'CRS': 'GUN'},
-    {'x': 53.648, 'y': -1.785, 'CRS': 'HUD'},
-    {'x': 54.173, 'y': -2.925, 'CRS': 'KBK'},
-    {'x': 51.5374, 'y': -0.1919, 'CRS': 'KBN'},
-    {'x': 54.174000, 'y': -0.314550, 'CRS': 'HUB'},
-    {'x': 53.7435, 'y': -0.3460, 'CRS': 'HUL'},
-    {'x': 58.2585, 'y': -3.9412, 'CRS': 'KBC'},
-    {'x': 52.329, 'y': -0.192, 'CRS': 'HUN'},
-    {'x': 54.232, 'y': -3.189, 'CRS': 'KBF'},
-    {'x': 53.260, 'y': -2.942, 'CRS': 'CPU'},
-    {'x': 53.956000, 'y': -0.432000, 'CRS': 'HUT'},
-    {'x': 51.841, 'y': 1.215, 'CRS': 'KBX'},
-    {'x': 53.4523, 'y': -2.327, 'CRS': 'HUP'},
-    {'x': 51.244, 'y': 0.004, 'CRS': 'HUR'},
-    {'x': 56.0801, 'y': -4.8254, 'CRS': 'GCH'},
-    {'x': 51.6399, 'y': -2.6711, 'CRS': 'CPW'},
-    {'x': 53.410, 'y': -2.843, 'CRS': 'HUY'},
-    {'x': 52.408, 'y': -1.964, 'CRS': 'NFD'},
-    {'x': 51.995, 'y': -0.736, 'CRS': 'BLY'},
-    {'x': 52.618, 'y': -2.011, 'CRS': 'BLX'},
-    {'x': 53.772, 'y': -2.346, 'CRS': 'HCT'},
-    {'x': 54.01120, 'y': -0.38400, 'CRS': 'NFN'},
-    {'x': 52.99972, 'y': -1.19556, 'CRS': 'BLW'},
-    {'x': 51.4459528, 'y': 0.3239556, 'CRS': 'NFL'},
-    {'x': 53.025, 'y': -1.483, 'CRS': 'BLP'},
-    {'x': 51.3778, 'y': -0.1539, 'CRS': 'HCB'},
-    {'x': 54.974, 'y': -2.346, 'CRS': 'BLL'},
-    {'x': 54.9658, 'y': -1.7130, 'CRS': 'BLO'},
-    {'x': 53.48767, 'y': -3.04038, 'CRS': 'BLN'},
-    {'x': 55.8171, 'y': -4.0243, 'CRS': 'BLH'},
-    {'x': 53.591, 'y': -2.570, 'CRS': 'BLK'},
-    {'x': 53.80558, 'y': -1.63792, 'CRS': 'BLE'},
-    {'x': 53.850, 'y': -1.754, 'CRS': 'BLD'},
-    {'x': 53.199, 'y': -2.351, 'CRS': 'HCH'},
-    {'x': 51.1657500, 'y': 0.6271917, 'CRS': 'HCN'},
-    {'x': 51.625, 'y': 0.566, 'CRS': 'BLB'},
-    {'x': 54.750, 'y': -2.702, 'CRS': 'LZB'},
-    {'x': 55.7659, 'y': -4.1810, 'CRS': 'EKL'},
-    {'x': 53.315, 'y': -0.948, 'CRS': 'RET'},
-    {'x': 51.242, 'y': -0.204, 'CRS': 'REI'},
-    {'x': 51.559, 'y': -0.068, 'CRS': 'REC'},
-    {'x': 55.7060, 'y': -4.7112, 'CRS': 'DLY'},
-    {'x': 50.23320, 'y': -5.22602, 'CRS': 'RED'},
-    {'x': 52.565, 'y': 1.560, 'CRS': 'REE'},
-    {'x': 51.176, 'y': -0.007, 'CRS': 'LFD'},
-    {'x': 52.4777, 'y': 1.7157, 'CRS': 'OUN'},
-    {'x': 52.4696, 'y': 1.7076, 'CRS': 'OUS'},
-    {'x': 51.4592, 'y': 0.0799, 'CRS': 'FCN'},
-    {'x': 53.71510, 'y': -1.51043, 'CRS': 'OUT'},
-    {'x': 50.17830, 'y': -5.44226, 'CRS': 'LTS'},
-    {'x': 52.462, 'y': 0.317, 'CRS': 'LTP'},
-    {'x': 52.68662, 'y': -1.80024, 'CRS': 'LTV'},
-    {'x': 53.2854, 'y': -2.9433, 'CRS': 'LTT'},
-    {'x': 50.1484, 'y': -5.0642, 'CRS': 'FMT'},
-    {'x': 50.86194, 'y': -0.08722, 'CRS': 'FMR'},
-    {'x': 51.311789, 'y': -0.7471, 'CRS': 'FML'},
-    {'x': 53.268, 'y': -2.465, 'CRS': 'LTG'},
-    {'x': 51.752, 'y': -0.808, 'CRS': 'LTK'},
-    {'x': 51.7003389, 'y': -3.1370333, 'CRS': 'LTH'},
-    {'x': 51.873, 'y': -0.396, 'CRS': 'LTN'},
-    {'x': 53.7392, 'y': -2.9643, 'CRS': 'LTM'},
-    {'x': 53.6429, 'y': -2.0947, 'CRS': 'LTL'},
-    {'x': 51.8807528, 'y': 0.7827556, 'CRS': 'MKT'},
-    {'x': 50.40440, 'y': -5.02846, 'CRS': 'QUI'},
-    {'x': 55.8549, 'y': -4.1791, 'CRS': 'CAY'},
-    {'x': 55.9295, 'y': -4.8271, 'CRS': 'IBM'},
-    {'x': 53.5919, 'y': -2.1783, 'CRS': 'CAS'},
-    {'x': 54.891, 'y': -2.934, 'CRS': 'CAR'},
-    {'x': 50.40580, 'y': -4.46640, 'CRS': 'CAU'},
-    {'x': 51.2825, 'y': -0.0786, 'CRS': 'CAT'},
-    {'x': 54.178, 'y': -2.973, 'CRS': 'CAK'},
-    {'x': 52.686, 'y': -2.022, 'CRS': 'CAO'},
-    {'x': 56.5007, 'y': -2.7053, 'CRS': 'CAN'},
-    {'x': 51.336, 'y': -0.745, 'CRS': 'CAM'},
-    {'x': 55.88798, 'y': -3.88781, 'CRS': 'CAC'},
-    {'x': 57.2794, 'y': -3.8280, 'CRS': 'CAG'},
-    {'x': 51.4506361, 'y': 0.2789806, 'CRS': 'GNH'},
-    {'x': 51.4122, 'y': -3.2487, 'CRS': 'CAD'},
-    {'x': 53.56355, 'y': -0.08700, 'CRS': 'GMB'},
-    {'x': 53.594190, 'y': -1.723550, 'CRS': 'SSM'},
-    {'x': 51.747, 'y': -0.011, 'CRS': 'BXB'},
-    {'x': 51.5049, 'y': -2.5624, 'CRS': 'FIT'},
-    {'x': 50.435, 'y': -3.565, 'CRS': 'PGN'},
-    {'x': 51.6701, 'y': -3.2301, 'CRS': 'PGM'},
-    {'x': 51.5528, 'y': -0.1055, 'CRS': 'DYP'},
-    {'x': 52.042, 'y': -0.559, 'CRS': 'LID'},
-    {'x': 52.789, 'y': -4.105, 'CRS': 'DYF'},
-    {'x': 57.2056, 'y': -2.1926, 'CRS': 'DYC'},
-    {'x': 51.3812, 'y': -0.2451, 'CRS': 'WCP'},
-    {'x': 55.7903, 'y': -4.3107, 'CRS': 'WCR'},
-    {'x': 51.3783, 'y': -0.1025, 'CRS': 'WCY'},
-    {'x': 51.5543, 'y': -0.2863, 'CRS': 'WCX'},
-    {'x': 51.1822, 'y': 0.3890, 'CRS': 'PDW'},
-    {'x': 51.4842, 'y': 0.0187, 'CRS': 'WCB'},
-    {'x': 51.889, 'y': 0.261, 'CRS': 'SSD'},
-    {'x': 51.237, 'y': -1.338, 'CRS': 'WCH'},
-    {'x': 58.4416, 'y': -3.0975, 'CRS': 'WCK'},
-    {'x': 52.1510, 'y': 1.3987, 'CRS': 'WCM'},
-    {'x': 55.8537, 'y': -3.5671, 'CRS': 'WCL'},
-    {'x': 53.396, 'y': -2.076, 'CRS': 'RSH'},
-    {'x': 53.787, 'y': -2.282, 'CRS': 'RSG'},
-    {'x': 55.8235, 'y': -4.0867, 'CRS': 'UDD'},
-    {'x': 53.5511, 'y': -2.1717, 'CRS': 'MIH'},
-    {'x': 53.7887, 'y': -1.3254, 'CRS': 'MIK'},
-    {'x': 51.393, 'y': -0.1576, 'CRS': 'MIJ'},
-    {'x': 51.992, 'y': -1.700, 'CRS': 'MIM'},
-    {'x': 51.6130, 'y': -0.2489, 'CRS': 'MIL'},
-    {'x': 55.8247, 'y': -4.5344, 'CRS': 'MIN'},
-    {'x': 53.36500, 'y': -2.27306, 'CRS': 'MIA'},
-    {'x': 51.182, 'y': -1.261, 'CRS': 'MIC'},
-    {'x': 55.8553, 'y': -4.1294, 'CRS': 'GAR'},
-    {'x': 51.241, 'y': -0.324, 'CRS': 'DKG'},
-    {'x': 56.5569, 'y': -3.5783, 'CRS': 'DKD'},
-    {'x': 51.944, 'y': 1.081, 'CRS': 'MIS'},
-    {'x': 53.6716, 'y': -1.6933, 'CRS': 'MIR'},
-    {'x': 56.0124, 'y': -3.3947, 'CRS': 'NQU'},
-    {'x': 51.15200, 'y': -0.96766, 'CRS': 'AON'},
-    {'x': 50.41450, 'y': -5.07529, 'CRS': 'NQY'},
-    {'x': 53.804720, 'y': -1.680560, 'CRS': 'NQC'},
-    {'x': 51.301338, 'y': 0.466012, 'CRS': 'AYL'},
-    {'x': 51.5386, 'y': -0.0754, 'CRS': 'HGG'},
-    {'x': 51.227367, 'y': 1.209483, 'CRS': 'AYH'},
-    {'x': 53.4483, 'y': -2.3536, 'CRS': 'URM'},
-    {'x': 52.4139, 'y': -4.08157, 'CRS': 'AYW'},
-    {'x': 51.4354, 'y': 0.1257, 'CRS': 'AYP'},
-    {'x': 51.813903, 'y': -0.815102, 'CRS': 'AYS'},
-    {'x': 55.4583, 'y': -4.6258, 'CRS': 'AYR'},
-    {'x': 53.065, 'y': -3.863, 'CRS': 'PYP'},
-    {'x': 51.214, 'y': -0.567, 'CRS': 'SFR'},
-    {'x': 52.666, 'y': -2.372, 'CRS': 'SFN'},
-    {'x': 51.514, 'y': 0.423, 'CRS': 'SFO'},
-    {'x': 53.4657, 'y': -3.0050, 'CRS': 'SFL'},
-    {'x': 51.526, 'y': -3.698, 'CRS': 'PYL'},
-    {'x': 50.1708, 'y': -5.11155, 'CRS': 'PYN'},
-    {'x': 53.4828, 'y': -2.2558, 'CRS': 'SFD'},
-    {'x': 51.5239, 'y': -3.3921, 'CRS': 'PYC'},
-    {'x': 55.8474, 'y': -4.4242, 'CRS': 'PYG'},
-    {'x': 51.6688, 'y': -0.1761, 'CRS': 'HDW'},
-    {'x': 54.455, 'y': -2.369, 'CRS': 'KSW'},
-    {'x': 53.818, 'y': -1.594, 'CRS': 'HDY'},
-    {'x': 51.3534, 'y': 0.6681, 'CRS': 'NGT'},
-    {'x': 53.461, 'y': -1.965, 'CRS': 'HDF'},
-    {'x': 50.93306, 'y': -1.29528, 'CRS': 'HDE'},
-    {'x': 54.975, 'y': -2.248, 'CRS': 'HDB'},
-    {'x': 53.5446, 'y': -2.3755, 'CRS': 'KSL'},
-    {'x': 51.771, 'y': -0.9426, 'CRS': 'HDM'},
-    {'x': 51.149, 'y': 1.272, 'CRS': 'KSN'},
-    {'x': 51.5553, 'y': -0.1654, 'CRS': 'HDH'},
-    {'x': 53.727, 'y': -2.661, 'CRS': 'BMB'},
-    {'x': 53.61411, 'y': -2.41081, 'CRS': 'BMC'},
-    {'x': 53.74000, 'y': -0.67098, 'CRS': 'BMF'},
-    {'x': 51.285, 'y': 0.479, 'CRS': 'BMG'},
-    {'x': 51.6556, 'y': -0.0308, 'CRS': 'BMD'},
-    {'x': 52.423, 'y': -2.885, 'CRS': 'BME'},
-    {'x': 50.728, 'y': -1.864, 'CRS': 'BMH'},
-    {'x': 51.4088, 'y': 0.0179, 'CRS': 'BMN'},
-    {'x': 52.479, 'y': -1.893, 'CRS': 'BMO'},
-    {'x': 53.360435, 'y': -2.162869, 'CRS': 'BML'},
-    {'x': 53.3298, 'y': -2.9900, 'CRS': 'BMR'},
-    {'x': 51.4, 'y': 0.017, 'CRS': 'BMS'},
-    {'x': 54.933, 'y': -2.704, 'CRS': 'BMP'},
-    {'x': 52.323, 'y': -2.048, 'CRS': 'BMV'},
-    {'x': 51.44030, 'y': -2.59440, 'CRS': 'BMT'},
-    {'x': 51.330, 'y': -1.061, 'CRS': 'BMY'},
-    {'x': 51.396861, 'y': -0.446694, 'CRS': 'SHP'},
-    {'x': 52.712, 'y': -2.75, 'CRS': 'SHR'},
-    {'x': 55.8186, 'y': -3.7989, 'CRS': 'SHS'},
-    {'x': 53.213, 'y': -3.038, 'CRS': 'SHT'},
-    {'x': 51.746, 'y': -2.280, 'CRS': 'SHU'},
-    {'x': 51.537, 'y': 0.691, 'CRS': 'WCF'},
-    {'x': 51.022, 'y': -1.328, 'CRS': 'SHW'},
-    {'x': 53.8331, 'y': -1.7734, 'CRS': 'SHY'},
-    {'x': 53.5762, 'y': -2.0898, 'CRS': 'SHA'},
-    {'x': 53.2041, 'y': -1.2026, 'CRS': 'SHB'},
-    {'x': 53.6762, 'y': -1.4000, 'CRS': 'SHC'},
-    {'x': 54.6262, 'y': -1.6368, 'CRS': 'SHD'},
-    {'x': 50.944, 'y': -2.513, 'CRS': 'SHE'},
-    {'x': 53.378, 'y': -1.462, 'CRS': 'SHF'},
-    {'x': 51.4844, 'y': -2.6792, 'CRS': 'SHH'},
-    {'x': 51.511, 'y': -0.883, 'CRS': 'SHI'},
-    {'x': 53.434, 'y': -2.700, 'CRS': 'SHJ'},
-    {'x': 55.8293, 'y': -4.2924, 'CRS': 'SHL'},
-    {'x': 52.941, 'y': 1.211, 'CRS': 'SHM'},
-    {'x': 50.633767, 'y': -1.179073, 'CRS': 'SHN'},
-    {'x': 50.897, 'y': -1.364, 'CRS': 'SHO'},
-    {'x': 54.559270, 'y': -1.301000, 'CRS': 'TBY'},
-    {'x': 51.3420, 'y': -2.3010, 'CRS': 'FFD'},
-    {'x': 52.467, 'y': -1.756, 'CRS': 'MGN'},
-    {'x': 51.130, 'y': 0.263, 'CRS': 'TBW'},
-    {'x': 51.872, 'y': -3.993, 'CRS': 'FFA'},
-    {'x': 51.117, 'y': -0.161, 'CRS': 'TBD'},
-    {'x': 51.88227, 'y': -0.41432, 'CRS': 'LUT'},
-    {'x': 50.3903, 'y': -4.74799, 'CRS': 'LUX'},
-    {'x': 52.371, 'y': -2.716, 'CRS': 'LUD'},
-    {'x': 56.4345, 'y': -4.7036, 'CRS': 'UTY'},
-    {'x': 51.289, 'y': -0.583, 'CRS': 'WPL'},
-    {'x': 51.5044, 'y': -0.0558, 'CRS': 'WPE'},
-    {'x': 51.848, 'y': 1.162, 'CRS': 'TLS'},
-    {'x': 54.4896, 'y': -1.1154, 'CRS': 'GTA'},
-    {'x': 51.463, 'y': -0.300, 'CRS': 'RMD'},
-    {'x': 52.133, 'y': -3.530, 'CRS': 'GTH'},
-    {'x': 51.4675, 'y': -3.1897, 'CRS': 'GTN'},
-    {'x': 53.46889, 'y': -2.16778, 'CRS': 'GTO'},
-    {'x': 53.228, 'y': -3.818, 'CRS': 'TLC'},
-    {'x': 52.773, 'y': -4.097, 'CRS': 'TLB'},
-    {'x': 53.223, 'y': -2.326, 'CRS': 'GTR'},
-    {'x': 51.1565, 'y': -0.1609, 'CRS': 'GTW'},
-    {'x': 52.3591, 'y': -1.8448, 'CRS': 'TLK'},
-    {'x': 53.392907, 'y': -2.230836, 'CRS': 'GTY'},
-    {'x': 51.4715000, 'y': -1.0295000, 'CRS': 'TLH'},
-    {'x': 54.332, 'y': -2.740, 'CRS': 'KEN'},
-    {'x': 51.676, 'y': -2.023, 'CRS': 'KEM'},
-    {'x': 51.8409, 'y': 0.7027, 'CRS': 'KEL'},
-    {'x': 53.8679, 'y': -1.9011, 'CRS': 'KEI'},
-    {'x': 53.11470, 'y': 0.27314, 'CRS': 'HVN'},
-    {'x': 51.803, 'y': -4.960, 'CRS': 'HVF'},
-    {'x': 50.39008, 'y': -4.17984, 'CRS': 'KEY'},
-    {'x': 52.39307, 'y': -0.73215, 'CRS': 'KET'},
-    {'x': 53.33, 'y': -1.985, 'CRS': 'WBR'},
-    {'x': 51.4866, 'y': -0.1957, 'CRS': 'WBP'},
-    {'x': 53.386, 'y': -2.603, 'CRS': 'WBQ'},
-    {'x': 52.125, 'y': -0.281, 'CRS': 'SDY'},
-    {'x': 53.699100, 'y': -1.158900, 'CRS': 'WBD'},
-    {'x': 52.262, 'y': 0.197, 'CRS': 'WBC'},
-    {'x': 51.4095, 'y': -0.2142, 'CRS': 'WBO'},
-    {'x': 50.8533, 'y': -0.9667, 'CRS': 'WBL'},
-    {'x': 53.4057, 'y': -2.5570, 'CRS': 'PDG'},
-    {'x': 51.090, 'y': 1.066, 'CRS': 'SDG'},
-    {'x': 50.969, 'y': 0.096, 'CRS': 'UCK'},
-    {'x': 54.6096, 'y': -1.1130, 'CRS': 'RBS'},
-    {'x': 50.985, 'y': 0.469, 'CRS': 'RBR'},
-    {'x': 52.7154, 'y': 1.4081, 'CRS': 'HXM'},
-    {'x': 51.471, 'y': -0.454, 'CRS': 'HXX'},
-    {'x': 50.9220, 'y': -1.3880, 'CRS': 'SDN'},
-    {'x': 51.4661, 'y': -0.102, 'CRS': 'LGJ'},
-    {'x': 54.589370, 'y': -1.031180, 'CRS': 'LGK'},
-    {'x': 52.990, 'y': -2.137, 'CRS': 'LGN'},
-    {'x': 52.35000, 'y': -3.16167, 'CRS': 'LGO'},
-    {'x': 53.018, 'y': -1.331, 'CRS': 'LGM'},
-    {'x': 55.9247, 'y': -4.5864, 'CRS': 'LGB'},
-    {'x': 51.3960750, 'y': 0.3004889, 'CRS': 'LGF'},
-    {'x': 52.494, 'y': -2.005, 'CRS': 'LGG'},
-    {'x': 52.62194, 'y': 1.48917, 'CRS': 'LGD'},
-    {'x': 52.88500, 'y': -1.28722, 'CRS': 'LGE'},
-    {'x': 55.8208, 'y': -4.2759, 'CRS': 'LGS'},
-    {'x': 54.694, 'y': -2.664, 'CRS': 'LGW'},
-    {'x': 55.8637, 'y': -4.2107, 'CRS': 'AXP'},
-    {'x': 51.5411, 'y': -2.4319, 'CRS': 'YAE'},
-    {'x': 52.324, 'y': -1.821, 'CRS': 'DZY'},
-    {'x': 50.779, 'y': -3.005, 'CRS': 'AXM'},
-    {'x': 53.063, 'y': -2.519, 'CRS': 'NAN'},
-    {'x': 51.799, 'y': -4.727, 'CRS': 'NAR'},
-    {'x': 57.5514, 'y': -2.9542, 'CRS': 'KEH'},
-    {'x': 52.546, 'y': -4.035, 'CRS': 'PHG'},
-    {'x': 51.197, 'y': 0.173, 'CRS': 'PHR'},
-    {'x': 51.4826, 'y': 0.0030, 'CRS': 'MZH'},
-    {'x': 51.565, 'y': -0.073, 'CRS': 'SKW'},
-    {'x': 53.573, 'y': -2.425, 'CRS': 'BON'},
-    {'x': 54.946750, 'y': -1.916639, 'CRS': 'SKS'},
-    {'x': 51.661, 'y': -3.847, 'CRS': 'SKE'},
-    {'x': 53.143, 'y': 0.334, 'CRS': 'SKG'},
-    {'x': 51.788, 'y': -0.784, 'CRS': 'SKM'},
-    {'x': 50.4223, 'y': -4.46368, 'CRS': 'SKN'},
-    {'x': 53.9586, 'y': -2.0264, 'CRS': 'SKI'},
-    {'x': 51.589, 'y': -0.555, 'CRS': 'GER'},
-    {'x': 54.6137, 'y': -1.5898, 'CRS': 'NAY'},
-    {'x': 52.926, 'y': -4.084, 'CRS': 'MFF'},
-    {'x': 51.715, 'y': -5.041, 'CRS': 'MFH'},
-    {'x': 55.8268, 'y': -4.2611, 'CRS': 'MFL'},
-    {'x': 50.917, 'y': -1.259, 'CRS': 'BOE'},
-    {'x': 55.0007, 'y': -3.0670, 'CRS': 'GEA'},
-    {'x': 53.14222, 'y': -1.19861, 'CRS': 'MFT'},
-    {'x': 51.264, 'y': -0.150, 'CRS': 'MHM'},
-    {'x': 52.525, 'y': -2.049, 'CRS': 'DDP'},
-    {'x': 55.9473, 'y': -4.7679, 'CRS': 'GKW'},
-    {'x': 51.52611, 'y': 0.14638, 'CRS': 'DDK'},
-    {'x': 55.9450, 'y': -4.7515, 'CRS': 'GKC'},
-    {'x': 52.372, 'y': -1.753, 'CRS': 'DDG'},
-    {'x': 53.4167, 'y': -1.4141, 'CRS': 'MHS'},
-    {'x': 55.8598, 'y': -4.2703, 'CRS': 'AND'},
-    {'x': 50.890, 'y': -1.527, 'CRS': 'ANF'},
-    {'x': 50.81639, 'y': -0.48917, 'CRS': 'ANG'},
-    {'x': 53.3953, 'y': -2.3433, 'CRS': 'NVR'},
-    {'x': 52.98772, 'y': -0.53594, 'CRS': 'ANC'},
-    {'x': 55.8898, 'y': -4.3217, 'CRS': 'ANL'},
-    {'x': 54.9835, 'y': -3.2629, 'CRS': 'ANN'},
-    {'x': 53.5449, 'y': -2.6339, 'CRS': 'WGW'},
-    {'x': 51.498, 'y': -0.877, 'CRS': 'WGV'},
-    {'x': 53.6019, 'y': -3.0428, 'CRS': 'ANS'},
-    {'x': 50.795, 'y': 0.055, 'CRS': 'NVN'},
-    {'x': 51.4147, 'y': -0.067, 'CRS': 'ANZ'},
-    {'x': 50.790, 'y': 0.055, 'CRS': 'NVH'},
-    {'x': 53.073, 'y': -3.018, 'CRS': 'GWE'},
-    {'x': 51.6487, 'y': -4.0353, 'CRS': 'GWN'},
-    {'x': 51.002, 'y': -2.4164, 'CRS': 'TMC'},
-    {'x': 51.781, 'y': 0.095, 'CRS': 'HWN'},
-    {'x': 51.79, 'y': 0.132, 'CRS': 'HWM'},
-    {'x': 54.9680, 'y': -2.4636, 'CRS': 'HWH'},
-    {'x': 53.578, 'y': -2.540, 'CRS': 'HWI'},
-    {'x': 53.185, 'y': -3.032, 'CRS': 'HWD'},
-    {'x': 53.0863, 'y': -2.2446, 'CRS': 'KDG'},
-    {'x': 53.218167, 'y': -3.032121, 'CRS': 'HWB'},
-    {'x': 51.944, 'y': 1.287, 'CRS': 'HWC'},
-    {'x': 51.4621, 'y': 0.0273, 'CRS': 'KDB'},
-    {'x': 56.1119, 'y': -3.1671, 'CRS': 'KDY'},
-    {'x': 51.630, 'y': -0.745, 'CRS': 'HWY'},
-    {'x': 51.4723, 'y': -0.488, 'CRS': 'HWV'},
-    {'x': 51.7175, 'y': -0.3448, 'CRS': 'HWW'},
-    {'x': 51.181, 'y': 0.095, 'CRS': 'HEV'},
-    {'x': 54.9516, 'y': -1.5558, 'CRS': 'HEW'},
-    {'x': 51.4543, 'y': -0.0887, 'CRS': 'NDL'},
-    {'x': 51.3768, 'y': -0.3898, 'CRS': 'HER'},
-    {'x': 53.71698, 'y': -0.44000, 'CRS': 'HES'},
-    {'x': 53.19519, 'y': -0.59985, 'CRS': 'HKM'},
-    {'x': 54.9736, 'y': -2.0949, 'CRS': 'HEX'},
-    {'x': 53.3645, 'y': -2.8299, 'CRS': 'HED'},
-    {'x': 55.3875, 'y': -3.9988, 'CRS': 'KRK'},
-    {'x': 53.68902, 'y': -0.95900, 'CRS': 'RWC'},
-    {'x': 53.267, 'y': -0.664, 'CRS': 'SXY'},
-    {'x': 53.698500, 'y': -1.114500, 'CRS': 'HEL'},
-    {'x': 51.58, 'y': -0.2389, 'CRS': 'HEN'},
-    {'x': 51.3395, 'y': -0.5054, 'CRS': 'WBY'},
-    {'x': 54.5972, 'y': -1.5818, 'CRS': 'HEI'},
-    {'x': 51.5638, 'y': -0.1298, 'CRS': 'UHL'},
-    {'x': 53.3696, 'y': -2.9075, 'CRS': 'WSA'},
-    {'x': 52.101, 'y': -1.835, 'CRS': 'HYB'},
-    {'x': 51.2665, 'y': -2.1995, 'CRS': 'WSB'},
-    {'x': 50.934, 'y': -0.702, 'CRS': 'WSE'},
-    {'x': 53.191, 'y': -2.495, 'CRS': 'WSF'},
-    {'x': 51.886, 'y': 0.927, 'CRS': 'HYH'},
-    {'x': 55.7721, 'y': -3.9261, 'CRS': 'WSH'},
-    {'x': 53.390, 'y': -3.179, 'CRS': 'HYK'},
-    {'x': 51.3446, 'y': -2.9716, 'CRS': 'WSM'},
-    {'x': 52.5840, 'y': -1.9851, 'CRS': 'WSL'},
-    {'x': 55.8796, 'y': -4.3145, 'CRS': 'HYN'},
-    {'x': 51.4255, 'y': -0.188, 'CRS': 'HYR'},
-    {'x': 53.3862, 'y': -2.14155, 'CRS': 'WSR'},
-    {'x': 51.3659, 'y': -0.2052, 'CRS': 'WSU'},
-    {'x': 51.5864, 'y': -0.0021, 'CRS': 'WST'},
-    {'x': 51.4464, 'y': -0.1635, 'CRS': 'WSW'},
-    {'x': 51.376, 'y': -0.342, 'CRS': 'HYW'},
-    {'x': 53.610, 'y': -2.1541, 'CRS': 'RCD'},
-    {'x': 54.609, 'y': -1.052, 'CRS': 'RCE'},
-    {'x': 51.60554, 'y': -3.09304, 'CRS': 'RCA'},
-    {'x': 54.616, 'y': -1.071, 'CRS': 'RCC'},
-    {'x': 53.4690, 'y': -2.9368, 'CRS': 'FAZ'},
-    {'x': 51.31139, 'y': 0.89167, 'CRS': 'FAV'},
-    {'x': 50.15041, 'y': -5.05581, 'CRS': 'FAL'},
-    {'x': 50.73244, 'y': -3.99632, 'CRS': 'OKE'},
-    {'x': 51.5444, 'y': -3.1856, 'CRS': 'LVT'},
-    {'x': 55.8929, 'y': -4.3873, 'CRS': 'YOK'},
-    {'x': 55.8716, 'y': -3.5015, 'CRS': 'LVG'},
-    {'x': 53.4045, 'y': -2.9797, 'CRS': 'LVC'},
-    {'x': 53.44444, 'y': -2.19278, 'CRS': 'LVM'},
-    {'x': 51.080, 'y': -0.308, 'CRS': 'LVN'},
-    {'x': 53.4048, 'y': -2.9919, 'CRS': 'LVJ'},
-    {'x': 52.693, 'y': -2.450, 'CRS': 'OKN'},
-    {'x': 55.8178, 'y': -4.2604, 'CRS': 'CCT'},
-    {'x': 52.470, 'y': -1.913, 'CRS': 'FWY'},
-    {'x': 52.918, 'y': -4.238, 'CRS': 'CCC'},
-    {'x': 51.5563, 'y': -2.6265, 'CRS': 'PIL'},
-    {'x': 50.7377, 'y': -3.4698, 'CRS': 'PIN'},
-    {'x': 50.719, 'y': -1.983, 'CRS': 'POO'},
-    {'x': 53.729120, 'y': -1.981840, 'CRS': 'MYT'},
-    {'x': 55.8974, 'y': -4.3016, 'CRS': 'MYH'},
-    {'x': 51.546, 'y': 0.0059, 'CRS': 'MYL'},
-    {'x': 51.5223, 'y': -0.1634, 'CRS': 'MYB'},
-    {'x': 56.7023, 'y': -3.7353, 'CRS': 'PIT'},
-    {'x': 51.995, 'y': -3.803, 'CRS': 'LLV'},
-    {'x': 55.8769, 'y': -4.8891, 'CRS': 'WMS'},
-    {'x': 52.396, 'y': -1.774, 'CRS': 'WMR'},
-    {'x': 51.5817, 'y': -0.024, 'CRS': 'WMW'},
-    {'x': 51.5199, 'y': -3.5803, 'CRS': 'WMI'},
-    {'x': 51.2069, 'y': -2.1768, 'CRS': 'WMN'},
-    {'x': 53.327, 'y': -2.226, 'CRS': 'WML'},
-    {'x': 52.2226, 'y': -1.7559, 'CRS': 'WMC'},
-    {'x': 51.552633, 'y': -0.29663, 'CRS': 'WMB'},
-    {'x': 51.292, 'y': 0.419, 'CRS': 'WMA'},
-    {'x': 51.736, 'y': -0.211, 'CRS': 'WMG'},
-    {'x': 51.3192, 'y': -0.1539, 'CRS': 'WME'},
-    {'x': 52.56484, 'y': 1.11765, 'CRS': 'WMD'},
-    {'x': 52.336, 'y': -3.213, 'CRS': 'LLT'},
-    {'x': 51.4788, 'y': -0.0265, 'CRS': 'DEP'},
-    {'x': 53.692, 'y': -1.633, 'CRS': 'DEW'},
-    {'x': 51.0424, 'y': -1.6347, 'CRS': 'DEN'},
-    {'x': 51.2231, 'y': 1.3989, 'CRS': 'DEA'},
-    {'x': 56.4566, 'y': -2.9710, 'CRS': 'DEE'},
-    {'x': 52.51222, 'y': -3.31194, 'CRS': 'NWT'},
-    {'x': 51.4994, 'y': 0.0623, 'CRS': 'NWW'},
-    {'x': 51.5896, 'y': -2.9990, 'CRS': 'NWP'},
-    {'x': 51.5171, 'y': -0.2668, 'CRS': 'AML'},
-    {'x': 57.0595, 'y': -4.1184, 'CRS': 'NWR'},
-    {'x': 53.061, 'y': -1.481, 'CRS': 'AMB'},
-    {'x': 51.4766, 'y': -0.0327, 'CRS': 'NWX'},
-    {'x': 51.7951, 'y': -3.9959, 'CRS': 'AMF'},
-    {'x': 51.3972, 'y': -0.075, 'CRS': 'NWD'},
-    {'x': 51.980, 'y': 0.215, 'CRS': 'NWE'},
-    {'x': 52.8169, 'y': 1.3846, 'CRS': 'NWA'},
-    {'x': 51.5627, 'y': -0.3040, 'CRS': 'NWB'},
-    {'x': 50.756, 'y': -1.658, 'CRS': 'NWM'},
-    {'x': 53.457, 'y': -2.067, 'CRS': 'NWN'},
-    {'x': 51.674, 'y': -0.607, 'CRS': 'AMR'},
-    {'x': 53.261, 'y': -2.497, 'CRS': 'NWI'},
-    {'x': 53.528, 'y': -2.741, 'CRS': 'UPL'},
-    {'x': 51.559, 'y': 0.2511, 'CRS': 'UPM'},
-    {'x': 51.413, 'y': -0.431, 'CRS': 'UPH'},
-    {'x': 50.648, 'y': -2.466, 'CRS': 'UPW'},
-    {'x': 53.38583, 'y': -3.08389, 'CRS': 'UPT'},
-    {'x': 56.0024, 'y': -3.7856, 'CRS': 'FKG'},
-    {'x': 52.92086, 'y': -4.10469, 'CRS': '6HT'},
-    {'x': 51.509, 'y': -0.507, 'CRS': 'IVR'},
-    {'x': 50.3935, 'y': -3.90513, 'CRS': 'IVY'},
-    {'x': 51.5087, 'y': -0.2630, 'CRS': 'ACC'},
-    {'x': 53.2664, 'y': -2.6029, 'CRS': 'ACB'},
-    {'x': 53.835, 'y': -2.214, 'CRS': 'NEL'},
-    {'x': 51.4039, 'y': -0.256, 'CRS': 'NEM'},
-    {'x': 52.449, 'y': -1.818, 'CRS': 'ACG'},
-    {'x': 51.4375, 'y': 0.0722, 'CRS': 'NEH'},
-    {'x': 55.7829, 'y': -4.4269, 'CRS': 'NEI'},
-    {'x': 55.307, 'y': -1.652, 'CRS': 'ACK'},
-    {'x': 53.588880, 'y': -1.023360, 'CRS': 'HFS'},
-    {'x': 57.4821, 'y': -5.3331, 'CRS': 'ACH'},
-    {'x': 57.5793, 'y': -5.0723, 'CRS': 'ACN'},
-    {'x': 52.63444, 'y': 1.54361, 'CRS': 'ACL'},
-    {'x': 53.753, 'y': -2.370, 'CRS': 'ACR'},
-    {'x': 51.406, 'y': -0.676, 'CRS': 'ACT'},
-    {'x': 55.9330, 'y': -3.0908, 'CRS': 'NEW'},
-    {'x': 52.96139, 'y': -1.07917, 'CRS': 'NET'},
-    {'x': 51.799, 'y': -0.073, 'CRS': 'HFE'},
-    {'x': 53.292, 'y': -3.064, 'CRS': 'NES'},
-    {'x': 52.406, 'y': -2.176, 'CRS': 'BKD'},
-    {'x': 56.9001, 'y': -5.7640, 'CRS': 'BSL'},
-    {'x': 51.5393, 'y': 0.0817, 'CRS': 'BKG'},
-    {'x': 51.289, 'y': -0.384, 'CRS': 'BKA'},
-    {'x': 53.389, 'y': -3.019, 'CRS': 'BKC'},
-    {'x': 51.3995, 'y': 0.0441, 'CRS': 'BKL'},
-    {'x': 51.763, 'y': -0.562, 'CRS': 'BKM'},
-    {'x': 53.405, 'y': -3.057, 'CRS': 'BKN'},
-    {'x': 51.304, 'y': -0.636, 'CRS': 'BKO'},
-    {'x': 51.4658, 'y': 0.0089, 'CRS': 'BKH'},
-    {'x': 51.4109, 'y': -0.0257, 'CRS': 'BKJ'},
-    {'x': 52.605, 'y': -1.845, 'CRS': 'BKT'},
-    {'x': 52.396, 'y': -1.643, 'CRS': 'BKW'},
-    {'x': 53.3974, 'y': -3.0390, 'CRS': 'BKP'},
-    {'x': 53.3947, 'y': -3.0139, 'CRS': 'BKQ'},
-    {'x': 55.881, 'y': -3.766, 'CRS': 'BKR'},
-    {'x': 51.261, 'y': 1.137, 'CRS': 'BKS'},
-    {'x': 51.581, 'y': -0.0323, 'CRS': 'SJS'},
-    {'x': 50.73059, 'y': -3.52233, 'CRS': 'SJP'},
-    {'x': 51.582, 'y': 0.2063, 'CRS': 'GDP'},
-    {'x': 53.646, 'y': -2.975, 'CRS': 'MEC'},
-    {'x': 52.0907, 'y': 0.0089, 'CRS': 'MEL'},
-    {'x': 53.3992, 'y': -3.1552, 'CRS': 'MEO'},
-    {'x': 50.4269, 'y': -4.4103, 'CRS': 'MEN'},
-    {'x': 51.6053, 'y': -3.6483, 'CRS': 'MEW'},
-    {'x': 51.6866, 'y': -3.3370, 'CRS': 'MEV'},
-    {'x': 51.3864083, 'y': 0.3569972, 'CRS': 'MEP'},
-    {'x': 52.104, 'y': 1.338, 'CRS': 'MES'},
-    {'x': 51.7444, 'y': -3.3773, 'CRS': 'MER'},
-    {'x': 51.6632, 'y': -0.0943, 'CRS': 'GDH'},
-    {'x': 53.452, 'y': -2.055, 'CRS': 'GDL'},
-    {'x': 53.491, 'y': -1.289, 'CRS': 'MEX'},
-    {'x': 51.218, 'y': -0.050, 'CRS': 'GDN'},
-    {'x': 55.6967, 'y': -4.8514, 'CRS': 'WKB'},
-    {'x': 53.139, 'y': -3.795, 'CRS': 'LWR'},
-    {'x': 50.87083, 'y': 0.01167, 'CRS': 'LWS'},
-    {'x': 52.4742, 'y': 1.7498, 'CRS': 'LWT'},
-    {'x': 51.4582, 'y': -2.5644, 'CRS': 'LWH'},
-    {'x': 51.313, 'y': 0.197, 'CRS': 'OTF'},
-    {'x': 51.410, 'y': -3.482, 'CRS': 'LWM'},
-    {'x': 51.6650, 'y': -3.5215, 'CRS': 'YNW'},
-    {'x': 51.4039, 'y': -0.0568, 'CRS': 'BIK'},
-    {'x': 52.515, 'y': -1.853, 'CRS': 'GVH'},
-    {'x': 51.6200, 'y': -3.4492, 'CRS': 'TNP'},
-    {'x': 53.6034, 'y': -0.9549, 'CRS': 'TNS'},
-    {'x': 57.6130, 'y': -4.6883, 'CRS': 'GVE'},
-    {'x': 52.614, 'y': -4.124, 'CRS': 'TNF'},
-    {'x': 53.6545, 'y': -0.3231, 'CRS': 'TNA'},
-    {'x': 53.6162, 'y': -0.9724, 'CRS': 'TNN'},
-    {'x': 55.8195, 'y': -4.2462, 'CRS': 'KGP'},
-    {'x': 52.021, 'y': -1.281, 'CRS': 'KGS'},
-    {'x': 51.732, 'y': -4.715, 'CRS': 'KGT'},
-    {'x': 51.5309, 'y': -0.1233, 'CRS': 'KGX'},
-    {'x': 51.5458, 'y': -0.1050, 'CRS': 'HHY'},
-    {'x': 54.0335, 'y': -2.9125, 'CRS': 'HHB'},
-    {'x': 55.9190, 'y': -3.2642, 'CRS': 'KGE'},
-    {'x': 51.005, 'y': -0.105, 'CRS': 'HHE'},
-    {'x': 53.308, 'y': -4.631, 'CRS': 'HHD'},
-    {'x': 56.0692, 'y': -3.1743, 'CRS': 'KGH'},
-    {'x': 51.902, 'y': -1.629, 'CRS': 'KGM'},
-    {'x': 51.706, 'y': -0.438, 'CRS': 'KGL'},
-    {'x': 51.5168, 'y': -3.1816, 'CRS': 'HHL'},
-    {'x': 51.5715, 'y': -3.2186, 'CRS': 'CPH'},
-    {'x': 53.42944, 'y': -2.09278, 'CRS': 'WLY'},
-    {'x': 51.629, 'y': -0.386, 'CRS': 'CPK'},
-    {'x': 51.4625, 'y': -2.1154, 'CRS': 'CPM'},
-    {'x': 51.016, 'y': -4.024, 'CRS': 'CPN'},
-    {'x': 52.657469, 'y': -3.139947, 'CRS': 'WLP'},
-    {'x': 56.8428, 'y': -5.1221, 'CRS': 'CPA'},
-    {'x': 50.899, 'y': -1.377, 'CRS': 'WLS'},
-    {'x': 51.3592, 'y': -0.1533, 'CRS': 'WLT'},
-    {'x': 53.423, 'y': -3.069, 'CRS': 'WLV'},
-    {'x': 51.824, 'y': -0.192, 'CRS': 'WLW'},
-    {'x': 51.4647, 'y': 0.1017, 'CRS': 'WLI'},
-    {'x': 55.7942, 'y': -4.2894, 'CRS': 'WLM'},
-    {'x': 52.7015, 'y': -2.517, 'CRS': 'WLN'},
-    {'x': 53.4749, 'y': -3.0256, 'CRS': 'WLO'},
-    {'x': 51.6851, 'y': -0.0266, 'CRS': 'WLC'},
-    {'x': 50.853, 'y': 0.540, 'CRS': 'WLD'},
-    {'x': 52.5493, 'y': -0.1184, 'CRS': 'WLE'},
-    {'x': 52.104, 'y': 0.166, 'CRS': 'WLF'},
-    {'x': 53.428, 'y': -3.070, 'CRS': 'WLG'},
-    {'x': 56.8899, 'y': -4.9215, 'CRS': 'SBR'},
-    {'x': 53.020, 'y': -2.596, 'CRS': 'WRE'},
-    {'x': 51.939, 'y': 1.172, 'CRS': 'WRB'},
-    {'x': 52.9355, 'y': 1.2457, 'CRS': 'WRN'},
-    {'x': 54.884, 'y': -2.832, 'CRS': 'WRL'},
-    {'x': 50.693, 'y': -2.115, 'CRS': 'WRM'},
-    {'x': 53.311667, 'y': -1.122778, 'CRS': 'WRK'},
-    {'x': 50.81861, 'y': -0.37583, 'CRS': 'WRH'},
-    {'x': 52.2865, 'y': -1.5819, 'CRS': 'WRW'},
-    {'x': 52.77733, 'y': 1.40274, 'CRS': 'WRT'},
-    {'x': 53.77292, 'y': -0.92401, 'CRS': 'WRS'},
-    {'x': 52.286, 'y': -1.612, 'CRS': 'WRP'},
-    {'x': 52.742, 'y': -4.077, 'CRS': 'LLA'},
-    {'x': 53.05083, 'y': -3.00139, 'CRS': 'WRX'},
-    {'x': 51.458, 'y': -0.542, 'CRS': 'WRY'},
-    {'x': 51.254, 'y': -1.260, 'CRS': 'OVR'},
-    {'x': 51.667, 'y': -4.873, 'CRS': 'LAM'},
-    {'x': 54.048, 'y': -2.807, 'CRS': 'LAN'},
-    {'x': 51.5677, 'y': 0.42358, 'CRS': 'LAI'},
-    {'x': 52.448, 'y': 0.534, 'CRS': 'LAK'},
-    {'x': 51.4562, 'y': -0.0192, 'CRS': 'LAD'},
-    {'x': 50.96389, 'y': -0.12083, 'CRS': 'WVF'},
-    {'x': 53.232694, 'y': -1.209278, 'CRS': 'LAG'},
-    {'x': 50.82694, 'y': -0.32333, 'CRS': 'LAC'},
-    {'x': 53.8350, 'y': -3.0306, 'CRS': 'LAY'},
-    {'x': 53.284, 'y': -2.925, 'CRS': 'OVE'},
-    {'x': 56.8368, 'y': -2.4653, 'CRS': 'LAU'},
-    {'x': 52.657, 'y': -2.021, 'CRS': 'LAW'},
-    {'x': 50.8575, 'y': -3.8108, 'CRS': 'LAP'},
-    {'x': 55.7928, 'y': -4.8673, 'CRS': 'LAR'},
-    {'x': 51.6615, 'y': -3.8848, 'CRS': 'LAS'},
-    {'x': 53.139, 'y': -0.391, 'CRS': 'MGM'},
-    {'x': 53.4575, 'y': -2.1306, 'CRS': 'DTN'},
-    {'x': 54.6595, 'y': -5.6929, 'CRS': '3R'},
-    {'x': 53.449, 'y': -1.970, 'CRS': 'DTG'},
-    {'x': 52.268, 'y': -2.158, 'CRS': 'DTW'},
-    {'x': 51.6184, 'y': -0.1102, 'CRS': 'PAL'},
-    {'x': 56.8207, 'y': -5.1047, 'CRS': 'FTW'},
-    {'x': 52.346, 'y': -1.968, 'CRS': 'ALV'},
-    {'x': 57.6891, 'y': -4.1745, 'CRS': 'IGD'},
-    {'x': 51.993, 'y': -0.188, 'CRS': 'BDK'},
-    {'x': 55.9589, 'y': -4.7953, 'CRS': 'FTM'},
-    {'x': 53.3875, 'y': -2.3472, 'CRS': 'ALT'},
-    {'x': 50.7964, 'y': -1.0740, 'CRS': 'FTN'},
-    {'x': 50.19730, 'y': -5.46424, 'CRS': 'CBB'},
-    {'x': 55.8629, 'y': -4.0323, 'CRS': 'CBC'},
-    {'x': 52.194, 'y': 0.138, 'CRS': 'CBG'},
-    {'x': 51.2742444, 'y': 1.0759278, 'CRS': 'CBE'},
-    {'x': 51.5321, 'y': -0.0572, 'CRS': 'CBH'},
-    {'x': 50.2097, 'y': -5.2984, 'CRS': 'CBN'},
-    {'x': 55.8195, 'y': -4.1731, 'CRS': 'CBL'},
-    {'x': 50.904, 'y': -0.009, 'CRS': 'CBR'},
-    {'x': 55.8669, 'y': -4.0281, 'CRS': 'CBS'},
-    {'x': 51.5228, 'y': -0.3323, 'CRS': 'CBP'},
-    {'x': 51.2840639, 'y': 1.0753806, 'CRS': 'CBW'},
-    {'x': 51.872, 'y': -1.490, 'CRS': 'CBY'},
-    {'x': 51.394, 'y': 0.106, 'CRS': 'SMY'},
-    {'x': 51.788, 'y': 0.001, 'CRS': 'SMT'},
-    {'x': 52.496, 'y': -1.971, 'CRS': 'SMR'},
-    {'x': 51.403, 'y': -0.2062, 'CRS': 'SMO'},
-    {'x': 51.66006, 'y': 0.83386, 'CRS': 'SMN'},
-    {'x': 51.4799, 'y': -2.6498, 'CRS': 'SML'},
-    {'x': 52.190, 'y': 1.000, 'CRS': 'SMK'},
-    {'x': 51.5742, 'y': -0.0779, 'CRS': 'SMH'},
-    {'x': 51.455, 'y': -0.3204, 'CRS': 'SMG'},
-    {'x': 52.6480, 'y': -0.4798, 'CRS': 'SMD'},
-    {'x': 50.76975, 'y': -3.94896, 'CRS': 'SMC'},
-    {'x': 53.6333, 'y': -2.1134, 'CRS': 'SMB'},
-    {'x': 52.463, 'y': -1.858, 'CRS': 'SMA'},
-    {'x': 53.978300, 'y': -2.105000, 'CRS': 'GGV'},
-    {'x': 50.780, 'y': -2.569, 'CRS': 'MDN'},
-    {'x': 53.360, 'y': -2.083, 'CRS': 'MDL'},
-    {'x': 51.2773056, 'y': 0.5140889, 'CRS': 'MDB'},
-    {'x': 51.3502, 'y': -0.2569, 'CRS': 'EWW'},
-    {'x': 51.3961, 'y': -1.1783, 'CRS': 'MDG'},
-    {'x': 51.278, 'y': 0.521, 'CRS': 'MDE'},
-    {'x': 51.3965, 'y': -0.199, 'CRS': 'MDS'},
-    {'x': 51.2706944, 'y': 0.5156944, 'CRS': 'MDW'},
-    {'x': 58.5135, 'y': -3.4518, 'CRS': 'GGJ'},
-    {'x': 52.4897, 'y': -1.9136, 'CRS': 'JEQ'},
-    {'x': 55.9412, 'y': -4.7723, 'CRS': 'DFR'},
-    {'x': 56.0803, 'y': -3.4214, 'CRS': 'DFL'},
-    {'x': 52.988, 'y': -1.486, 'CRS': 'DFI'},
-    {'x': 56.0682, 'y': -3.4521, 'CRS': 'DFE'},
-    {'x': 51.4475, 'y': 0.2193, 'CRS': 'DFD'},
-    {'x': 52.125150, 'y': -2.319403, 'CRS': 'MVL'},
-    {'x': 51.648, 'y': 0.752, 'CRS': 'ALN'},
-    {'x': 56.1179, 'y': -3.7883, 'CRS': 'ALO'},
-    {'x': 55.392, 'y': -1.636, 'CRS': 'ALM'},
-    {'x': 52.95167, 'y': -0.89861, 'CRS': 'ALK'},
-    {'x': 53.100, 'y': -1.370, 'CRS': 'ALF'},
-    {'x': 53.304, 'y': -2.237, 'CRS': 'ALD'},
-    {'x': 54.3327, 'y': -1.4415, 'CRS': 'NTR'},
-    {'x': 52.63778, 'y': -2.2683, 'CRS': 'ALB'},
-    {'x': 51.662, 'y': -3.807, 'CRS': 'NTH'},
-    {'x': 50.875, 'y': -1.342, 'CRS': 'NTL'},
-    {'x': 55.9853, 'y': -4.5773, 'CRS': 'ALX'},
-    {'x': 55.8188, 'y': -4.1337, 'CRS': 'NTN'},
-    {'x': 50.5300, 'y': -3.5997, 'CRS': 'NTA'},
-    {'x': 54.524, 'y': -1.363, 'CRS': 'ALW'},
-    {'x': 50.77884, 'y': -3.58915, 'CRS': 'NTC'},
-    {'x': 52.86583, 'y': -2.19028, 'CRS': 'NTB'},
-    {'x': 51.85389, 'y': 0.99694, 'CRS': 'ALR'},
-    {'x': 53.58557, 'y': -0.73300, 'CRS': 'ALP'},
-    {'x': 53.208, 'y': -2.8914, 'CRS': 'BAC'},
-    {'x': 50.68588, 'y': -3.46401, 'CRS': 'TOP'},
-    {'x': 50.43560, 'y': -3.68868, 'CRS': 'TOT'},
-    {'x': 50.9003, 'y': 0.6136, 'CRS': 'TOK'},
-    {'x': 51.191, 'y': 0.271, 'CRS': 'TON'},
-    {'x': 51.4196, 'y': -0.1603, 'CRS': 'TOO'},
-    {'x': 51.3839, 'y': -0.2807, 'CRS': 'TOL'},
-    {'x': 51.588333, 'y': -0.059722, 'CRS': 'TOM'},
-    {'x': 53.7138, 'y': -2.0997, 'CRS': 'TOD'},
-    {'x': 51.313, 'y': 0.455, 'CRS': 'NHE'},
-    {'x': 51.4671, 'y': -0.0527, 'CRS': 'NHD'},
-    {'x': 54.149380, 'y': -2.302000, 'CRS': 'HIR'},
-    {'x': 51.953, 'y': -0.263, 'CRS': 'HIT'},
-    {'x': 51.4816, 'y': 0.1754, 'CRS': 'ERH'},
-    {'x': 51.089, 'y': 0.201, 'CRS': 'ERI'},
-    {'x': 52.429, 'y': -1.700, 'CRS': 'HIA'},
-    {'x': 51.149, 'y': 0.277, 'CRS': 'HIB'},
-    {'x': 53.5969, 'y': -2.4132, 'CRS': 'HID'},
-    {'x': 51.2184, 'y': -2.9719, 'CRS': 'HIG'},
-    {'x': 53.622, 'y': -3.025, 'CRS': 'HIL'},
-    {'x': 53.5424, 'y': -2.5750, 'CRS': 'HIN'},
-    {'x': 51.6084, 'y': -0.0001, 'CRS': 'HIP'},
-    {'x': 58.3882, 'y': -3.7059, 'CRS': 'ABC'},
-    {'x': 57.1436, 'y': -2.0985, 'CRS': 'ABD'},
-    {'x': 51.5749, 'y': -3.2299, 'CRS': 'ABE'},
-    {'x': 51.577, 'y': -0.1052, 'CRS': 'HGY'},
-    {'x': 52.898, 'y': -4.375, 'CRS': 'ABH'},
-    {'x': 51.645, 'y': -3.327, 'CRS': 'ACY'},
-    {'x': 51.5468, 'y': -0.1468, 'CRS': 'KTW'},
-    {'x': 51.4519, 'y': -0.0008, 'CRS': 'HGR'},
-    {'x': 50.858, 'y': 0.576, 'CRS': 'HGS'},
-    {'x': 53.3725, 'y': -2.775, 'CRS': 'HGN'},
-    {'x': 51.5504, 'y': -0.1406, 'CRS': 'KTN'},
-    {'x': 51.4267000, 'y': 0.4663083, 'CRS': 'HGM'},
-    {'x': 51.4123, 'y': -0.0453, 'CRS': 'KTH'},
-    {'x': 51.4910, 'y': 0.1214, 'CRS': 'ABW'},
-    {'x': 53.5335, 'y': -2.4939, 'CRS': 'HGF'},
-    {'x': 53.471806, 'y': -2.19500, 'CRS': 'ABY'},
-    {'x': 51.415, 'y': -1.512, 'CRS': 'HGD'},
-    {'x': 52.451, 'y': -1.725, 'CRS': 'BHI'},
-    {'x': 51.6418, 'y': -0.0691, 'CRS': 'BHK'},
-    {'x': 52.47777, 'y': -1.89885, 'CRS': 'BHM'},
-    {'x': 51.586944, 'y': -0.041389, 'CRS': 'BHO'},
-    {'x': 56.0021, 'y': -4.5831, 'CRS': 'BHC'},
-    {'x': 51.7098, 'y': -3.2281, 'CRS': 'BHD'},
-    {'x': 55.8971, 'y': -3.6362, 'CRS': 'BHG'},
-    {'x': 53.702, 'y': -0.360, 'CRS': 'NHL'},
-    {'x': 53.5970, 'y': -1.7698, 'CRS': 'BHS'},
-    {'x': 52.1689, 'y': -3.4271, 'CRS': 'BHR'},
-    {'x': 51.126, 'y': -0.018, 'CRS': 'EGR'},
-    {'x': 54.437500, 'y': -0.761500, 'CRS': 'EGT'},
-    {'x': 51.430, 'y': -0.547, 'CRS': 'EGH'},
-    {'x': 53.75500, 'y': -0.78500, 'CRS': 'EGN'},
-    {'x': 50.8878, 'y': -3.87525, 'CRS': 'EGG'},
-    {'x': 53.792, 'y': -1.371, 'CRS': 'EGF'},
-    {'x': 51.686, 'y': -1.240, 'CRS': 'RAD'},
-    {'x': 52.821, 'y': -4.110, 'CRS': 'LBR'},
-    {'x': 56.0222, 'y': -3.8298, 'CRS': 'LBT'},
-    {'x': 56.6859, 'y': -4.5770, 'CRS': 'RAN'},
-    {'x': 51.3408, 'y': 1.4060, 'CRS': 'RAM'},
-    {'x': 51.366411, 'y': 0.611328, 'CRS': 'RAI'},
-    {'x': 54.356, 'y': -3.409, 'CRS': 'RAV'},
-    {'x': 52.985194, 'y': -0.456265, 'CRS': 'RAU'},
-    {'x': 52.012, 'y': -4.986, 'CRS': 'FGH'},
-    {'x': 51.505, 'y': -0.086, 'CRS': 'LBG'},
-    {'x': 52.295, 'y': -1.086, 'CRS': 'LBK'},
-    {'x': 52.7790750, 'y': -1.1960472, 'CRS': 'LBO'},
-    {'x': 51.4094, 'y': -0.2299, 'CRS': 'RAY'},
-    {'x': 52.99460, 'y': -3.93838, 'CRS': 'BFF'},
-    {'x': 50.4514, 'y': -4.18125, 'CRS': 'BFE'},
-    {'x': 51.4875, 'y': -0.3096, 'CRS': 'BFD'},
-    {'x': 52.3420, 'y': -1.7257, 'CRS': 'LPW'},
-    {'x': 53.042, 'y': -2.216, 'CRS': 'LPT'},
-    {'x': 51.3497, 'y': -0.4812, 'CRS': 'BFN'},
-    {'x': 51.363, 'y': 0.204, 'CRS': 'EYN'},
-    {'x': 51.5116, 'y': -0.103, 'CRS': 'BFR'},
-    {'x': 53.221, 'y': -4.209, 'CRS': 'LPG'},
-    {'x': 56.4336, 'y': -4.7135, 'CRS': 'TYL'},
-    {'x': 51.4966, 'y': -0.1448, 'CRS': 'VIC'},
-    {'x': 53.60083, 'y': -2.09444, 'CRS': 'NHY'},
-    {'x': 52.893728, 'y': -4.078597, 'CRS': 'TYG'},
-    {'x': 53.223, 'y': -4.475, 'CRS': 'TYC'},
-    {'x': 51.402, 'y': -0.562, 'CRS': 'VIR'},
-    {'x': 51.6604, 'y': -3.3231, 'CRS': 'QYD'},
-    {'x': 52.5854, 'y': -4.0937, 'CRS': 'TYW'},
-    {'x': 52.454, 'y': -1.839, 'CRS': 'TYS'},
-    {'x': 51.52, 'y': 0.290, 'CRS': 'OCK'},
-    {'x': 51.7145, 'y': -3.4420, 'CRS': 'ABA'},
-    {'x': 51.5592, 'y': 0.0700, 'CRS': 'IFD'},
-    {'x': 56.1201, 'y': -3.9351, 'CRS': 'STG'},
-    {'x': 50.9116, 'y': -1.4343, 'CRS': 'MBK'},
-    {'x': 51.116, 'y': -0.215, 'CRS': 'IFI'},
-    {'x': 53.312, 'y': -1.919, 'CRS': 'CEF'},
-    {'x': 51.85833, 'y': -0.66222, 'CRS': 'CED'},
-    {'x': 55.8044, 'y': -3.9107, 'CRS': 'CEA'},
-    {'x': 53.271, 'y': -2.280, 'CRS': 'CEL'},
-    {'x': 53.525, 'y': -3.057, 'CRS': 'HTO'},
-    {'x': 52.517, 'y': -1.708, 'CRS': 'CEH'},
-    {'x': 51.8865, 'y': 0.9046, 'CRS': 'CET'},
-    {'x': 51.852, 'y': 0.578, 'CRS': 'CES'},
-    {'x': 52.724, 'y': -2.119, 'CRS': 'PKG'},
-    {'x': 53.3757, 'y': -2.9529, 'CRS': 'STM'},
-    {'x': 53.993309, 'y': -1.537372, 'CRS': 'HGT'},
-    {'x': 53.9173, 'y': -2.0119, 'CRS': 'CEY'},
-    {'x': 54.4672, 'y': -0.9466, 'CRS': 'CSM'},
-    {'x': 52.627, 'y': -2.202, 'CRS': 'CSL'},
-    {'x': 53.668, 'y': -2.778, 'CRS': 'CSO'},
-    {'x': 51.3642, 'y': -0.3005, 'CRS': 'CSN'},
-    {'x': 51.3686, 'y': -0.1659, 'CRS': 'CSH'},
-    {'x': 50.49812, 'y': -4.20902, 'CRS': 'CSK'},
-    {'x': 51.317684, 'y': -0.389878, 'CRS': 'CSD'},
-    {'x': 53.3588, 'y': -2.9120, 'CRS': 'CSG'},
-    {'x': 50.84194, 'y': -1.06750, 'CRS': 'CSA'},
-    {'x': 53.296, 'y': -3.725, 'CRS': 'CWB'},
-    {'x': 51.3580, 'y': -2.9094, 'CRS': 'WOR'},
-    {'x': 53.5175, 'y': -1.4164, 'CRS': 'WOM'},
-    {'x': 52.0653, 'y': -0.80357, 'CRS': 'WOL'},
-    {'x': 50.682, 'y': -2.221, 'CRS': 'WOO'},
-    {'x': 51.846, 'y': 1.268, 'CRS': 'WON'},
-    {'x': 52.545, 'y': -2.086, 'CRS': 'CSY'},
-    {'x': 51.290, 'y': -0.052, 'CRS': 'WOH'},
-    {'x': 51.318, 'y': -0.557, 'CRS': 'WOK'},
-    {'x': 51.5104, 'y': -0.0907, 'CRS': 'CST'},
-    {'x': 51.3602250, 'y': 1.0668611, 'CRS': 'CSW'},
-    {'x': 52.195, 'y': -2.222, 'CRS': 'WOF'},
-    {'x': 51.3569, 'y': -0.308, 'CRS': 'CSS'},
-    {'x': 52.018, 'y': -0.654, 'CRS': 'WOB'},
-    {'x': 53.485, 'y': -0.594, 'CRS': 'KTL'},
-    {'x': 51.4461, 'y': -3.1891, 'CRS': 'CGN'},
-    {'x': 51.394, 'y': -1.243, 'CRS': 'THA'},
-    {'x': 53.4621, 'y': -2.2914, 'CRS': 'MUF'},
-    {'x': 55.9335, 'y': -3.0725, 'CRS': 'MUB'},
-    {'x': 55.8101, 'y': -4.2739, 'CRS': 'MUI'},
-    {'x': 57.6944, 'y': -4.2497, 'CRS': 'ASS'},
-    {'x': 51.581, 'y': -0.518, 'CRS': 'DGC'},
-    {'x': 54.759, 'y': -3.332, 'CRS': 'ASP'},
-    {'x': 52.504, 'y': -1.872, 'CRS': 'AST'},
-    {'x': 50.846, 'y': -0.883, 'CRS': 'NUT'},
-    {'x': 51.4400, 'y': -3.1801, 'CRS': 'DGL'},
-    {'x': 52.5264, 'y': -1.4636, 'CRS': 'NUN'},
-    {'x': 55.6410, 'y': -4.8001, 'CRS': 'ASB'},
-    {'x': 51.6017, 'y': -0.0541, 'CRS': 'NUM'},
-    {'x': 53.0928, 'y': -2.2981, 'CRS': 'ASG'},
-    {'x': 55.8888, 'y': -4.2484, 'CRS': 'ASF'},
-    {'x': 53.4742, 'y': -2.2508, 'CRS': 'DGT'},
-    {'x': 51.227, 'y': -0.133, 'CRS': 'NUF'},
-    {'x': 53.295, 'y': -3.833, 'CRS': 'DGY'},
-    {'x': 51.373, 'y': -0.484, 'CRS': 'ASN'},
-    {'x': 52.202, 'y': 0.367, 'CRS': 'DUL'},
-    {'x': 55.8450, 'y': -4.3008, 'CRS': 'DUM'},
-    {'x': 55.9985, 'y': -2.5145, 'CRS': 'DUN'},
-    {'x': 52.488, 'y': -1.871, 'CRS': 'DUD'},
-    {'x': 52.451, 'y': -1.936, 'CRS': 'UNI'},
-    {'x': 50.81750, 'y': -0.41111, 'CRS': 'DUR'},
-    {'x': 53.5692, 'y': -2.8811, 'CRS': 'OMS'},
-    {'x': 57.6096, 'y': -4.9135, 'CRS': 'AAT'},
-    {'x': 51.5983, 'y': -0.1197, 'CRS': 'AAP'},
-    {'x': 51.226, 'y': 0.412, 'CRS': 'YAL'},
-    {'x': 52.95417, 'y': -0.95139, 'CRS': 'BIN'},
-    {'x': 55.8445, 'y': -4.1137, 'CRS': 'BIO'},
-    {'x': 54.606, 'y': -1.279, 'CRS': 'BIL'},
-    {'x': 51.4895, 'y': -0.2878, 'CRS': 'KWB'},
-    {'x': 55.8542, 'y': -4.0481, 'CRS': 'KWD'},
-    {'x': 51.4771, 'y': -0.2853, 'CRS': 'KWG'},
-    {'x': 54.119, 'y': -3.226, 'CRS': 'BIF'},
-    {'x': 51.015, 'y': -0.450, 'CRS': 'BIG'},
-    {'x': 53.409, 'y': -3.079, 'CRS': 'BID'},
-    {'x': 53.6793, 'y': -1.3574, 'CRS': 'FEA'},
-    {'x': 51.629, 'y': 0.419, 'CRS': 'BIC'},
-    {'x': 54.6573, 'y': -1.6778, 'CRS': 'BIA'},
-    {'x': 53.8487, 'y': -1.8372, 'CRS': 'BIY'},
-    {'x': 52.085, 'y': -0.261, 'CRS': 'BIW'},
-    {'x': 51.8931, 'y': -1.1485, 'CRS': 'BIT'},
-    {'x': 51.867, 'y': 0.165, 'CRS': 'BIS'},
-    {'x': 50.780, 'y': 0.083, 'CRS': 'BIP'},
-    {'x': 52.441, 'y': -1.935, 'CRS': 'SLY'},
-    {'x': 52.7077, 'y': -4.0316, 'CRS': 'MFA'},
-    {'x': 55.6340, 'y': -4.7849, 'CRS': 'SLT'},
-    {'x': 51.615, 'y': -0.067, 'CRS': 'SLV'},
-    {'x': 53.7819, 'y': -2.8195, 'CRS': 'SLW'},
-    {'x': 50.856, 'y': 0.561, 'CRS': 'SLQ'},
-    {'x': 52.995488, 'y': -0.410350, 'CRS': 'SLR'},
-    {'x': 55.8536, 'y': -4.1599, 'CRS': 'SLS'},
-    {'x': 53.58713, 'y': -0.18357, 'CRS': 'SLL'},
-    {'x': 51.512, 'y': -0.592, 'CRS': 'SLO'},
-    {'x': 54.461100, 'y': -0.662600, 'CRS': 'SLH'},
-    {'x': 53.5350, 'y': -1.5635, 'CRS': 'SLK'},
-    {'x': 53.48639, 'y': -2.27583, 'CRS': 'SLD'},
-    {'x': 55.9265, 'y': -3.2441, 'CRS': 'SLA'},
-    {'x': 54.5835, 'y': -0.9740, 'CRS': 'SLB'},
-    {'x': 53.4739, 'y': -2.2422, 'CRS': 'MCO'},
-    {'x': 51.768, 'y': -4.369, 'CRS': 'FYS'},
-    {'x': 54.070, 'y': -2.870, 'CRS': 'MCM'},
-    {'x': 52.5605, 'y': 0.0905, 'CRS': 'MCH'},
-    {'x': 54.958911, 'y': -1.664898, 'CRS': 'MCE'},
-    {'x': 50.84639, 'y': -0.11889, 'CRS': 'MCB'},
-    {'x': 52.948889, 'y': -1.036667, 'CRS': 'RDF'},
-    {'x': 55.8039, 'y': -4.2930, 'CRS': 'GFN'},
-    {'x': 53.4872, 'y': -2.2424, 'CRS': 'MCV'},
-    {'x': 51.6842, 'y': -3.2274, 'CRS': 'GFF'},
-    {'x': 51.5426, 'y': -0.3463, 'CRS': 'GFD'},
-    {'x': 52.62333, 'y': 1.41833, 'CRS': 'BGA'},
-    {'x': 50.7296, 'y': -3.54354, 'CRS': 'EXD'},
-    {'x': 51.6928, 'y': -3.2299, 'CRS': 'BGD'},
-    {'x': 50.7264, 'y': -3.53300, 'CRS': 'EXC'},
-    {'x': 53.549, 'y': -0.486, 'CRS': 'BGG'},
-    {'x': 53.698, 'y': -1.779, 'CRS': 'BGH'},
-    {'x': 55.8513, 'y': -4.0738, 'CRS': 'BGI'},
-    {'x': 50.62179, 'y': -3.41507, 'CRS': 'EXM'},
-    {'x': 50.4000, 'y': -4.79196, 'CRS': 'BGL'},
-    {'x': 51.4328, 'y': -0.0194, 'CRS': 'BGM'},
-    {'x': 51.50694, 'y': -3.57500, 'CRS': 'BGN'},
-    {'x': 54.948778, 'y': -1.971861, 'CRS': 'RDM'},
-    {'x': 50.71713, 'y': -3.53858, 'CRS': 'EXT'},
-    {'x': 55.9372, 'y': -4.7124, 'CRS': 'BGS'},
-    {'x': 51.5406, 'y': -0.0963, 'CRS': 'EXR'},
-    {'x': 52.060, 'y': -1.328, 'CRS': 'BAN'},
-    {'x': 52.68017, 'y': -1.82571, 'CRS': 'LIC'},
-    {'x': 51.24022, 'y': -0.165900, 'CRS': 'RDH'},
-    {'x': 51.5552, 'y': -0.1514, 'CRS': 'GPO'},
-    {'x': 51.4854, 'y': -0.1229, 'CRS': 'VXH'},
-    {'x': 51.6431, 'y': -0.0969, 'CRS': 'GPK'},
-    {'x': 52.505, 'y': -1.964, 'CRS': 'THW'},
-    {'x': 53.02917, 'y': -0.96194, 'CRS': 'THU'},
-    {'x': 55.7683, 'y': -4.2506, 'CRS': 'THT'},
-    {'x': 58.5900, 'y': -3.5278, 'CRS': 'THS'},
-    {'x': 50.9107, 'y': -2.5792, 'CRS': 'THO'},
-    {'x': 52.3951, 'y': -1.5970, 'CRS': 'THL'},
-    {'x': 52.274, 'y': -3.322, 'CRS': 'PNY'},
-    {'x': 54.228240, 'y': -1.372620, 'CRS': 'THI'},
-    {'x': 53.4367, 'y': -2.7594, 'CRS': 'THH'},
-    {'x': 51.433, 'y': -1.075, 'CRS': 'THE'},
-    {'x': 51.3886, 'y': -0.3383, 'CRS': 'THD'},
-    {'x': 53.545470, 'y': -1.308470, 'CRS': 'THC'},
-    {'x': 55.8108, 'y': -4.3114, 'CRS': 'THB'},
-    {'x': 51.5204, 'y': -3.2319, 'CRS': 'COY'},
-    {'x': 53.4864, 'y': -2.9025, 'CRS': 'KIR'},
-    {'x': 53.340460, 'y': -1.265750, 'CRS': 'KIV'},
-    {'x': 51.4027, 'y': -1.4459, 'CRS': 'KIT'},
-    {'x': 57.0776, 'y': -4.0543, 'CRS': 'KIN'},
-    {'x': 58.1708, 'y': -3.8691, 'CRS': 'KIL'},
-    {'x': 51.071, 'y': -0.800, 'CRS': 'LIP'},
-    {'x': 55.8119, 'y': -4.3603, 'CRS': 'NIT'},
-    {'x': 52.384, 'y': -2.239, 'CRS': 'KID'},
-    {'x': 56.7602, 'y': -4.6907, 'CRS': 'CRR'},
-    {'x': 55.6913, 'y': -3.6692, 'CRS': 'CRS'},
-    {'x': 52.4425, 'y': -2.8375, 'CRS': 'CRV'},
-    {'x': 51.112, 'y': -0.187, 'CRS': 'CRW'},
-    {'x': 51.257, 'y': 1.018, 'CRS': 'CRT'},
-    {'x': 51.4483, 'y': 0.1786, 'CRS': 'CRY'},
-    {'x': 54.966, 'y': -2.019, 'CRS': 'CRB'},
-    {'x': 52.470, 'y': -2.090, 'CRS': 'CRA'},
-    {'x': 55.8076, 'y': -3.9556, 'CRS': 'CRF'},
-    {'x': 53.805, 'y': -1.450, 'CRS': 'CRG'},
-    {'x': 52.535, 'y': -1.832, 'CRS': 'CRD'},
-    {'x': 53.089, 'y': -2.433, 'CRS': 'CRE'},
-    {'x': 52.933, 'y': -3.066, 'CRS': 'CRK'},
-    {'x': 51.5713, 'y': -0.1171, 'CRS': 'CRH'},
-    {'x': 51.5586, 'y': -0.2129, 'CRS': 'CRI'},
-    {'x': 51.367, 'y': -0.819, 'CRS': 'CRN'},
-    {'x': 55.9555, 'y': -4.0365, 'CRS': 'CRO'},
-    {'x': 53.653, 'y': -2.627, 'CRS': 'CRL'},
-    {'x': 55.088, 'y': -1.599, 'CRS': 'CRM'},
-    {'x': 51.483, 'y': -0.610, 'CRS': 'WNC'},
-    {'x': 51.285, 'y': -0.907, 'CRS': 'WNF'},
-    {'x': 51.4882, 'y': -3.2296, 'CRS': 'WNG'},
-    {'x': 51.762, 'y': -0.747, 'CRS': 'WND'},
-    {'x': 52.611, 'y': -1.679, 'CRS': 'WNE'},
-    {'x': 51.093, 'y': -0.329, 'CRS': 'WNH'},
-    {'x': 54.124, 'y': -2.587, 'CRS': 'WNN'},
-    {'x': 55.9384, 'y': -4.7466, 'CRS': 'WNL'},
-    {'x': 51.3479, 'y': -2.9433, 'CRS': 'WNM'},
-    {'x': 51.4855583, 'y': -0.6064889, 'CRS': 'WNR'},
-    {'x': 51.430, 'y': -0.877, 'CRS': 'WNS'},
-    {'x': 51.5518, 'y': 0.0264, 'CRS': 'WNP'},
-    {'x': 51.4318, 'y': -0.1035, 'CRS': 'WNW'},
-    {'x': 51.4609, 'y': -0.1879, 'CRS': 'WNT'},
-    {'x': 51.839, 'y': 0.596, 'CRS': 'WNY'},
-    {'x': 53.321, 'y': -3.827, 'CRS': 'LLD'},
-    {'x': 52.448, 'y': -2.134, 'CRS': 'SBJ'},
-    {'x': 53.0832, 'y': -1.5041, 'CRS': 'WTS'},
-    {'x': 51.255, 'y': 0.485, 'CRS': 'EFL'},
-    {'x': 51.291, 'y': -0.420, 'CRS': 'EFF'},
-    {'x': 53.417112, 'y': -2.767604, 'CRS': 'RNH'},
-    {'x': 56.8560, 'y': -5.2903, 'CRS': 'LCS'},
-    {'x': 51.5169, 'y': 0.1905, 'CRS': 'RNM'},
-    {'x': 53.517, 'y': -2.789, 'CRS': 'RNF'},
-    {'x': 51.096, 'y': -0.263, 'CRS': 'FGT'},
-    {'x': 56.8725, 'y': -5.4495, 'CRS': 'GLF'},
-    {'x': 57.6218, 'y': -4.8091, 'CRS': 'LCC'},
-    {'x': 51.133, 'y': -0.646, 'CRS': 'WTY'},
-    {'x': 53.226, 'y': -0.539, 'CRS': 'LCN'},
-    {'x': 52.917917, 'y': 1.299733, 'CRS': 'RNR'},
-    {'x': 56.8814, 'y': -5.6634, 'CRS': 'LCL'},
-    {'x': 53.634790, 'y': -1.800800, 'CRS': 'LCK'},
-    {'x': 53.4620, 'y': -2.9628, 'CRS': 'OPK'},
-    {'x': 52.0035, 'y': -4.9948, 'CRS': 'FGW'},
-    {'x': 53.29980, 'y': -1.89043, 'CRS': 'DVH'},
-    {'x': 51.939, 'y': 1.281, 'CRS': 'DVC'},
-    {'x': 52.564, 'y': -3.924, 'CRS': 'DVY'},
-    {'x': 50.99620, 'y': -3.98306, 'CRS': 'UMB'},
-    {'x': 51.1261556, 'y': 1.3051194, 'CRS': 'DVP'},
-    {'x': 51.52581, 'y': -0.08709, 'CRS': 'OLD'},
-    {'x': 51.3792, 'y': -2.3807, 'CRS': 'OLF'},
-    {'x': 52.48, 'y': -0.9094, 'CRS': 'MHR'},
-    {'x': 52.439, 'y': -1.804, 'CRS': 'OLT'},
-    {'x': 51.152, 'y': -0.336, 'CRS': 'OLY'},
-    {'x': 53.515, 'y': -2.042, 'CRS': 'MSL'},
-    {'x': 52.392, 'y': -1.852, 'CRS': 'WTE'},
-    {'x': 56.4121, 'y': -5.4749, 'CRS': 'OBN'},
-    {'x': 51.5332, 'y': -0.7287, 'CRS': 'FZP'},
-    {'x': 53.6326, 'y': -1.3745, 'CRS': 'FZW'},
-    {'x': 53.820000, 'y': -1.768600, 'CRS': 'FZH'},
-    {'x': 55.8376, 'y': -4.2761, 'CRS': 'PLW'},
-    {'x': 51.4897, 'y': 0.0844, 'CRS': 'PLU'},
-    {'x': 51.7466, 'y': -3.2794, 'CRS': 'PLT'},
-    {'x': 53.731, 'y': -2.544, 'CRS': 'PLS'},
-    {'x': 51.4671, 'y': -3.1665, 'CRS': 'CDB'},
-    {'x': 51.5432, 'y': -0.1145, 'CRS': 'CIR'},
-    {'x': 51.3219, 'y': -0.134, 'CRS': 'CDN'},
-    {'x': 55.8526, 'y': -4.3395, 'CRS': 'CDO'},
-    {'x': 50.78318, 'y': -3.64707, 'CRS': 'CDI'},
-    {'x': 50.37780, 'y': -4.14301, 'CRS': 'PLY'},
-    {'x': 51.806, 'y': 0.6391, 'CRS': 'WTM'},
-    {'x': 50.82111, 'y': 0.24611, 'CRS': 'PLG'},
-    {'x': 51.718, 'y': -2.359, 'CRS': 'CDU'},
-    {'x': 55.8407, 'y': -4.2690, 'CRS': 'PLE'},
-    {'x': 50.83556, 'y': -0.20556, 'CRS': 'PLD'},
-    {'x': 51.156, 'y': 0.747, 'CRS': 'PLC'},
-    {'x': 51.4819, 'y': -3.1703, 'CRS': 'CDQ'},
-    {'x': 55.9601, 'y': -4.6526, 'CRS': 'CDR'},
-    {'x': 53.42358, 'y': -2.79892, 'CRS': 'PSC'},
-    {'x': 57.0614, 'y': -2.1280, 'CRS': 'PLN'},
-    {'x': 53.275, 'y': -2.420, 'CRS': 'PLM'},
-    {'x': 57.3336, 'y': -5.6659, 'CRS': 'PLK'},
-    {'x': 55.9422, 'y': -4.7324, 'CRS': 'CDY'},
-    {'x': 51.4403, 'y': 0.1479, 'CRS': 'BXY'},
-    {'x': 51.4057, 'y': 0.0573, 'CRS': 'CIT'},
-    {'x': 51.254, 'y': -0.329, 'CRS': 'BXW'},
-    {'x': 51.4635, 'y': 0.1338, 'CRS': 'BXH'},
-    {'x': 53.12303, 'y': 0.19937, 'CRS': 'TPC'},
-    {'x': 51.560, 'y': 0.506, 'CRS': 'PSE'},
-    {'x': 50.990, 'y': 0.131, 'CRS': 'BXD'},
-    {'x': 50.9503, 'y': -1.3634, 'CRS': 'SOA'},
-    {'x': 51.53722, 'y': 0.71167, 'CRS': 'SOC'},
-    {'x': 50.848, 'y': -0.908, 'CRS': 'SOB'},
-    {'x': 51.5389, 'y': 0.7317, 'CRS': 'SOE'},
-    {'x': 53.3577, 'y': -2.8897, 'CRS': 'LPY'},
-    {'x': 51.020, 'y': 0.364, 'CRS': 'SOG'},
-    {'x': 51.5994, 'y': -3.3419, 'CRS': 'PPD'},
-    {'x': 55.8901, 'y': -4.2578, 'CRS': 'PPK'},
-    {'x': 51.5408, 'y': -0.1802, 'CRS': 'SOH'},
-    {'x': 51.5708, 'y': -0.3087, 'CRS': 'SOK'},
-    {'x': 53.782420, 'y': -1.251140, 'CRS': 'SOM'},
-    {'x': 52.41472, 'y': -1.78889, 'CRS': 'SOL'},
-    {'x': 51.3968, 'y': 0.5005, 'CRS': 'SOO'},
-    {'x': 53.899980, 'y': -1.944380, 'CRS': 'SON'},
-    {'x': 53.647, 'y': -3.002, 'CRS': 'SOP'},
-    {'x': 51.3831917, 'y': 0.3781472, 'CRS': 'SOR'},
-    {'x': 50.9075, 'y': -1.4141, 'CRS': 'SOU'},
-    {'x': 53.0081, 'y': -2.181, 'CRS': 'SOT'},
-    {'x': 53.708, 'y': -1.907, 'CRS': 'SOW'},
-    {'x': 51.54167, 'y': 0.71111, 'CRS': 'SOV'},
-    {'x': 51.919, 'y': -1.299, 'CRS': 'HYD'},
-    {'x': 54.579100, 'y': -1.234720, 'CRS': 'MBR'},
-    {'x': 56.7129, 'y': -2.4722, 'CRS': 'MTS'},
-    {'x': 51.4684, 'y': -2.5887, 'CRS': 'MTP'},
-    {'x': 55.8405, 'y': -4.1326, 'CRS': 'MTV'},
-    {'x': 54.017, 'y': -2.256, 'CRS': 'LPR'},
-    {'x': 55.791570, 'y': -3.994208, 'CRS': 'MTH'},
-    {'x': 50.701, 'y': -2.313, 'CRS': 'MTN'},
-    {'x': 54.5443, 'y': -1.1985, 'CRS': 'MTO'},
-    {'x': 51.4682, 'y': -0.2672, 'CRS': 'MTL'},
-    {'x': 51.171, 'y': 1.348, 'CRS': 'MTM'},
-    {'x': 53.122, 'y': -1.558, 'CRS': 'MTB'},
-    {'x': 51.4077, 'y': -0.1547, 'CRS': 'MTC'},
-    {'x': 51.6817, 'y': -3.3765, 'CRS': 'MTA'},
-    {'x': 54.5518, 'y': -1.2083, 'CRS': 'JCH'},
-    {'x': 51.4401, 'y': 0.0504, 'CRS': 'MTG'},
-    {'x': 53.884000, 'y': -0.425000, 'CRS': 'ARR'},
-    {'x': 56.2033, 'y': -4.7232, 'CRS': 'ART'},
-    {'x': 50.848, 'y': -0.546, 'CRS': 'ARU'},
-    {'x': 56.5594, 'y': -2.5892, 'CRS': 'ARB'},
-    {'x': 57.8816, 'y': -4.3622, 'CRS': 'ARD'},
-    {'x': 56.9130, 'y': -5.8395, 'CRS': 'ARG'},
-    {'x': 52.026, 'y': -0.266, 'CRS': 'ARL'},
-    {'x': 55.885, 'y': -3.698, 'CRS': 'ARM'},
-    {'x': 54.202, 'y': -2.828, 'CRS': 'ARN'},
-    {'x': 53.5594, 'y': -2.6937, 'CRS': 'GST'},
-    {'x': 53.4881, 'y': -2.672, 'CRS': 'GSW'},
-    {'x': 53.876, 'y': -1.715, 'CRS': 'GSY'},
-    {'x': 52.530, 'y': -2.066, 'CRS': 'TIP'},
-    {'x': 55.7732, 'y': -4.0388, 'CRS': 'HNC'},
-    {'x': 51.7209, 'y': -3.2459, 'CRS': 'TIR'},
-    {'x': 51.061, 'y': -2.079, 'CRS': 'TIS'},
-    {'x': 51.462, 'y': 0.354, 'CRS': 'TIL'},
-    {'x': 55.8973, 'y': -4.2825, 'CRS': 'GSC'},
-    {'x': 54.321, 'y': -2.326, 'CRS': 'GSD'},
-    {'x': 50.51600, 'y': -4.21929, 'CRS': 'GSL'},
-    {'x': 51.687, 'y': -0.382, 'CRS': 'GSN'},
-    {'x': 51.6471, 'y': -3.2254, 'CRS': 'HNG'},
-    {'x': 53.081, 'y': -0.799, 'CRS': 'NNG'},
-    {'x': 52.710, 'y': -2.002, 'CRS': 'HNF'},
-    {'x': 51.543417, 'y': -0.024389, 'CRS': 'HKW'},
-    {'x': 55.8421, 'y': -4.3995, 'CRS': 'HKH'},
-    {'x': 53.03806, 'y': -1.19556, 'CRS': 'HKN'},
-    {'x': 51.453, 'y': -0.102, 'CRS': 'HNH'},
-    {'x': 51.547, 'y': -0.0559, 'CRS': 'HKC'},
-    {'x': 54.527895, 'y': -1.169580, 'CRS': 'NNT'},
-    {'x': 52.5350, 'y': -1.3719, 'CRS': 'HNK'},
-    {'x': 51.47639, 'y': -3.20111, 'CRS': 'NNP'},
-    {'x': 51.5213, 'y': -3.2027, 'CRS': 'BCG'},
-    {'x': 51.4755, 'y': -0.0402, 'CRS': 'NXG'},
-    {'x': 52.4586, 'y': 1.5697, 'CRS': 'BCC'},
-    {'x': 55.8934, 'y': -4.3105, 'CRS': 'KVD'},
-    {'x': 53.7773, 'y': -3.0503, 'CRS': 'SQU'},
-    {'x': 55.3710, 'y': -3.9248, 'CRS': 'SQH'},
-    {'x': 53.3368, 'y': -1.2394, 'CRS': 'KVP'},
-    {'x': 51.4927, 'y': 0.1524, 'CRS': 'BVD'},
-    {'x': 56.4021, 'y': -5.0412, 'CRS': 'LHA'},
-    {'x': 51.49358, 'y': -0.04717, 'CRS': 'SQE'},
-    {'x': 57.4445, 'y': -2.7758, 'CRS': 'HNT'},
-    {'x': 55.9239, 'y': -4.4525, 'CRS': 'KPT'},
-    {'x': 50.8164, 'y': -1.5739, 'CRS': 'BCU'},
-    {'x': 56.3903, 'y': -4.6185, 'CRS': 'CNR'},
-    {'x': 51.6335, 'y': -3.4533, 'CRS': 'LLY'},
-    {'x': 53.06528, 'y': -0.89972, 'CRS': 'ROL'},
-    {'x': 50.9927, 'y': -1.4933, 'CRS': 'ROM'},
-    {'x': 54.115, 'y': -3.195, 'CRS': 'ROO'},
-    {'x': 51.5328, 'y': -3.1818, 'CRS': 'LLS'},
-    {'x': 51.538, 'y': -3.441, 'CRS': 'LLR'},
-    {'x': 53.410, 'y': -2.856, 'CRS': 'ROB'},
-    {'x': 50.4186, 'y': -4.83039, 'CRS': 'ROC'},
-    {'x': 52.667, 'y': -4.088, 'CRS': 'LLW'},
-    {'x': 51.5008, 'y': -0.0522, 'CRS': 'ROE'},
-    {'x': 57.9886, 'y': -4.1584, 'CRS': 'ROG'},
-    {'x': 53.284, 'y': -3.809, 'CRS': 'LLJ'},
-    {'x': 51.821, 'y': -4.004, 'CRS': 'LLI'},
-    {'x': 51.691, 'y': -4.079, 'CRS': 'LLH'},
-    {'x': 52.242, 'y': -3.379, 'CRS': 'LLO'},
-    {'x': 51.5085, 'y': -3.2292, 'CRS': 'LLN'},
-    {'x': 52.114, 'y': -3.555, 'CRS': 'LLM'},
-    {'x': 51.885, 'y': -3.987, 'CRS': 'LLL'},
-    {'x': 52.921, 'y': -4.056496, 'CRS': 'LLC'},
-    {'x': 51.596, 'y': -3.067, 'CRS': 'ROR'},
-    {'x': 56.0455, 'y': -3.4269, 'CRS': 'ROS'},
-    {'x': 51.940, 'y': -3.893, 'CRS': 'LLG'},
-    {'x': 53.257, 'y': -3.983, 'CRS': 'LLF'},
-    {'x': 51.674, 'y': -4.161, 'CRS': 'LLE'},
-    {'x': 52.477, 'y': -2.031, 'CRS': 'ROW'},
-    {'x': 55.8484, 'y': -4.2250, 'CRS': 'BDG'},
-    {'x': 52.61944, 'y': 1.43944, 'CRS': 'BDA'},
-    {'x': 53.4408, 'y': -2.0165, 'CRS': 'BDB'},
-    {'x': 52.1364, 'y': -0.4794, 'CRS': 'BDM'},
-    {'x': 53.6340, 'y': -3.0145, 'CRS': 'BDL'},
-    {'x': 50.678, 'y': -1.139, 'CRS': 'BDN'},
-    {'x': 53.791, 'y': -1.750, 'CRS': 'BDI'},
-    {'x': 50.85361, 'y': -0.99694, 'CRS': 'BDH'},
-    {'x': 51.3451, 'y': -0.2419, 'CRS': 'EWE'},
-    {'x': 52.3667, 'y': -1.8614, 'CRS': 'EWD'},
-    {'x': 54.0840, 'y': -0.1985, 'CRS': 'BDT'},
-    {'x': 51.380, 'y': -1.599, 'CRS': 'BDW'},
-    {'x': 53.7970, 'y': -1.7530, 'CRS': 'BDQ'},
-    {'x': 50.82167, 'y': -0.35500, 'CRS': 'EWR'},
-    {'x': 53.4230, 'y': -2.1105, 'CRS': 'BDY'},
-    {'x': 50.83667, 'y': -0.13639, 'CRS': 'LRB'},
-    {'x': 51.240764, 'y': -0.565277, 'CRS': 'LRD'},
-    {'x': 58.0019, 'y': -4.3998, 'CRS': 'LRG'},
-    {'x': 55.7390, 'y': -3.9753, 'CRS': 'LRH'},
-    {'x': 53.052, 'y': -3.885, 'CRS': 'DWD'},
-    {'x': 51.5845, 'y': -2.7598, 'CRS': 'CDT'},
-    {'x': 51.519, 'y': -0.061, 'CRS': 'ZWL'},
-    {'x': 55.9846, 'y': -3.7149, 'CRS': 'PMT'},
-    {'x': 53.270, 'y': -3.924, 'CRS': 'PMW'},
-    {'x': 50.929, 'y': -0.060, 'CRS': 'PMP'},
-    {'x': 51.46989, 'y': -0.06886, 'CRS': 'PMR'},
-    {'x': 50.798448, 'y': -1.090393, 'CRS': 'PMS'},
-    {'x': 55.9949, 'y': -4.7120, 'CRS': 'CGD'},
-    {'x': 51.694, 'y': -4.938, 'CRS': 'PMD'},
-    {'x': 51.5483, 'y': -0.0601, 'CRS': 'HAC'},
-    {'x': 50.95697, 'y': -3.95086, 'CRS': 'PMA'},
-    {'x': 51.673, 'y': -4.906, 'CRS': 'PMB'},
-    {'x': 50.79714, 'y': -1.107044, 'CRS': 'PMH'},
-    {'x': 53.10778, 'y': -3.03306, 'CRS': 'CGW'},
-    {'x': 51.841, 'y': -4.732, 'CRS': 'CUW'},
-    {'x': 56.3174, 'y': -3.0087, 'CRS': 'CUP'},
-    {'x': 52.000, 'y': -0.718, 'CRS': 'FEN'},
-    {'x': 51.4481, 'y': -0.4088, 'CRS': 'FEL'},
-    {'x': 51.374, 'y': 0.462, 'CRS': 'CUX'},
-    {'x': 51.709, 'y': -0.110, 'CRS': 'CUF'},
-    {'x': 53.240, 'y': -2.599, 'CRS': 'CUD'},
-    {'x': 51.6866, 'y': -3.3959, 'CRS': 'FER'},
-    {'x': 55.9418, 'y': -3.9807, 'CRS': 'CUB'},
-    {'x': 57.9196, 'y': -4.4045, 'CRS': 'CUA'},
-    {'x': 51.654, 'y': -1.237, 'CRS': 'CUM'},
-    {'x': 55.9006, 'y': -3.3185, 'CRS': 'CUH'},
-    {'x': 53.37867, 'y': -2.73374, 'CRS': 'WID'},
-    {'x': 51.615, 'y': 0.519, 'CRS': 'WIC'},
-    {'x': 51.067, 'y': -1.320, 'CRS': 'WIN'},
-    {'x': 51.4232, 'y': -0.2043, 'CRS': 'WIM'},
-    {'x': 52.854, 'y': -1.563, 'CRS': 'WIL'},
-    {'x': 51.53266, 'y': -0.24547, 'CRS': 'WIJ'},
-    {'x': 51.6341, 'y': -0.1013, 'CRS': 'WIH'},
-    {'x': 51.857, 'y': 0.956, 'CRS': 'WIV'},
-    {'x': 51.502973, 'y': -0.114809, 'CRS': 'WIT'},
-    {'x': 53.16306, 'y': -1.20139, 'CRS': 'MSW'},
-    {'x': 51.6096, 'y': -3.6547, 'CRS': 'MST'},
-    {'x': 53.5563, 'y': -2.4017, 'CRS': 'MSS'},
-    {'x': 51.329, 'y': 1.317, 'CRS': 'MSR'},
-    {'x': 52.151, 'y': -3.457, 'CRS': 'CIM'},
-    {'x': 51.245, 'y': 0.976, 'CRS': 'CIL'},
-    {'x': 53.52333, 'y': -2.17111, 'CRS': 'MSO'},
-    {'x': 53.603230, 'y': -1.930700, 'CRS': 'MSN'},
-    {'x': 53.9583, 'y': -1.0930, 'CRS': 'YRK'},
-    {'x': 54.587425, 'y': -1.019000, 'CRS': 'MSK'},
-    {'x': 53.379, 'y': -2.915, 'CRS': 'MSH'},
-    {'x': 53.5163, 'y': -2.3526, 'CRS': 'MSD'},
-    {'x': 51.4191, 'y': -0.0537, 'CRS': 'PNE'},
-    {'x': 54.493860, 'y': -1.351600, 'CRS': 'YRM'},
-    {'x': 56.0423, 'y': -3.3672, 'CRS': 'DAG'},
-    {'x': 56.4010, 'y': -4.9829, 'CRS': 'DAL'},
-    {'x': 55.9862, 'y': -3.3815, 'CRS': 'DAM'},
-    {'x': 53.384500, 'y': -1.412300, 'CRS': 'DAN'},
-    {'x': 55.8424, 'y': -4.2176, 'CRS': 'DAK'},
-    {'x': 51.4831194, 'y': -0.5797500, 'CRS': 'DAT'},
-    {'x': 53.692, 'y': -1.303, 'CRS': 'PFR'},
-    {'x': 51.91631, 'y': -0.67700, 'CRS': 'LBZ'},
-    {'x': 54.5209, 'y': -1.5464, 'CRS': 'DAR'},
-    {'x': 50.59886, 'y': -3.44354, 'CRS': 'DWW'},
-    {'x': 50.723, 'y': -1.949, 'CRS': 'PKS'},
-    {'x': 52.422, 'y': -1.854, 'CRS': 'YRD'},
-    {'x': 54.192, 'y': -3.098, 'CRS': 'ULV'},
-    {'x': 53.853560, 'y': -1.214060, 'CRS': 'ULL'},
-    {'x': 53.61930, 'y': -0.30079, 'CRS': 'ULC'},
-    {'x': 53.698, 'y': -2.465, 'CRS': 'DWN'},
-    {'x': 50.58055, 'y': -3.46453, 'CRS': 'DWL'},
-    {'x': 51.3157, 'y': -0.138, 'CRS': 'CDS'},
-    {'x': 51.7249, 'y': -0.3402, 'CRS': 'PKT'}
-];
\ No newline at end of file
@@ -0,0 +1,167 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+#include "stats.h"
+
+#define STATS_VERSION           1
+#define LATENCY_SAMPLES         16
+#define RESULT_BUCKETS          16      // one per AppMessageResult bit
+
+// counters, persisted and sent to the phone as-is; the fields are ordered by size so that there is no padding, and all
+// values are little-endian and saturate rather than wrap
+//   the latencies of the most recent requests are kept in a ring buffer, the oldest being overwritten
+//   AppMessageResult values are single bits, so bucket i counts results of (1 << i); bucket 0 also counts APP_MSG_OK
+typedef struct {
+    uint32_t version;
+    uint32_t latency_total_ms;
+    uint32_t ticks;
+    uint32_t tick_total_ms;
+    uint32_t redraws[STATS_LAYER_COUNT];
+    uint16_t requests;
+    uint16_t responses;
+    uint16_t latency_count;                     // responses with a measured latency
+    uint16_t latency_max_ms;
+    uint16_t latency_head;                      // slot for the next sample
+    uint16_t messages_sent;
+    uint16_t tick_max_ms;
+    uint16_t reserved;
+    uint16_t latency_ms[LATENCY_SAMPLES];       // 0 if unused
+    uint16_t messages_failed[RESULT_BUCKETS];
+    uint16_t messages_dropped[RESULT_BUCKETS];
+} Stats;
+
+static Stats s_stats;
+static uint32_t s_persist_key = 0;
+static bool s_dirty = false;
+static uint32_t s_request_start_ms = 0;
+static bool s_request_outstanding = false;
+
+
+static void increment16(uint16_t *counter) {
+    if (*counter < UINT16_MAX) {
+        (*counter)++;
+    }
+    s_dirty = true;
+}
+
+static void increment32(uint32_t *counter, uint32_t amount) {
+    *counter = *counter <= UINT32_MAX - amount ? *counter + amount : UINT32_MAX;
+    s_dirty = true;
+}
+
+static int result_bucket(AppMessageResult reason) {
+    for (int i = 0; i < RESULT_BUCKETS; i++) {
+        if ((uint32_t) reason == (1u << i)) {
+            return i;
+        }
+    }
+    
+    return 0;
+}
+
+void stats_init(uint32_t persist_key) {
+    s_persist_key = persist_key;
+    
+    if (persist_exists(persist_key) &&
+            persist_read_data(persist_key, &s_stats, sizeof(s_stats)) == sizeof(s_stats) &&
+            s_stats.version == STATS_VERSION) {
+        return;
+    }
+    
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.version = STATS_VERSION;
+}
+
+void stats_deinit(void) {
+    stats_save();
+}
+
+uint32_t stats_time_ms(void) {
+    // wraps after about 49 days, which is harmless for intervals calculated with unsigned arithmetic
+    time_t seconds;
+    uint16_t ms;
+    time_ms(&seconds, &ms);
+    return (uint32_t) seconds * 1000 + ms;
+}
+
+void stats_request_sent(void) {
+    increment16(&s_stats.requests);
+    s_request_start_ms = stats_time_ms();
+    s_request_outstanding = true;
+}
+
+void stats_response_received(void) {
+    increment16(&s_stats.responses);
+    
+    // responses that were not requested by this launch, e.g. after a configuration change, have no latency
+    if (!s_request_outstanding) {
+        return;
+    }
+    s_request_outstanding = false;
+    
+    uint32_t latency = stats_time_ms() - s_request_start_ms;
+    uint16_t sample = latency < UINT16_MAX ? latency : UINT16_MAX;
+    
+    increment16(&s_stats.latency_count);
+    increment32(&s_stats.latency_total_ms, latency);
+    if (sample > s_stats.latency_max_ms) {
+        s_stats.latency_max_ms = sample;
+    }
+    s_stats.latency_ms[s_stats.latency_head] = sample;
+    s_stats.latency_head = (s_stats.latency_head + 1) % LATENCY_SAMPLES;
+}
+
+void stats_message_sent(void) {
+    increment16(&s_stats.messages_sent);
+}
+
+void stats_message_failed(AppMessageResult reason) {
+    increment16(&s_stats.messages_failed[result_bucket(reason)]);
+}
+
+void stats_message_dropped(AppMessageResult reason) {
+    increment16(&s_stats.messages_dropped[result_bucket(reason)]);
+}
+
+void stats_tick_handled(uint32_t start_ms) {
+    uint32_t duration = stats_time_ms() - start_ms;
+    
+    increment32(&s_stats.ticks, 1);
+    increment32(&s_stats.tick_total_ms, duration);
+    if (duration > s_stats.tick_max_ms) {
+        s_stats.tick_max_ms = duration < UINT16_MAX ? duration : UINT16_MAX;
+    }
+}
+
+void stats_layer_redrawn(StatsLayer layer) {
+    // not marked dirty: redraws alone are not worth a persist write
+    if (s_stats.redraws[layer] < UINT32_MAX) {
+        s_stats.redraws[layer]++;
+    }
+}
+
+size_t stats_get(const uint8_t **data) {
+    *data = (const uint8_t *) &s_stats;
+    return sizeof(s_stats);
+}
+
+void stats_save(void) {
+    if (s_dirty) {
+        persist_write_data(s_persist_key, &s_stats, sizeof(s_stats));
+        s_dirty = false;
+    }
+}
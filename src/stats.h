@@ -0,0 +1,57 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+#pragma once
+
+#include <pebble.h>
+
+// Lightweight instrumentation: request latency, AppMessage failures, tick handler cost and redraw counts. The counters
+// accumulate across launches in persistent storage, and can be pulled by the phone (KEY_STATS) for logging.
+
+typedef enum {
+    STATS_LAYER_TIME,
+    STATS_LAYER_DATE,
+    STATS_LAYER_TRAINS,
+    STATS_LAYER_INFO,
+    STATS_LAYER_COUNT
+} StatsLayer;
+
+void stats_init(uint32_t persist_key);
+void stats_deinit(void);
+
+// milliseconds from an arbitrary epoch, for measuring intervals
+uint32_t stats_time_ms(void);
+
+// a train update request was sent, and its response was received
+void stats_request_sent(void);
+void stats_response_received(void);
+
+// AppMessage outcomes
+void stats_message_sent(void);
+void stats_message_failed(AppMessageResult reason);
+void stats_message_dropped(AppMessageResult reason);
+
+// a tick handler that started at start_ms, from stats_time_ms(), has finished
+void stats_tick_handled(uint32_t start_ms);
+
+void stats_layer_redrawn(StatsLayer layer);
+
+// the counters, in the layout documented in stats.c; returns the number of bytes
+size_t stats_get(const uint8_t **data);
+
+// writes the counters to persistent storage if they have changed; called periodically, as well as on exit
+void stats_save(void);
@@ -0,0 +1,268 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+
+#include "usage.h"
+
+#define USAGE_VERSION               2
+#define SLOTS_PER_DAY               48          // half hours
+#define SLOT_SECONDS                (30 * 60)
+#define MAX_COUNT                   15          // counts are 4 bits, two slots to a byte
+#define SECONDS_PER_DAY             (24 * 60 * 60)
+#define ADHOC_GRANULARITY_SECONDS   (5 * 60)    // the ad-hoc window ends on a multiple of this
+#define SEARCH_DAYS                 8           // usage_next_change() looks this far ahead, to cover a whole week
+
+const int LEARNED_MIN_COUNT = 2;                // glances on separate days before a slot is in a learned window
+const int LEARNED_MIN_HISTORY = 10;             // total glances before learned windows are used at all
+const time_t PREFETCH_LEAD_SECONDS = 5 * 60;    // learned windows start this long before their first slot
+const time_t ADHOC_WINDOW_SECONDS = 20 * 60;    // a glance outside a learned window opens one for this long
+const int AGING_PERIOD_DAYS = 28;               // all counts are halved this often, so that old habits fade
+
+// the histogram, persisted as-is
+//   counts[day][slot / 2] holds the even slot in the low nibble and the odd slot in the high nibble; day 0 is Sunday
+//   the slots already counted today are persisted too, as the watchface is relaunched whenever the user returns to it
+typedef struct {
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t aged_day;                          // days since the epoch when the counts were last halved
+    uint8_t counts[7][SLOTS_PER_DAY / 2];
+    uint16_t counted_day;                       // local day of counted, as tm_year * 366 + tm_yday
+    uint8_t counted[SLOTS_PER_DAY / 8];         // bit per slot: a glance has been counted on counted_day
+} UsageHistory;
+
+// version 1 had no record of the slots counted today
+#define USAGE_V1_SIZE               offsetof(UsageHistory, counted_day)
+
+static UsageHistory s_history;
+static uint32_t s_persist_key = 0;
+static int s_total = 0;                         // sum of all counts
+static time_t s_adhoc_start = 0;
+static time_t s_adhoc_end = 0;
+
+
+static int get_count(int wday, int slot) {
+    uint8_t pair = s_history.counts[wday][slot / 2];
+    return slot % 2 == 0 ? pair & 0x0F : pair >> 4;
+}
+
+static void set_count(int wday, int slot, int count) {
+    uint8_t *pair = &s_history.counts[wday][slot / 2];
+    if (slot % 2 == 0) {
+        *pair = (*pair & 0xF0) | count;
+    }
+    else {
+        *pair = (*pair & 0x0F) | (count << 4);
+    }
+}
+
+static void calculate_total() {
+    s_total = 0;
+    for (int wday = 0; wday < 7; wday++) {
+        for (int slot = 0; slot < SLOTS_PER_DAY; slot++) {
+            s_total += get_count(wday, slot);
+        }
+    }
+}
+
+static void halve_counts() {
+    for (int wday = 0; wday < 7; wday++) {
+        for (int i = 0; i < SLOTS_PER_DAY / 2; i++) {
+            // halves both nibbles at once
+            s_history.counts[wday][i] = (s_history.counts[wday][i] >> 1) & 0x77;
+        }
+    }
+}
+
+// returns true if the counts have changed
+static bool age_history(time_t now) {
+    int today = now / SECONDS_PER_DAY;
+    if (s_history.aged_day == 0 || today < s_history.aged_day) {
+        s_history.aged_day = today;
+        return false;
+    }
+    
+    bool changed = false;
+    for (int i = 0; i < 4 && today - s_history.aged_day >= AGING_PERIOD_DAYS; i++) {
+        halve_counts();
+        s_history.aged_day += AGING_PERIOD_DAYS;
+        changed = true;
+    }
+    if (today - s_history.aged_day >= AGING_PERIOD_DAYS) {
+        s_history.aged_day = today;
+    }
+    
+    if (changed) {
+        calculate_total();
+    }
+    return changed;
+}
+
+static void save() {
+    persist_write_data(s_persist_key, &s_history, sizeof(s_history));
+}
+
+// seconds east of UTC at t
+static int utc_offset(time_t t) {
+    struct tm *local = localtime(&t);
+    int offset = local->tm_hour * 3600 + local->tm_min * 60 + local->tm_sec - (int) (t % SECONDS_PER_DAY);
+    
+    // the local day may be either side of the UTC day
+    if (offset > SECONDS_PER_DAY / 2) {
+        offset -= SECONDS_PER_DAY;
+    }
+    else if (offset < -SECONDS_PER_DAY / 2) {
+        offset += SECONDS_PER_DAY;
+    }
+    return offset;
+}
+
+// local_t is seconds since the epoch in local time; the epoch was a Thursday
+static bool is_local_slot_active(time_t local_t) {
+    int wday = (local_t / SECONDS_PER_DAY + 4) % 7;
+    int slot = local_t % SECONDS_PER_DAY / SLOT_SECONDS;
+    return get_count(wday, slot) >= LEARNED_MIN_COUNT;
+}
+
+static bool is_slot_active(time_t t) {
+    return is_local_slot_active(t + utc_offset(t));
+}
+
+void usage_init(uint32_t persist_key) {
+    s_persist_key = persist_key;
+    
+    memset(&s_history, 0, sizeof(s_history));
+    int length = persist_exists(persist_key) ? persist_read_data(persist_key, &s_history, sizeof(s_history)) : 0;
+    if (length == (int) USAGE_V1_SIZE && s_history.version == 1) {
+        // keep the counts; nothing is known about today's glances
+        s_history.version = USAGE_VERSION;
+    }
+    else if (length != sizeof(s_history) || s_history.version != USAGE_VERSION) {
+        memset(&s_history, 0, sizeof(s_history));
+        s_history.version = USAGE_VERSION;
+    }
+    
+    calculate_total();
+    if (age_history(time(NULL))) {
+        save();
+    }
+}
+
+void usage_record_glance(time_t now) {
+    // outside the learned windows, the user may be making an irregular trip, so updates are made for a while
+    if (!usage_is_active_at(now)) {
+        s_adhoc_start = now;
+        s_adhoc_end = now + ADHOC_WINDOW_SECONDS;
+        s_adhoc_end += ADHOC_GRANULARITY_SECONDS - s_adhoc_end % ADHOC_GRANULARITY_SECONDS;
+    }
+    
+    // each half hour is counted once a day, however often the watchface is relaunched, so that the counts are of days
+    struct tm *local = localtime(&now);
+    int day = local->tm_year * 366 + local->tm_yday;
+    int slot = (local->tm_hour * 60 + local->tm_min) / 30;
+    if (day != s_history.counted_day) {
+        s_history.counted_day = day;
+        memset(s_history.counted, 0, sizeof(s_history.counted));
+    }
+    if (s_history.counted[slot / 8] & (1 << (slot % 8))) {
+        return;
+    }
+    s_history.counted[slot / 8] |= 1 << (slot % 8);
+    
+    age_history(now);
+    
+    // saturate by halving the weekday, which keeps the shape of its histogram
+    int wday = local->tm_wday;
+    if (get_count(wday, slot) == MAX_COUNT) {
+        for (int i = 0; i < SLOTS_PER_DAY; i++) {
+            set_count(wday, i, get_count(wday, i) / 2);
+        }
+    }
+    set_count(wday, slot, get_count(wday, slot) + 1);
+    
+    calculate_total();
+    save();
+}
+
+bool usage_has_history(void) {
+    return s_total >= LEARNED_MIN_HISTORY;
+}
+
+bool usage_is_active_at(time_t t) {
+    if (t >= s_adhoc_start && t < s_adhoc_end) {
+        return true;
+    }
+    
+    return is_slot_active(t) || is_slot_active(t + PREFETCH_LEAD_SECONDS);
+}
+
+// the UTC offset over a search, which changes at most once in SEARCH_DAYS
+typedef struct {
+    time_t change;
+    int before;
+    int after;
+} SearchOffset;
+
+static bool is_active_during_search(time_t t, const SearchOffset *offset) {
+    if (t >= s_adhoc_start && t < s_adhoc_end) {
+        return true;
+    }
+    
+    time_t lead_t = t + PREFETCH_LEAD_SECONDS;
+    return is_local_slot_active(t + (t < offset->change ? offset->before : offset->after)) ||
+        is_local_slot_active(lead_t + (lead_t < offset->change ? offset->before : offset->after));
+}
+
+time_t usage_next_change(time_t from) {
+    time_t end = from + SEARCH_DAYS * SECONDS_PER_DAY;
+    
+    // find a clock change by bisection, so that the search itself needs no calls to localtime()
+    SearchOffset offset = {end + PREFETCH_LEAD_SECONDS, utc_offset(from), utc_offset(end + PREFETCH_LEAD_SECONDS)};
+    if (offset.after != offset.before) {
+        time_t low = from;
+        while (offset.change - low > 1) {
+            time_t middle = low + (offset.change - low) / 2;
+            if (utc_offset(middle) == offset.before) {
+                low = middle;
+            }
+            else {
+                offset.change = middle;
+            }
+        }
+    }
+    
+    // the windows can only change at a slot boundary, the lead before one, an edge of the ad-hoc window, or a
+    // clock change
+    bool active = is_active_during_search(from, &offset);
+    time_t t = from;
+    while (t < end) {
+        time_t boundary = t - (t + (t < offset.change ? offset.before : offset.after)) % SLOT_SECONDS + SLOT_SECONDS;
+        time_t candidates[] = {boundary - PREFETCH_LEAD_SECONDS, s_adhoc_start, s_adhoc_end, offset.change};
+        time_t next = boundary;
+        for (unsigned int i = 0; i < ARRAY_LENGTH(candidates); i++) {
+            if (candidates[i] > t && candidates[i] < next) {
+                next = candidates[i];
+            }
+        }
+        
+        if (next < end && is_active_during_search(next, &offset) != active) {
+            return next;
+        }
+        t = next;
+    }
+    
+    return 0;
+}
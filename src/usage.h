@@ -0,0 +1,39 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+
+#pragma once
+
+#include <pebble.h>
+
+// Learns when the user looks at train times, from a histogram of glances (taps) by weekday and half hour, kept in
+// persistent storage. Learned update windows cover the half hours with repeated glances, starting a few minutes early
+// so that train times are already fresh when the user looks; a glance outside them opens a short ad-hoc window.
+
+void usage_init(uint32_t persist_key);
+
+// the user has looked at the watch, e.g. tapped it
+void usage_record_glance(time_t now);
+
+// true once there are enough glances for the learned windows to be used
+bool usage_has_history(void);
+
+// true if t is in a learned window, or in the ad-hoc window after a recent glance
+bool usage_is_active_at(time_t t);
+
+// the first time after from at which usage_is_active_at() changes, or 0 if there is none in the next week
+time_t usage_next_change(time_t from);
@@ -0,0 +1,79 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+
+// the harness side of the stub SDK: a virtual clock, an event queue for timers, minute ticks and AppMessage
+// deliveries, a simulated Bluetooth link to a phone, and counters for everything the app does
+
+#pragma once
+
+#include <pebble.h>
+
+#define HOST_MAX_LAYERS             16
+#define HOST_LINK_LATENCY_MS        100     // one-way delivery time of an AppMessage over the simulated link
+
+// counters of the app's activity; CPU times are measured on the host, so only their relative values are meaningful
+typedef struct {
+    uint32_t ticks;
+    uint64_t tick_cpu_ns;
+    uint64_t tick_cpu_max_ns;
+    uint32_t frames;
+    uint64_t frame_cpu_ns;
+    uint32_t text_draws;
+    uint32_t layer_invalidations[HOST_MAX_LAYERS];
+    uint32_t timers_fired;
+    uint32_t outbox_sent;
+    uint32_t outbox_sent_bytes;
+    uint32_t outbox_failed;
+    uint32_t outbox_busy;
+    uint32_t inbox_received;
+    uint32_t inbox_received_bytes;
+    uint32_t inbox_dropped;
+    uint32_t inbox_lost;                    // sent by the phone while disconnected
+    uint32_t persist_writes;
+    uint32_t persist_write_bytes;
+    uint32_t vibes;
+    uint64_t tap_service_ms;                // time subscribed to the tap service
+    uint64_t app_message_ms;                // time for which the AppMessage buffers have been held
+    uint32_t app_message_bytes;             // size of the AppMessage buffers
+} HostCounters;
+
+// called by the phone model with each message the watch sends
+typedef void (*HostPhoneHandler)(const DictionaryIterator *iter);
+
+// provided by the harness: replays its events, called from app_event_loop()
+void host_run(void);
+
+// virtual clock, in milliseconds since the epoch
+void host_clock_set(int64_t ms);
+int64_t host_clock_ms(void);
+
+// runs the app until the given time, dispatching timers, minute ticks and message deliveries in order
+void host_advance_to(int64_t ms);
+
+// inputs
+void host_tap(void);
+void host_set_connected(bool connected);
+void host_set_battery(uint8_t charge_percent);
+void host_set_phone_handler(HostPhoneHandler handler);
+void host_phone_send(const uint8_t *buffer, uint16_t size, uint32_t delay_ms);
+
+// inspection
+const HostCounters *host_counters(void);
+int host_layer_count(void);
+const char *host_layer_description(int index);
+void host_set_verbose(bool verbose);
@@ -0,0 +1,862 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+
+#include <stdarg.h>
+#include "host.h"
+
+#define MAX_PERSIST_KEYS    32
+
+struct Layer {
+    int index;
+    GRect frame;
+    bool hidden;
+    bool dirty;
+    LayerUpdateProc update_proc;
+    TextLayer *text_layer;              // NULL for plain layers
+};
+
+struct TextLayer {
+    Layer *layer;
+    const char *text;
+};
+
+struct Window {
+    WindowHandlers handlers;
+    Layer *root;
+    GColor background_color;
+};
+
+// a pending event; app timers, and internal events such as message deliveries
+struct AppTimer {
+    int64_t fire_ms;
+    uint32_t sequence;                  // keeps events at the same time in order of registration
+    AppTimerCallback callback;
+    void *data;
+    bool internal;
+    AppTimer *next;
+};
+
+typedef struct {
+    const char *kind;
+    GRect frame;
+} LayerInfo;
+
+typedef struct {
+    uint16_t size;
+    uint8_t buffer[];
+} Delivery;
+
+typedef struct {
+    bool exists;
+    size_t size;
+    uint8_t data[PERSIST_DATA_MAX_LENGTH];
+} PersistEntry;
+
+static int64_t s_now_ms = 0;
+static int64_t s_next_tick_ms = 0;
+static bool s_verbose = false;
+static HostCounters s_counters;
+
+static Layer *s_layers[HOST_MAX_LAYERS];
+static LayerInfo s_layer_info[HOST_MAX_LAYERS];     // kept after the layer is destroyed, for the report
+static int s_layer_count = 0;
+static Window *s_window = NULL;
+static bool s_window_dirty = false;
+static GContext *const s_context = (GContext *) &s_context;
+
+static AppTimer *s_events = NULL;
+static uint32_t s_event_sequence = 0;
+
+static TickHandler s_tick_handler = NULL;
+static TimeUnits s_tick_units = 0;
+static AccelTapHandler s_tap_handler = NULL;
+static int64_t s_tap_since_ms = -1;              // -1 while not subscribed
+static BluetoothConnectionHandler s_bluetooth_handler = NULL;
+static bool s_connected = true;
+static uint8_t s_charge_percent = 80;
+
+static AppMessageInboxReceived s_inbox_received = NULL;
+static AppMessageInboxDropped s_inbox_dropped = NULL;
+static AppMessageOutboxSent s_outbox_sent = NULL;
+static AppMessageOutboxFailed s_outbox_failed = NULL;
+static uint8_t *s_inbox = NULL;
+static int64_t s_app_message_since_ms = -1;       // -1 until opened
+static uint32_t s_inbox_size = 0;
+static uint8_t *s_outbox = NULL;
+static uint32_t s_outbox_size = 0;
+static DictionaryIterator s_outbox_iter;
+static bool s_outbox_pending = false;
+static HostPhoneHandler s_phone_handler = NULL;
+
+static PersistEntry s_persist[MAX_PERSIST_KEYS];
+
+
+static uint64_t cpu_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t) ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+// clock
+
+time_t host_time(time_t *tloc) {
+    time_t now = (time_t) (s_now_ms / 1000);
+    if (tloc != NULL) {
+        *tloc = now;
+    }
+    return now;
+}
+
+uint16_t time_ms(time_t *tloc, uint16_t *out_ms) {
+    uint16_t ms = (uint16_t) (s_now_ms % 1000);
+    host_time(tloc);
+    if (out_ms != NULL) {
+        *out_ms = ms;
+    }
+    return ms;
+}
+
+void host_clock_set(int64_t ms) {
+    s_now_ms = ms;
+    s_next_tick_ms = (ms / 60000 + 1) * 60000;
+}
+
+int64_t host_clock_ms(void) {
+    return s_now_ms;
+}
+
+bool clock_is_24h_style(void) {
+    return true;
+}
+
+void clock_copy_time_string(char *buffer, uint8_t size) {
+    time_t now = host_time(NULL);
+    strftime(buffer, size, "%H:%M", localtime(&now));
+}
+
+void host_log(uint8_t level, const char *file, int line, const char *fmt, ...) {
+    if (!s_verbose) {
+        return;
+    }
+    
+    time_t now = host_time(NULL);
+    char stamp[16];
+    strftime(stamp, sizeof(stamp), "%H:%M:%S", localtime(&now));
+    fprintf(stderr, "%s.%03d %s:%d ", stamp, (int) (s_now_ms % 1000), file, line);
+    
+    va_list args;
+    va_start(args, fmt);
+    vfprintf(stderr, fmt, args);
+    va_end(args);
+    fputc('\n', stderr);
+}
+
+void host_set_verbose(bool verbose) {
+    s_verbose = verbose;
+}
+
+// drawing; only counted
+
+GFont fonts_get_system_font(const char *font_key) {
+    return font_key;
+}
+
+void graphics_context_set_fill_color(GContext *ctx, GColor color) {}
+void graphics_context_set_stroke_color(GContext *ctx, GColor color) {}
+void graphics_context_set_text_color(GContext *ctx, GColor color) {}
+void graphics_fill_rect(GContext *ctx, GRect rect, uint16_t corner_radius, GCornerMask corner_mask) {}
+void graphics_draw_rect(GContext *ctx, GRect rect) {}
+void graphics_draw_round_rect(GContext *ctx, GRect rect, uint16_t radius) {}
+void graphics_fill_circle(GContext *ctx, GPoint p, uint16_t radius) {}
+void graphics_draw_circle(GContext *ctx, GPoint p, uint16_t radius) {}
+
+void graphics_draw_text(GContext *ctx, const char *text, GFont font, GRect box, GTextOverflowMode overflow_mode,
+                        GTextAlignment alignment, GTextAttributes *text_attributes) {
+    s_counters.text_draws++;
+}
+
+// layers
+
+Layer *layer_create(GRect frame) {
+    if (s_layer_count >= HOST_MAX_LAYERS) {
+        fprintf(stderr, "host: too many layers\n");
+        exit(EXIT_FAILURE);
+    }
+    
+    Layer *layer = calloc(1, sizeof(Layer));
+    layer->index = s_layer_count;
+    layer->frame = frame;
+    s_layer_info[s_layer_count] = (LayerInfo) {"layer", frame};
+    s_layers[s_layer_count++] = layer;
+    return layer;
+}
+
+void layer_destroy(Layer *layer) {
+    if (layer != NULL) {
+        s_layers[layer->index] = NULL;
+        free(layer);
+    }
+}
+
+void layer_mark_dirty(Layer *layer) {
+    layer->dirty = true;
+    s_counters.layer_invalidations[layer->index]++;
+}
+
+void layer_set_update_proc(Layer *layer, LayerUpdateProc update_proc) {
+    layer->update_proc = update_proc;
+}
+
+void layer_add_child(Layer *parent, Layer *child) {}
+
+GRect layer_get_bounds(const Layer *layer) {
+    return GRect(0, 0, layer->frame.size.w, layer->frame.size.h);
+}
+
+void layer_set_hidden(Layer *layer, bool hidden) {
+    if (layer->hidden != hidden) {
+        layer->hidden = hidden;
+        layer_mark_dirty(layer);
+    }
+}
+
+TextLayer *text_layer_create(GRect frame) {
+    TextLayer *text_layer = calloc(1, sizeof(TextLayer));
+    text_layer->layer = layer_create(frame);
+    text_layer->layer->text_layer = text_layer;
+    s_layer_info[text_layer->layer->index].kind = "text layer";
+    text_layer->text = "";
+    return text_layer;
+}
+
+void text_layer_destroy(TextLayer *text_layer) {
+    if (text_layer != NULL) {
+        layer_destroy(text_layer->layer);
+        free(text_layer);
+    }
+}
+
+Layer *text_layer_get_layer(TextLayer *text_layer) {
+    return text_layer->layer;
+}
+
+void text_layer_set_text(TextLayer *text_layer, const char *text) {
+    // as on the watch, the text is not copied, and setting it always invalidates the layer
+    text_layer->text = text;
+    layer_mark_dirty(text_layer->layer);
+}
+
+void text_layer_set_font(TextLayer *text_layer, GFont font) {}
+void text_layer_set_text_color(TextLayer *text_layer, GColor color) {}
+void text_layer_set_background_color(TextLayer *text_layer, GColor color) {}
+void text_layer_set_text_alignment(TextLayer *text_layer, GTextAlignment text_alignment) {}
+void text_layer_set_overflow_mode(TextLayer *text_layer, GTextOverflowMode line_mode) {}
+
+int host_layer_count(void) {
+    return s_layer_count;
+}
+
+const char *host_layer_description(int index) {
+    static char description[64];
+    GRect f = s_layer_info[index].frame;
+    snprintf(description, sizeof(description), "%s at (%d, %d) %dx%d", s_layer_info[index].kind,
+             f.origin.x, f.origin.y, f.size.w, f.size.h);
+    return description;
+}
+
+// windows
+
+Window *window_create(void) {
+    Window *window = calloc(1, sizeof(Window));
+    window->root = layer_create(GRect(0, 0, 144, 168));
+    s_layer_info[window->root->index].kind = "window";
+    window->background_color = GColorWhite;
+    return window;
+}
+
+void window_destroy(Window *window) {
+    if (window == NULL) {
+        return;
+    }
+    if (window == s_window) {
+        if (window->handlers.unload != NULL) {
+            window->handlers.unload(window);
+        }
+        s_window = NULL;
+    }
+    layer_destroy(window->root);
+    free(window);
+}
+
+void window_set_window_handlers(Window *window, WindowHandlers handlers) {
+    window->handlers = handlers;
+}
+
+void window_set_background_color(Window *window, GColor background_color) {
+    if (window->background_color.argb != background_color.argb) {
+        window->background_color = background_color;
+        layer_mark_dirty(window->root);
+    }
+}
+
+Layer *window_get_root_layer(const Window *window) {
+    return window->root;
+}
+
+void window_stack_push(Window *window, bool animated) {
+    s_window = window;
+    if (window->handlers.load != NULL) {
+        window->handlers.load(window);
+    }
+    s_window_dirty = true;
+}
+
+// the watch redraws the whole window when any layer is dirty
+static void render(void) {
+    bool dirty = s_window_dirty;
+    for (int i = 0; i < s_layer_count; i++) {
+        if (s_layers[i] != NULL && s_layers[i]->dirty) {
+            dirty = true;
+        }
+    }
+    if (!dirty || s_window == NULL) {
+        return;
+    }
+    
+    uint64_t start_ns = cpu_ns();
+    for (int i = 0; i < s_layer_count; i++) {
+        Layer *layer = s_layers[i];
+        if (layer == NULL) {
+            continue;
+        }
+        layer->dirty = false;
+        if (layer->hidden) {
+            continue;
+        }
+        if (layer->update_proc != NULL) {
+            layer->update_proc(layer, s_context);
+        }
+        else if (layer->text_layer != NULL && layer->text_layer->text[0] != '\0') {
+            s_counters.text_draws++;
+        }
+    }
+    s_window_dirty = false;
+    
+    s_counters.frames++;
+    s_counters.frame_cpu_ns += cpu_ns() - start_ns;
+}
+
+// event queue
+
+static AppTimer *schedule_event(uint32_t timeout_ms, AppTimerCallback callback, void *data, bool internal) {
+    AppTimer *event = calloc(1, sizeof(AppTimer));
+    event->fire_ms = s_now_ms + timeout_ms;
+    event->sequence = s_event_sequence++;
+    event->callback = callback;
+    event->data = data;
+    event->internal = internal;
+    event->next = s_events;
+    s_events = event;
+    return event;
+}
+
+static bool unlink_event(AppTimer *event) {
+    for (AppTimer **p = &s_events; *p != NULL; p = &(*p)->next) {
+        if (*p == event) {
+            *p = event->next;
+            return true;
+        }
+    }
+    return false;
+}
+
+static AppTimer *next_event(void) {
+    AppTimer *next = NULL;
+    for (AppTimer *event = s_events; event != NULL; event = event->next) {
+        if (next == NULL || event->fire_ms < next->fire_ms ||
+                (event->fire_ms == next->fire_ms && event->sequence < next->sequence)) {
+            next = event;
+        }
+    }
+    return next;
+}
+
+AppTimer *app_timer_register(uint32_t timeout_ms, AppTimerCallback callback, void *callback_data) {
+    return schedule_event(timeout_ms, callback, callback_data, false);
+}
+
+bool app_timer_reschedule(AppTimer *timer_handle, uint32_t new_timeout_ms) {
+    // as on the watch, a timer that has already fired cannot be rescheduled
+    for (AppTimer *event = s_events; event != NULL; event = event->next) {
+        if (event == timer_handle) {
+            event->fire_ms = s_now_ms + new_timeout_ms;
+            event->sequence = s_event_sequence++;
+            return true;
+        }
+    }
+    return false;
+}
+
+void app_timer_cancel(AppTimer *timer_handle) {
+    if (timer_handle != NULL && unlink_event(timer_handle)) {
+        free(timer_handle);
+    }
+}
+
+static void fire_tick(void) {
+    time_t now = host_time(NULL);
+    struct tm tick_time = *localtime(&now);
+    
+    TimeUnits units_changed = SECOND_UNIT | MINUTE_UNIT;
+    if (tick_time.tm_min == 0) {
+        units_changed |= HOUR_UNIT;
+        if (tick_time.tm_hour == 0) {
+            units_changed |= DAY_UNIT;
+        }
+    }
+    
+    uint64_t start_ns = cpu_ns();
+    s_tick_handler(&tick_time, units_changed);
+    uint64_t duration_ns = cpu_ns() - start_ns;
+    
+    s_counters.ticks++;
+    s_counters.tick_cpu_ns += duration_ns;
+    if (duration_ns > s_counters.tick_cpu_max_ns) {
+        s_counters.tick_cpu_max_ns = duration_ns;
+    }
+}
+
+void host_advance_to(int64_t ms) {
+    for (;;) {
+        AppTimer *event = next_event();
+        bool tick_due = s_tick_handler != NULL && (s_tick_units & (SECOND_UNIT | MINUTE_UNIT)) && s_next_tick_ms <= ms;
+        bool event_due = event != NULL && event->fire_ms <= ms;
+        
+        if (tick_due && (!event_due || s_next_tick_ms <= event->fire_ms)) {
+            s_now_ms = s_next_tick_ms;
+            s_next_tick_ms += 60000;
+            fire_tick();
+        }
+        else if (event_due) {
+            if (event->fire_ms > s_now_ms) {
+                s_now_ms = event->fire_ms;
+            }
+            unlink_event(event);
+            if (!event->internal) {
+                s_counters.timers_fired++;
+            }
+            AppTimerCallback callback = event->callback;
+            void *data = event->data;
+            free(event);
+            callback(data);
+        }
+        else {
+            break;
+        }
+        
+        render();
+    }
+    
+    if (ms > s_now_ms) {
+        s_now_ms = ms;
+    }
+}
+
+// services
+
+void tick_timer_service_subscribe(TimeUnits tick_units, TickHandler handler) {
+    s_tick_units = tick_units;
+    s_tick_handler = handler;
+    s_next_tick_ms = (s_now_ms / 60000 + 1) * 60000;
+}
+
+void tick_timer_service_unsubscribe(void) {
+    s_tick_handler = NULL;
+}
+
+void accel_tap_service_subscribe(AccelTapHandler handler) {
+    s_tap_handler = handler;
+    if (s_tap_since_ms < 0) {
+        s_tap_since_ms = s_now_ms;
+    }
+}
+
+void accel_tap_service_unsubscribe(void) {
+    s_tap_handler = NULL;
+    if (s_tap_since_ms >= 0) {
+        s_counters.tap_service_ms += s_now_ms - s_tap_since_ms;
+        s_tap_since_ms = -1;
+    }
+}
+
+void bluetooth_connection_service_subscribe(BluetoothConnectionHandler handler) {
+    s_bluetooth_handler = handler;
+}
+
+void bluetooth_connection_service_unsubscribe(void) {
+    s_bluetooth_handler = NULL;
+}
+
+bool bluetooth_connection_service_peek(void) {
+    return s_connected;
+}
+
+BatteryChargeState battery_state_service_peek(void) {
+    return (BatteryChargeState) {
+        .charge_percent = s_charge_percent,
+        .is_charging = false,
+        .is_plugged = false
+    };
+}
+
+void vibes_short_pulse(void) {
+    s_counters.vibes++;
+}
+
+void vibes_long_pulse(void) {
+    s_counters.vibes++;
+}
+
+void host_tap(void) {
+    if (s_tap_handler != NULL) {
+        s_tap_handler(ACCEL_AXIS_Z, 1);
+        render();
+    }
+}
+
+void host_set_connected(bool connected) {
+    if (s_connected == connected) {
+        return;
+    }
+    
+    s_connected = connected;
+    if (s_bluetooth_handler != NULL) {
+        s_bluetooth_handler(connected);
+        render();
+    }
+}
+
+void host_set_battery(uint8_t charge_percent) {
+    s_charge_percent = charge_percent;
+}
+
+// persistent storage
+
+static PersistEntry *persist_entry(uint32_t key) {
+    return key < MAX_PERSIST_KEYS ? &s_persist[key] : NULL;
+}
+
+bool persist_exists(uint32_t key) {
+    PersistEntry *entry = persist_entry(key);
+    return entry != NULL && entry->exists;
+}
+
+int persist_read_data(uint32_t key, void *buffer, size_t buffer_size) {
+    PersistEntry *entry = persist_entry(key);
+    if (entry == NULL || !entry->exists) {
+        return -1;
+    }
+    
+    size_t size = entry->size < buffer_size ? entry->size : buffer_size;
+    memcpy(buffer, entry->data, size);
+    return (int) size;
+}
+
+int persist_write_data(uint32_t key, const void *data, size_t size) {
+    PersistEntry *entry = persist_entry(key);
+    if (entry == NULL) {
+        return -1;
+    }
+    
+    if (size > PERSIST_DATA_MAX_LENGTH) {
+        size = PERSIST_DATA_MAX_LENGTH;
+    }
+    entry->exists = true;
+    entry->size = size;
+    memcpy(entry->data, data, size);
+    
+    s_counters.persist_writes++;
+    s_counters.persist_write_bytes += size;
+    return (int) size;
+}
+
+int persist_delete(uint32_t key) {
+    PersistEntry *entry = persist_entry(key);
+    if (entry == NULL || !entry->exists) {
+        return -1;
+    }
+    entry->exists = false;
+    return 0;
+}
+
+// dictionaries
+
+uint32_t dict_calc_buffer_size(const uint8_t tuple_count, ...) {
+    uint32_t size = 1 + tuple_count * sizeof(Tuple);
+    
+    va_list args;
+    va_start(args, tuple_count);
+    for (int i = 0; i < tuple_count; i++) {
+        size += va_arg(args, uint32_t);
+    }
+    va_end(args);
+    
+    return size;
+}
+
+DictionaryResult dict_write_begin(DictionaryIterator *iter, uint8_t *buffer, const uint16_t size) {
+    if (iter == NULL || buffer == NULL || size < 1) {
+        return DICT_INVALID_ARGS;
+    }
+    
+    iter->buffer = buffer;
+    iter->end = buffer + size;
+    iter->cursor = buffer + 1;
+    buffer[0] = 0;
+    return DICT_OK;
+}
+
+static DictionaryResult dict_write(DictionaryIterator *iter, uint32_t key, TupleType type, const void *data,
+                                   uint16_t size) {
+    if (iter->cursor + sizeof(Tuple) + size > iter->end) {
+        return DICT_NOT_ENOUGH_STORAGE;
+    }
+    
+    Tuple *t = (Tuple *) iter->cursor;
+    t->key = key;
+    t->type = type;
+    t->length = size;
+    memcpy(t->value->data, data, size);
+    
+    iter->cursor += sizeof(Tuple) + size;
+    iter->buffer[0]++;
+    return DICT_OK;
+}
+
+DictionaryResult dict_write_data(DictionaryIterator *iter, const uint32_t key, const uint8_t *data, const uint16_t size) {
+    return dict_write(iter, key, TUPLE_BYTE_ARRAY, data, size);
+}
+
+DictionaryResult dict_write_uint8(DictionaryIterator *iter, const uint32_t key, const uint8_t value) {
+    return dict_write(iter, key, TUPLE_UINT, &value, sizeof(value));
+}
+
+DictionaryResult dict_write_uint16(DictionaryIterator *iter, const uint32_t key, const uint16_t value) {
+    return dict_write(iter, key, TUPLE_UINT, &value, sizeof(value));
+}
+
+DictionaryResult dict_write_int32(DictionaryIterator *iter, const uint32_t key, const int32_t value) {
+    return dict_write(iter, key, TUPLE_INT, &value, sizeof(value));
+}
+
+uint32_t dict_write_end(DictionaryIterator *iter) {
+    iter->end = iter->cursor;
+    return (uint32_t) (iter->cursor - iter->buffer);
+}
+
+Tuple *dict_read_begin_from_buffer(DictionaryIterator *iter, const uint8_t *buffer, const uint16_t size) {
+    iter->buffer = (uint8_t *) buffer;
+    iter->end = (uint8_t *) buffer + size;
+    iter->cursor = (uint8_t *) buffer + 1;
+    return dict_read_first(iter);
+}
+
+Tuple *dict_read_first(DictionaryIterator *iter) {
+    iter->cursor = iter->buffer + 1;
+    return dict_read_next(iter);
+}
+
+Tuple *dict_read_next(DictionaryIterator *iter) {
+    if (iter->cursor + sizeof(Tuple) > iter->end) {
+        return NULL;
+    }
+    
+    Tuple *t = (Tuple *) iter->cursor;
+    if (iter->cursor + sizeof(Tuple) + t->length > iter->end) {
+        return NULL;
+    }
+    iter->cursor += sizeof(Tuple) + t->length;
+    return t;
+}
+
+Tuple *dict_find(const DictionaryIterator *iter, const uint32_t key) {
+    DictionaryIterator copy = *iter;
+    for (Tuple *t = dict_read_first(&copy); t != NULL; t = dict_read_next(&copy)) {
+        if (t->key == key) {
+            return t;
+        }
+    }
+    return NULL;
+}
+
+// AppMessage, over a simulated link to the phone model
+
+AppMessageResult app_message_open(const uint32_t size_inbound, const uint32_t size_outbound) {
+    free(s_inbox);
+    free(s_outbox);
+    s_inbox_size = size_inbound;
+    s_outbox_size = size_outbound;
+    s_inbox = malloc(size_inbound);
+    s_outbox = malloc(size_outbound);
+    s_counters.app_message_bytes = size_inbound + size_outbound;
+    if (s_app_message_since_ms < 0) {
+        s_app_message_since_ms = s_now_ms;
+    }
+    return APP_MSG_OK;
+}
+
+AppMessageInboxReceived app_message_register_inbox_received(AppMessageInboxReceived received_callback) {
+    AppMessageInboxReceived previous = s_inbox_received;
+    s_inbox_received = received_callback;
+    return previous;
+}
+
+AppMessageInboxDropped app_message_register_inbox_dropped(AppMessageInboxDropped dropped_callback) {
+    AppMessageInboxDropped previous = s_inbox_dropped;
+    s_inbox_dropped = dropped_callback;
+    return previous;
+}
+
+AppMessageOutboxSent app_message_register_outbox_sent(AppMessageOutboxSent sent_callback) {
+    AppMessageOutboxSent previous = s_outbox_sent;
+    s_outbox_sent = sent_callback;
+    return previous;
+}
+
+AppMessageOutboxFailed app_message_register_outbox_failed(AppMessageOutboxFailed failed_callback) {
+    AppMessageOutboxFailed previous = s_outbox_failed;
+    s_outbox_failed = failed_callback;
+    return previous;
+}
+
+void app_message_deregister_callbacks(void) {
+    s_inbox_received = NULL;
+    s_inbox_dropped = NULL;
+    s_outbox_sent = NULL;
+    s_outbox_failed = NULL;
+}
+
+AppMessageResult app_message_outbox_begin(DictionaryIterator **iterator) {
+    if (s_outbox == NULL) {
+        return APP_MSG_INVALID_ARGS;
+    }
+    if (s_outbox_pending) {
+        s_counters.outbox_busy++;
+        return APP_MSG_BUSY;
+    }
+    
+    dict_write_begin(&s_outbox_iter, s_outbox, s_outbox_size);
+    *iterator = &s_outbox_iter;
+    return APP_MSG_OK;
+}
+
+static void outbox_delivered(void *data) {
+    // the app may begin its next message from the callbacks, so the delivered message is read from a copy
+    uint16_t size = (uint16_t) (s_outbox_iter.cursor - s_outbox);
+    uint8_t *buffer = malloc(size);
+    memcpy(buffer, s_outbox, size);
+    s_outbox_pending = false;
+    
+    DictionaryIterator iter;
+    dict_read_begin_from_buffer(&iter, buffer, size);
+    
+    if (!s_connected) {
+        s_counters.outbox_failed++;
+        if (s_outbox_failed != NULL) {
+            s_outbox_failed(&iter, APP_MSG_NOT_CONNECTED, NULL);
+        }
+    }
+    else {
+        s_counters.outbox_sent++;
+        s_counters.outbox_sent_bytes += size;
+        if (s_outbox_sent != NULL) {
+            s_outbox_sent(&iter, NULL);
+        }
+        if (s_phone_handler != NULL) {
+            s_phone_handler(&iter);
+        }
+    }
+    
+    free(buffer);
+}
+
+AppMessageResult app_message_outbox_send(void) {
+    if (s_outbox_pending) {
+        return APP_MSG_BUSY;
+    }
+    
+    s_outbox_pending = true;
+    schedule_event(HOST_LINK_LATENCY_MS, outbox_delivered, NULL, true);
+    return APP_MSG_OK;
+}
+
+static void inbox_delivered(void *data) {
+    Delivery *delivery = data;
+    
+    if (!s_connected) {
+        s_counters.inbox_lost++;
+    }
+    else if (delivery->size > s_inbox_size) {
+        s_counters.inbox_dropped++;
+        if (s_inbox_dropped != NULL) {
+            s_inbox_dropped(APP_MSG_BUFFER_OVERFLOW, NULL);
+        }
+    }
+    else {
+        s_counters.inbox_received++;
+        s_counters.inbox_received_bytes += delivery->size;
+        memcpy(s_inbox, delivery->buffer, delivery->size);
+        
+        DictionaryIterator iter;
+        dict_read_begin_from_buffer(&iter, s_inbox, delivery->size);
+        if (s_inbox_received != NULL) {
+            s_inbox_received(&iter, NULL);
+        }
+    }
+    
+    free(delivery);
+}
+
+void host_set_phone_handler(HostPhoneHandler handler) {
+    s_phone_handler = handler;
+}
+
+void host_phone_send(const uint8_t *buffer, uint16_t size, uint32_t delay_ms) {
+    Delivery *delivery = malloc(sizeof(Delivery) + size);
+    delivery->size = size;
+    memcpy(delivery->buffer, buffer, size);
+    schedule_event(delay_ms + HOST_LINK_LATENCY_MS, inbox_delivered, delivery, true);
+}
+
+const HostCounters *host_counters(void) {
+    // bring the times held up to date
+    if (s_tap_since_ms >= 0) {
+        s_counters.tap_service_ms += s_now_ms - s_tap_since_ms;
+        s_tap_since_ms = s_now_ms;
+    }
+    if (s_app_message_since_ms >= 0) {
+        s_counters.app_message_ms += s_now_ms - s_app_message_since_ms;
+        s_app_message_since_ms = s_now_ms;
+    }
+    return &s_counters;
+}
+
+void app_event_loop(void) {
+    render();
+    host_run();
+}
@@ -0,0 +1,798 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+
+// replays a recorded day against the watchface, compiled natively with the stub SDK, and reports what the app did
+//
+// Usage: replay [-v] [script]
+//   -v        log the app's APP_LOG output and each replayed event to stderr
+//   script    the day to replay; see commute_day.txt for the format
+//
+// The phone is modelled here: it answers update requests with departures from a regular timetable, after a fixed
+// latency, sending a complete departure table once and then only the trains that have changed, as data.js does. Any
+// boards are sent with the first answer, and then every 15 minutes. With a journey time set, it answers with the next
+// journeys instead, as data.js does when an interchange is configured. With service details set, each answer carries the
+// details of the next train.
+
+#include <ctype.h>
+#include "host.h"
+
+// must match the AppMessage keys and layouts in main.c and codec.js
+#define KEY_UPDATE                      0
+#define KEY_LAST_REQUEST_FAILED         27
+#define KEY_DEPARTURES                  29
+#define KEY_CONFIG                      30
+#define KEY_CONFIG_GENERATION           31
+#define KEY_RETRY_AFTER                 32
+#define KEY_DEPARTURE_UPDATES           33
+#define KEY_STATS                       34
+#define KEY_BOARDS                      35
+#define KEY_JOURNEYS                    36
+#define KEY_NEXT_SERVICE_DETAILS        37
+
+#define PROTOCOL_VERSION                3
+#define DEPARTURES_HEADER_SIZE          16
+#define DEPARTURE_RECORD_SIZE           6
+#define DEPARTURE_UPDATES_HEADER_SIZE   6
+#define MAX_DEPARTURE_RECORDS           36
+#define MAX_DEPARTURE_UPDATE_RECORDS    6
+#define BOARDS_HEADER_SIZE              6
+#define BOARD_HEADER_SIZE               7
+#define MAX_BOARDS                      3
+#define MAX_BOARD_RECORDS               4
+#define JOURNEY_RECORD_SIZE             (DEPARTURE_RECORD_SIZE + 2)
+#define MAX_JOURNEY_RECORDS             6
+#define SERVICE_DETAILS_SIZE            10
+#define CONFIG_RECORD_SIZE              9
+#define CONFIG_FLAG_CUSTOMISED_TIMES    0x02
+#define TRAIN_FLAG_CANCELLED            0x01
+#define TRAIN_FLAG_DELAYED              0x02
+#define REQUEST_FAILED_NETWORK          2
+#define STATS_SIZE                      144
+
+#define MAX_EVENTS                      256
+#define MAX_SERVICES                    (24 * 60)
+#define TIMETABLE_HORIZON_SECONDS       (2 * 3600)
+#define RETRY_AFTER_SECONDS             60
+#define BOARDS_REFRESH_SECONDS          (15 * 60)
+
+typedef enum {
+    EVENT_START,
+    EVENT_TAP,
+    EVENT_BLUETOOTH,
+    EVENT_PHONE,
+    EVENT_DELAY,
+    EVENT_DELAYED,
+    EVENT_CANCEL,
+    EVENT_BATTERY,
+    EVENT_STATS,
+    EVENT_CONFIG,
+    EVENT_END
+} EventType;
+
+typedef struct {
+    int64_t time_ms;
+    EventType type;
+    int value;
+    int hours[4];                           // config: morning and afternoon update periods
+    int line;
+} Event;
+
+typedef struct {
+    time_t scheduled;
+    int delay_minutes;
+    int unknown_delay_minutes;              // reported as 'Delayed', without an estimate, until it leaves this late
+    bool cancelled;
+} Service;
+
+// the phone's copy of the watch's departure table
+typedef struct {
+    bool valid;
+    char origin[4];
+    char destination[4];
+    time_t base;
+    int count;
+    int service[MAX_DEPARTURE_RECORDS];
+    time_t time[MAX_DEPARTURE_RECORDS];
+    bool cancelled[MAX_DEPARTURE_RECORDS];
+    bool delayed[MAX_DEPARTURE_RECORDS];
+} PhoneTable;
+
+typedef struct {
+    uint32_t requests;
+    uint32_t failures;
+    uint32_t tables;
+    uint32_t updates;
+    uint32_t unchanged;
+    uint32_t boards;
+    uint32_t journeys;
+} PhoneCounters;
+
+int pebble_main(void);
+
+static Event s_events[MAX_EVENTS];
+static int s_event_count = 0;
+static char s_home[4] = "SUR";
+static char s_work[4] = "WAT";
+static int s_interval_minutes = 15;
+static int s_offset_minutes = 4;
+static int s_platform = 2;
+static char s_boards[MAX_BOARDS][2][4];     // origin and destination of each saved route
+static int s_board_count = 0;
+static time_t s_boards_sent = 0;
+static uint32_t s_latency_ms = 1500;
+static int s_journey_minutes = 0;           // journey time, including the change, or 0 for direct trains
+static int s_details_minutes = 0;           // journey time in the next train's service details, or 0 for none
+static int s_details_stops = 0;
+static bool s_phone_online = true;
+static bool s_verbose = false;
+
+static Service s_services[MAX_SERVICES];
+static int s_service_count = 0;
+static PhoneTable s_table;
+static PhoneCounters s_phone;
+
+
+static void fail(int line, const char *message) {
+    fprintf(stderr, "replay: line %d: %s\n", line, message);
+    exit(EXIT_FAILURE);
+}
+
+static void format_clock(int64_t ms, char *buffer, size_t size) {
+    time_t t = (time_t) (ms / 1000);
+    strftime(buffer, size, "%H:%M:%S", localtime(&t));
+}
+
+// script
+
+static bool parse_crs(const char *src, char *dst) {
+    if (strlen(src) != 3 || !isupper((unsigned char) src[0]) || !isupper((unsigned char) src[1]) ||
+            !isupper((unsigned char) src[2])) {
+        return false;
+    }
+    memcpy(dst, src, 4);
+    return true;
+}
+
+static void load_script(const char *path) {
+    FILE *file = fopen(path, "r");
+    if (file == NULL) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    
+    struct tm day = {0};
+    bool have_day = false;
+    char line[256];
+    int line_number = 0;
+    
+    while (fgets(line, sizeof(line), file) != NULL) {
+        line_number++;
+        char *comment = strchr(line, '#');
+        if (comment != NULL) {
+            *comment = '\0';
+        }
+        
+        char word[4][32];
+        int words = sscanf(line, "%31s %31s %31s %31s", word[0], word[1], word[2], word[3]);
+        if (words <= 0) {
+            continue;
+        }
+        
+        // settings have no time
+        int year, month, mday;
+        if (strcmp(word[0], "date") == 0 && words == 2 && sscanf(word[1], "%d-%d-%d", &year, &month, &mday) == 3) {
+            day.tm_year = year - 1900;
+            day.tm_mon = month - 1;
+            day.tm_mday = mday;
+            have_day = true;
+            continue;
+        }
+        if (strcmp(word[0], "route") == 0) {
+            if (words != 3 || !parse_crs(word[1], s_home) || !parse_crs(word[2], s_work)) {
+                fail(line_number, "expected: route <home CRS> <work CRS>");
+            }
+            continue;
+        }
+        if (strcmp(word[0], "service") == 0) {
+            if (words != 4 || sscanf(word[1], "%d", &s_interval_minutes) != 1 ||
+                    sscanf(word[2], "%d", &s_offset_minutes) != 1 || sscanf(word[3], "%d", &s_platform) != 1 ||
+                    s_interval_minutes <= 0) {
+                fail(line_number, "expected: service <interval minutes> <minutes past the hour> <platform>");
+            }
+            continue;
+        }
+        if (strcmp(word[0], "board") == 0) {
+            if (words != 3 || s_board_count == MAX_BOARDS || !parse_crs(word[1], s_boards[s_board_count][0]) ||
+                    !parse_crs(word[2], s_boards[s_board_count][1])) {
+                fail(line_number, "expected: board <origin CRS> <destination CRS>, at most 3 times");
+            }
+            s_board_count++;
+            continue;
+        }
+        if (strcmp(word[0], "journey") == 0) {
+            if (words != 2 || sscanf(word[1], "%d", &s_journey_minutes) != 1 || s_journey_minutes <= 0) {
+                fail(line_number, "expected: journey <minutes>");
+            }
+            continue;
+        }
+        if (strcmp(word[0], "details") == 0) {
+            if (words != 3 || sscanf(word[1], "%d", &s_details_minutes) != 1 || s_details_minutes <= 0 ||
+                    sscanf(word[2], "%d", &s_details_stops) != 1 || s_details_stops < 0) {
+                fail(line_number, "expected: details <minutes> <stops>");
+            }
+            continue;
+        }
+        if (strcmp(word[0], "latency") == 0) {
+            if (words != 2 || sscanf(word[1], "%u", &s_latency_ms) != 1) {
+                fail(line_number, "expected: latency <milliseconds>");
+            }
+            continue;
+        }
+        
+        // events start with the local time on the replayed day; hours past 23 run into the next day
+        int hour, minute, second = 0;
+        if (sscanf(word[0], "%d:%d:%d", &hour, &minute, &second) < 2 || words < 2) {
+            fail(line_number, "expected a setting, or an event: HH:MM[:SS] <event> [argument]");
+        }
+        if (!have_day) {
+            fail(line_number, "the date must be set before the first event");
+        }
+        if (s_event_count >= MAX_EVENTS) {
+            fail(line_number, "too many events");
+        }
+        
+        struct tm when = day;
+        when.tm_hour = hour;
+        when.tm_min = minute;
+        when.tm_sec = second;
+        when.tm_isdst = -1;
+        
+        Event *event = &s_events[s_event_count];
+        event->time_ms = (int64_t) mktime(&when) * 1000;
+        event->line = line_number;
+        event->value = 0;
+        
+        const char *name = word[1];
+        const char *argument = words > 2 ? word[2] : "";
+        if (strcmp(name, "start") == 0) {
+            event->type = EVENT_START;
+        }
+        else if (strcmp(name, "tap") == 0) {
+            event->type = EVENT_TAP;
+        }
+        else if (strcmp(name, "bluetooth") == 0 && (strcmp(argument, "on") == 0 || strcmp(argument, "off") == 0)) {
+            event->type = EVENT_BLUETOOTH;
+            event->value = strcmp(argument, "on") == 0;
+        }
+        else if (strcmp(name, "phone") == 0 && (strcmp(argument, "online") == 0 || strcmp(argument, "offline") == 0)) {
+            event->type = EVENT_PHONE;
+            event->value = strcmp(argument, "online") == 0;
+        }
+        else if (strcmp(name, "delay") == 0 && sscanf(argument, "%d", &event->value) == 1) {
+            event->type = EVENT_DELAY;
+        }
+        else if (strcmp(name, "delayed") == 0 && sscanf(argument, "%d", &event->value) == 1) {
+            event->type = EVENT_DELAYED;
+        }
+        else if (strcmp(name, "cancel") == 0) {
+            event->type = EVENT_CANCEL;
+        }
+        else if (strcmp(name, "battery") == 0 && sscanf(argument, "%d", &event->value) == 1) {
+            event->type = EVENT_BATTERY;
+        }
+        else if (strcmp(name, "stats") == 0) {
+            event->type = EVENT_STATS;
+        }
+        else if (strcmp(name, "config") == 0 &&
+                 sscanf(argument, "%d-%d,%d-%d", &event->hours[0], &event->hours[1], &event->hours[2], &event->hours[3]) == 4) {
+            event->type = EVENT_CONFIG;
+        }
+        else if (strcmp(name, "end") == 0) {
+            event->type = EVENT_END;
+        }
+        else {
+            fail(line_number, "unknown event");
+        }
+        
+        if (s_event_count > 0 && event->time_ms < s_events[s_event_count - 1].time_ms) {
+            fail(line_number, "events must be in time order");
+        }
+        s_event_count++;
+    }
+    
+    fclose(file);
+    
+    if (s_event_count < 2 || s_events[0].type != EVENT_START || s_events[s_event_count - 1].type != EVENT_END) {
+        fail(line_number, "the events must begin with start and finish with end");
+    }
+}
+
+// phone model
+
+static void build_timetable(void) {
+    // a regular service through the day of the first event, in both directions
+    time_t start = (time_t) (s_events[0].time_ms / 1000);
+    struct tm midnight = *localtime(&start);
+    midnight.tm_hour = 0;
+    midnight.tm_min = 0;
+    midnight.tm_sec = 0;
+    midnight.tm_isdst = -1;
+    time_t day = mktime(&midnight);
+    
+    time_t end = (time_t) (s_events[s_event_count - 1].time_ms / 1000) + TIMETABLE_HORIZON_SECONDS;
+    for (time_t t = day + (s_offset_minutes % s_interval_minutes) * 60; t < end && s_service_count < MAX_SERVICES;
+            t += s_interval_minutes * 60) {
+        s_services[s_service_count].scheduled = t;
+        s_services[s_service_count].delay_minutes = 0;
+        s_services[s_service_count].unknown_delay_minutes = 0;
+        s_services[s_service_count].cancelled = false;
+        s_service_count++;
+    }
+}
+
+static time_t service_time(int i) {
+    return s_services[i].scheduled + s_services[i].delay_minutes * 60;
+}
+
+// true while a train is on the board as 'Delayed', after its time, as data.js keeps it
+static bool is_delayed(int i, time_t now) {
+    return s_services[i].unknown_delay_minutes > 0 && now < service_time(i) + s_services[i].unknown_delay_minutes * 60;
+}
+
+static int next_service(time_t now) {
+    for (int i = 0; i < s_service_count; i++) {
+        if (service_time(i) >= now || is_delayed(i, now)) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static void push_uint16(uint8_t **p, uint16_t value) {
+    *(*p)++ = value & 0xFF;
+    *(*p)++ = value >> 8;
+}
+
+static void push_uint32(uint8_t **p, uint32_t value) {
+    push_uint16(p, value & 0xFFFF);
+    push_uint16(p, value >> 16);
+}
+
+static uint16_t crs_code(const char *crs) {
+    return (uint16_t) (((crs[0] - 'A') * 26 + (crs[1] - 'A')) * 26 + (crs[2] - 'A'));
+}
+
+static void push_train(uint8_t **p, int slot) {
+    push_uint16(p, (uint16_t) ((s_table.time[slot] - s_table.base) / 60));
+    push_uint16(p, crs_code(s_table.destination));
+    *(*p)++ = (uint8_t) s_platform;
+    *(*p)++ = (s_table.cancelled[slot] ? TRAIN_FLAG_CANCELLED : 0) | (s_table.delayed[slot] ? TRAIN_FLAG_DELAYED : 0);
+}
+
+static void write_boards(DictionaryIterator *iter, time_t now) {
+    // the saved routes other than the current one, with the next trains of the regular service
+    uint8_t data[BOARDS_HEADER_SIZE + MAX_BOARDS * (BOARD_HEADER_SIZE + MAX_BOARD_RECORDS * DEPARTURE_RECORD_SIZE)];
+    uint8_t *p = data;
+    int first = next_service(now - now % 60);
+    time_t base = first >= 0 && service_time(first) < now ? service_time(first) : now - now % 60;
+    *p++ = PROTOCOL_VERSION;
+    uint8_t *count = p++;
+    *count = 0;
+    push_uint32(&p, (uint32_t) base);
+    
+    for (int b = 0; b < s_board_count; b++) {
+        if (strcmp(s_boards[b][0], s_table.origin) == 0 && strcmp(s_boards[b][1], s_table.destination) == 0) {
+            continue;
+        }
+        
+        memcpy(p, s_boards[b][0], 3);
+        memcpy(p + 3, s_boards[b][1], 3);
+        p += 6;
+        uint8_t *records = p++;
+        *records = 0;
+        for (int i = first; i >= 0 && i < s_service_count && *records < MAX_BOARD_RECORDS; i++) {
+            push_uint16(&p, (uint16_t) ((service_time(i) - base) / 60));
+            push_uint16(&p, crs_code(s_boards[b][1]));
+            *p++ = (uint8_t) s_platform;
+            *p++ = (s_services[i].cancelled ? TRAIN_FLAG_CANCELLED : 0) | (is_delayed(i, now) ? TRAIN_FLAG_DELAYED : 0);
+            (*records)++;
+        }
+        (*count)++;
+    }
+    
+    s_phone.boards++;
+    s_boards_sent = now;
+    dict_write_data(iter, KEY_BOARDS, data, (uint16_t) (p - data));
+}
+
+static void write_service_details(DictionaryIterator *iter, time_t now) {
+    // the next train, unless it is cancelled or has no estimate, arriving after the journey time, as delayed as its
+    // departure
+    int i = next_service(now - now % 60);
+    if (i < 0 || s_services[i].cancelled || s_services[i].unknown_delay_minutes > 0) {
+        return;
+    }
+    
+    uint8_t data[SERVICE_DETAILS_SIZE];
+    uint8_t *p = data;
+    *p++ = PROTOCOL_VERSION;
+    push_uint32(&p, (uint32_t) service_time(i));
+    push_uint16(&p, crs_code(s_table.destination));
+    push_uint16(&p, (uint16_t) s_details_minutes);
+    *p++ = (uint8_t) s_details_stops;
+    dict_write_data(iter, KEY_NEXT_SERVICE_DETAILS, data, sizeof(data));
+}
+
+static void send_to_watch(uint32_t key, const uint8_t *data, uint16_t size) {
+    uint8_t buffer[512];
+    DictionaryIterator iter;
+    dict_write_begin(&iter, buffer, sizeof(buffer));
+    dict_write_data(&iter, key, data, size);
+    dict_write_int32(&iter, KEY_LAST_REQUEST_FAILED, 0);
+    
+    time_t now = host_time(NULL);
+    if (s_details_minutes > 0 && s_table.valid) {
+        write_service_details(&iter, now);
+    }
+    if (s_board_count > 0 && (s_boards_sent == 0 || now - s_boards_sent >= BOARDS_REFRESH_SECONDS)) {
+        write_boards(&iter, now);
+    }
+    host_phone_send(buffer, (uint16_t) dict_write_end(&iter), s_latency_ms);
+}
+
+static void send_failure(void) {
+    uint8_t buffer[64];
+    DictionaryIterator iter;
+    dict_write_begin(&iter, buffer, sizeof(buffer));
+    dict_write_int32(&iter, KEY_LAST_REQUEST_FAILED, REQUEST_FAILED_NETWORK);
+    dict_write_int32(&iter, KEY_RETRY_AFTER, RETRY_AFTER_SECONDS);
+    host_phone_send(buffer, (uint16_t) dict_write_end(&iter), s_latency_ms);
+}
+
+static void send_table(time_t now, const char *origin, const char *destination, int first) {
+    s_table.valid = true;
+    memcpy(s_table.origin, origin, 4);
+    memcpy(s_table.destination, destination, 4);
+    s_table.count = 0;
+    
+    for (int i = first; i >= 0 && i < s_service_count && s_table.count < MAX_DEPARTURE_RECORDS &&
+            s_services[i].scheduled <= now + TIMETABLE_HORIZON_SECONDS; i++) {
+        s_table.service[s_table.count] = i;
+        s_table.time[s_table.count] = service_time(i);
+        s_table.cancelled[s_table.count] = s_services[i].cancelled;
+        s_table.delayed[s_table.count] = is_delayed(i, now);
+        s_table.count++;
+    }
+    s_table.base = s_table.count > 0 ? s_table.time[0] - s_table.time[0] % 60 : now;
+    
+    uint8_t data[DEPARTURES_HEADER_SIZE + MAX_DEPARTURE_RECORDS * DEPARTURE_RECORD_SIZE];
+    uint8_t *p = data;
+    *p++ = PROTOCOL_VERSION;
+    *p++ = (uint8_t) s_table.count;
+    memcpy(p, origin, 3);
+    memcpy(p + 3, destination, 3);
+    p += 6;
+    push_uint32(&p, 0);
+    push_uint32(&p, (uint32_t) s_table.base);
+    for (int slot = 0; slot < s_table.count; slot++) {
+        push_train(&p, slot);
+    }
+    
+    s_phone.tables++;
+    send_to_watch(KEY_DEPARTURES, data, (uint16_t) (p - data));
+}
+
+static void send_journeys(time_t now, const char *origin, const char *destination, int first) {
+    // the next trains that are not cancelled, each arriving after the journey time; the journeys replace the watch's
+    // table, so the next direct trains would be sent as a complete table
+    s_table.valid = false;
+    time_t base = now - now % 60;
+    
+    uint8_t data[DEPARTURES_HEADER_SIZE + MAX_JOURNEY_RECORDS * JOURNEY_RECORD_SIZE];
+    uint8_t *p = data;
+    *p++ = PROTOCOL_VERSION;
+    uint8_t *count = p++;
+    *count = 0;
+    memcpy(p, origin, 3);
+    memcpy(p + 3, destination, 3);
+    p += 6;
+    push_uint32(&p, 0);
+    push_uint32(&p, (uint32_t) base);
+    for (int i = first; i >= 0 && i < s_service_count && *count < MAX_JOURNEY_RECORDS; i++) {
+        if (s_services[i].cancelled || s_services[i].unknown_delay_minutes > 0) {
+            continue;
+        }
+        push_uint16(&p, (uint16_t) ((service_time(i) - base) / 60));
+        push_uint16(&p, crs_code(destination));
+        *p++ = (uint8_t) s_platform;
+        *p++ = 0;
+        push_uint16(&p, (uint16_t) ((service_time(i) + s_journey_minutes * 60 - base) / 60));
+        (*count)++;
+    }
+    
+    s_phone.journeys++;
+    send_to_watch(KEY_JOURNEYS, data, (uint16_t) (p - data));
+}
+
+static void phone_request(void) {
+    s_phone.requests++;
+    if (!s_phone_online) {
+        s_phone.failures++;
+        send_failure();
+        return;
+    }
+    
+    // trains run from home to work in the morning, and back in the afternoon
+    time_t now = host_time(NULL);
+    bool morning = localtime(&now)->tm_hour < 12;
+    const char *origin = morning ? s_home : s_work;
+    const char *destination = morning ? s_work : s_home;
+    int first = next_service(now);
+    
+    if (s_journey_minutes > 0) {
+        send_journeys(now, origin, destination, first);
+        return;
+    }
+    if (!s_table.valid || strcmp(origin, s_table.origin) != 0 || strcmp(destination, s_table.destination) != 0) {
+        send_table(now, origin, destination, first);
+        return;
+    }
+    
+    // otherwise, only the trains that have changed, and any that are new
+    int slots[MAX_DEPARTURE_UPDATE_RECORDS];
+    int changed = 0;
+    for (int slot = 0; slot < s_table.count; slot++) {
+        int i = s_table.service[slot];
+        if (service_time(i) < now && s_table.time[slot] < now && !s_table.delayed[slot]) {
+            continue;
+        }
+        if (service_time(i) != s_table.time[slot] || s_services[i].cancelled != s_table.cancelled[slot] ||
+                is_delayed(i, now) != s_table.delayed[slot]) {
+            if (changed == MAX_DEPARTURE_UPDATE_RECORDS) {
+                send_table(now, origin, destination, first);
+                return;
+            }
+            slots[changed++] = slot;
+        }
+    }
+    
+    int last = s_table.count > 0 ? s_table.service[s_table.count - 1] : first - 1;
+    for (int i = last + 1; i >= 0 && i < s_service_count && s_services[i].scheduled <= now + TIMETABLE_HORIZON_SECONDS;
+            i++) {
+        if (changed == MAX_DEPARTURE_UPDATE_RECORDS || s_table.count == MAX_DEPARTURE_RECORDS) {
+            send_table(now, origin, destination, first);
+            return;
+        }
+        s_table.service[s_table.count] = i;
+        slots[changed++] = s_table.count++;
+    }
+    
+    uint8_t data[DEPARTURE_UPDATES_HEADER_SIZE + MAX_DEPARTURE_UPDATE_RECORDS * (1 + DEPARTURE_RECORD_SIZE)];
+    uint8_t *p = data;
+    *p++ = PROTOCOL_VERSION;
+    *p++ = (uint8_t) changed;
+    push_uint32(&p, 0);
+    for (int j = 0; j < changed; j++) {
+        int slot = slots[j];
+        s_table.time[slot] = service_time(s_table.service[slot]);
+        s_table.cancelled[slot] = s_services[s_table.service[slot]].cancelled;
+        s_table.delayed[slot] = is_delayed(s_table.service[slot], now);
+        *p++ = (uint8_t) slot;
+        push_train(&p, slot);
+    }
+    
+    if (changed == 0) {
+        s_phone.unchanged++;
+    }
+    s_phone.updates++;
+    send_to_watch(KEY_DEPARTURE_UPDATES, data, (uint16_t) (p - data));
+}
+
+static uint32_t read_uint(const uint8_t *data, int size) {
+    uint32_t value = 0;
+    for (int i = size - 1; i >= 0; i--) {
+        value = (value << 8) | data[i];
+    }
+    return value;
+}
+
+static void print_watch_stats(const uint8_t *stats, uint16_t length) {
+    static const char *layers[] = {"time", "date", "trains", "info"};
+    
+    if (length < STATS_SIZE || read_uint(stats, 4) != 1) {
+        printf("watch stats: unrecognised layout\n");
+        return;
+    }
+    
+    uint32_t latency_count = read_uint(&stats[36], 2);
+    char now[16];
+    format_clock(host_clock_ms(), now, sizeof(now));
+    printf("%s watch stats: %u requests, %u responses, latency mean %u ms, max %u ms; redraws",
+           now, read_uint(&stats[32], 2), read_uint(&stats[34], 2),
+           latency_count > 0 ? read_uint(&stats[4], 4) / latency_count : 0, read_uint(&stats[38], 2));
+    for (int i = 0; i < 4; i++) {
+        printf(" %s %u", layers[i], read_uint(&stats[16 + i * 4], 4));
+    }
+    printf("\n");
+}
+
+static void phone_received(const DictionaryIterator *iter) {
+    Tuple *stats = dict_find(iter, KEY_STATS);
+    if (stats != NULL) {
+        print_watch_stats(stats->value->data, stats->length);
+    }
+    
+    Tuple *update = dict_find(iter, KEY_UPDATE);
+    if (update != NULL) {
+        phone_request();
+    }
+}
+
+static void request_stats(void) {
+    uint8_t buffer[16];
+    DictionaryIterator iter;
+    dict_write_begin(&iter, buffer, sizeof(buffer));
+    dict_write_uint8(&iter, KEY_STATS, 1);
+    host_phone_send(buffer, (uint16_t) dict_write_end(&iter), 0);
+}
+
+static void send_config(const int hours[4]) {
+    static uint16_t generation = 0;
+    generation++;
+    
+    uint8_t data[CONFIG_RECORD_SIZE] = {
+        PROTOCOL_VERSION, generation & 0xff, generation >> 8, CONFIG_FLAG_CUSTOMISED_TIMES, 0x7f,
+        hours[0], hours[1], hours[2], hours[3]
+    };
+    uint8_t buffer[32];
+    DictionaryIterator iter;
+    dict_write_begin(&iter, buffer, sizeof(buffer));
+    dict_write_data(&iter, KEY_CONFIG, data, sizeof(data));
+    host_phone_send(buffer, (uint16_t) dict_write_end(&iter), 0);
+}
+
+// replay
+
+static void log_event(const Event *event, const char *description) {
+    if (s_verbose) {
+        char now[16];
+        format_clock(event->time_ms, now, sizeof(now));
+        fprintf(stderr, "%s --- %s\n", now, description);
+    }
+}
+
+void host_run(void) {
+    host_set_phone_handler(phone_received);
+    
+    for (int e = 1; e < s_event_count; e++) {
+        const Event *event = &s_events[e];
+        host_advance_to(event->time_ms);
+        
+        switch (event->type) {
+            case EVENT_TAP:
+                log_event(event, "tap");
+                host_tap();
+                break;
+            case EVENT_BLUETOOTH:
+                log_event(event, event->value ? "bluetooth on" : "bluetooth off");
+                host_set_connected(event->value);
+                break;
+            case EVENT_PHONE:
+                log_event(event, event->value ? "phone online" : "phone offline");
+                s_phone_online = event->value;
+                break;
+            case EVENT_DELAY:
+            case EVENT_DELAYED:
+            case EVENT_CANCEL: {
+                int i = next_service(host_time(NULL));
+                if (i >= 0) {
+                    if (event->type == EVENT_DELAY) {
+                        s_services[i].delay_minutes += event->value;
+                    }
+                    else if (event->type == EVENT_DELAYED) {
+                        s_services[i].unknown_delay_minutes = event->value;
+                    }
+                    else {
+                        s_services[i].cancelled = true;
+                    }
+                }
+                log_event(event, event->type == EVENT_CANCEL ? "next train cancelled" : "next train delayed");
+                break;
+            }
+            case EVENT_BATTERY:
+                log_event(event, "battery");
+                host_set_battery((uint8_t) event->value);
+                break;
+            case EVENT_STATS:
+                log_event(event, "stats requested");
+                request_stats();
+                break;
+            case EVENT_CONFIG:
+                log_event(event, "update periods configured");
+                send_config(event->hours);
+                break;
+            case EVENT_START:
+            case EVENT_END:
+                break;
+        }
+    }
+}
+
+// report
+
+static double mean_us(uint64_t total_ns, uint32_t count) {
+    return count > 0 ? total_ns / 1000.0 / count : 0.0;
+}
+
+static void print_report(void) {
+    const HostCounters *c = host_counters();
+    char start[16], end[16];
+    format_clock(s_events[0].time_ms, start, sizeof(start));
+    format_clock(s_events[s_event_count - 1].time_ms, end, sizeof(end));
+    double hours = (s_events[s_event_count - 1].time_ms - s_events[0].time_ms) / 3600000.0;
+    
+    printf("\nreplayed %s to %s (%.1f h)\n\n", start, end, hours);
+    printf("tick_handler     %u calls, mean %.2f us, max %.2f us CPU\n", c->ticks,
+           mean_us(c->tick_cpu_ns, c->ticks), c->tick_cpu_max_ns / 1000.0);
+    printf("frames           %u, mean %.2f us CPU, %u text draws\n", c->frames,
+           mean_us(c->frame_cpu_ns, c->frames), c->text_draws);
+    for (int i = 0; i < host_layer_count(); i++) {
+        printf("  invalidations  %6u  %s\n", c->layer_invalidations[i], host_layer_description(i));
+    }
+    printf("timers fired     %u\n", c->timers_fired);
+    printf("tap service      subscribed for %.1f h\n", c->tap_service_ms / 3600000.0);
+    printf("AppMessage       %u bytes of buffers, held for %.1f h\n", c->app_message_bytes, c->app_message_ms / 3600000.0);
+    printf("watch -> phone   %u messages, %u bytes; %u failed, %u busy\n", c->outbox_sent, c->outbox_sent_bytes,
+           c->outbox_failed, c->outbox_busy);
+    printf("phone -> watch   %u messages, %u bytes; %u dropped, %u lost while disconnected\n", c->inbox_received,
+           c->inbox_received_bytes, c->inbox_dropped, c->inbox_lost);
+    printf("phone requests   %u; %u failed, %u full tables, %u updates (%u empty), %u with boards\n", s_phone.requests,
+           s_phone.failures, s_phone.tables, s_phone.updates, s_phone.unchanged, s_phone.boards);
+    if (s_journey_minutes > 0) {
+        printf("  journeys       %u answers\n", s_phone.journeys);
+    }
+    printf("persist writes   %u, %u bytes\n", c->persist_writes, c->persist_write_bytes);
+    printf("vibrations       %u\n", c->vibes);
+}
+
+int main(int argc, char **argv) {
+    const char *path = "commute_day.txt";
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-v") == 0) {
+            s_verbose = true;
+        }
+        else {
+            path = argv[i];
+        }
+    }
+    
+    // the watchface is for UK commuters, so the replay runs on UK time whatever the host's zone
+    setenv("TZ", "Europe/London", 1);
+    tzset();
+    
+    load_script(path);
+    build_timetable();
+    host_set_verbose(s_verbose);
+    host_clock_set(s_events[0].time_ms);
+    
+    // runs init(), then app_event_loop() calls host_run(), then deinit()
+    pebble_main();
+    
+    print_report();
+    return 0;
+}
@@ -0,0 +1,579 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+
+// Runs the phone app in Node against the mock Huxley server (mock_huxley.js), with this script playing the part of
+// the watch, and reports the latency of each update, the bytes sent to the watch and the XHRs made.
+//
+// The app is built as wscript builds it: src/*.js and the generated station index, concatenated. Each simulated
+// phone runs its own copy in a separate context, with shims for Pebble, localStorage, navigator.geolocation and
+// XMLHttpRequest. The app's endpoint is set to the mock server, or to the proxy; XHRs to other hosts, such as the
+// clock check, also go to the mock server.
+//
+// Usage: node harness.js [options]
+//   --scenario <name>     mock server scenario (default on-time); see mock_huxley.js
+//   --phones <n>          phones updating concurrently against the same server (default 1)
+//   --updates <n>         update requests from each phone (default 10)
+//   --interval <ms>       time between a phone's update requests (default 1000)
+//   --cache-ttl <s>       the app's cache_ttl setting
+//   --check-time          enable the app's clock check
+//   --proxy               put a departures proxy (tools/proxy/departures_proxy.js) between the phones and the server
+//   --endpoint <url>      use this departures service instead, e.g. a proxy that is already running on localhost
+//   --fix <lat>,<lon>     enable location, with fixes at this position; otherwise the route depends on the time
+//   --routes <list>       the app's saved routes, shown on the watch as boards, e.g. WAT-SUR,CLJ-SUR
+//   --interchange <crs>   the app's interchange, so that the commute is planned as journeys with a change there
+//   --app <path>          run this pebble-js-app.js instead of building one from src
+//   -v                    log the app's console output and the server's requests
+
+var child_process = require('child_process');
+var fs = require('fs');
+var http = require('http');
+var os = require('os');
+var path = require('path');
+var vm = require('vm');
+var mockHuxley = require('./mock_huxley.js');
+var departuresProxy = require('../proxy/departures_proxy.js');
+
+var ROOT = path.join(__dirname, '..', '..');
+var LINK_LATENCY = 50;                  // ms for the watch to acknowledge a message
+var UPDATE_LIMIT = 70000;               // an update that has not been answered after this long is abandoned
+var COARSE_FIX_DELAY = 200;
+var GPS_FIX_DELAY = 1500;
+
+function parseArguments(argv) {
+    var options = {
+        scenario: 'on-time',
+        phones: 1,
+        updates: 10,
+        interval: 1000,
+        cacheTTL: null,
+        checkTime: false,
+        proxy: false,
+        endpoint: null,
+        fix: null,
+        routes: null,
+        interchange: null,
+        app: null,
+        verbose: false
+    };
+    
+    for (var i = 2; i < argv.length; i++) {
+        switch (argv[i]) {
+            case '--scenario': options.scenario = argv[++i]; break;
+            case '--phones': options.phones = parseInt(argv[++i]); break;
+            case '--updates': options.updates = parseInt(argv[++i]); break;
+            case '--interval': options.interval = parseInt(argv[++i]); break;
+            case '--cache-ttl': options.cacheTTL = parseInt(argv[++i]); break;
+            case '--check-time': options.checkTime = true; break;
+            case '--proxy': options.proxy = true; break;
+            case '--endpoint': options.endpoint = argv[++i]; break;
+            case '--fix': options.fix = argv[++i].split(',').map(parseFloat); break;
+            case '--routes': options.routes = argv[++i]; break;
+            case '--interchange': options.interchange = argv[++i]; break;
+            case '--app': options.app = argv[++i]; break;
+            case '-v': options.verbose = true; break;
+            default:
+                console.error('harness.js: unknown option ' + argv[i]);
+                process.exit(2);
+        }
+    }
+    
+    if (!(options.scenario in mockHuxley.scenarios)) {
+        console.error('harness.js: unknown scenario ' + options.scenario + '; one of: ' +
+            Object.keys(mockHuxley.scenarios).join(', '));
+        process.exit(2);
+    }
+    
+    return options;
+}
+
+// concatenates the app as wscript does, with the station index generated by tools/stations_index.py
+function buildApp(verbose) {
+    var sources = [];
+    var walk = function (dir) {
+        fs.readdirSync(dir).sort().forEach(function (name) {
+            var file = path.join(dir, name);
+            if (fs.statSync(file).isDirectory()) {
+                walk(file);
+            }
+            else if (/\.js$/.test(name)) {
+                sources.push(file);
+            }
+        });
+    };
+    walk(path.join(ROOT, 'src'));
+    
+    var index = path.join(os.tmpdir(), 'stations_index.' + process.pid + '.js');
+    var args = [path.join(ROOT, 'tools', 'stations_index.py'), path.join(ROOT, 'data', 'stations.csv'), index];
+    var spawnOptions = {stdio: ['ignore', 'ignore', verbose ? 'inherit' : 'ignore']};
+    try {
+        child_process.execFileSync('python3', args, spawnOptions);
+    }
+    catch (err) {
+        child_process.execFileSync('python', args, spawnOptions);
+    }
+    sources.push(index);
+    
+    var app = sources.map(function (file) {
+        return fs.readFileSync(file, 'utf8');
+    }).join('\n');
+    fs.unlinkSync(index);
+    return app;
+}
+
+// a Date constructor whose clock runs offset ms ahead of the host's
+function createDate(offset) {
+    var RealDate = Date;
+    var OffsetDate = function () {
+        if (!(this instanceof OffsetDate)) {
+            return new RealDate(RealDate.now() + offset).toString();
+        }
+        var args = arguments.length === 0 ? [RealDate.now() + offset] : Array.prototype.slice.call(arguments);
+        return new (Function.prototype.bind.apply(RealDate, [null].concat(args)))();
+    };
+    OffsetDate.now = function () {
+        return RealDate.now() + offset;
+    };
+    OffsetDate.UTC = RealDate.UTC;
+    OffsetDate.parse = RealDate.parse;
+    OffsetDate.prototype = RealDate.prototype;
+    return OffsetDate;
+}
+
+// size of a dictionary as sent over Bluetooth: a count byte, then a 7-byte header and the value for each key
+function dictionarySize(dictionary) {
+    var size = 1;
+    for (var key in dictionary) {
+        var value = dictionary[key];
+        size += 7;
+        if (Array.isArray(value)) {
+            size += value.length;
+        }
+        else if (typeof value === 'string') {
+            size += Buffer.byteLength(value) + 1;
+        }
+        else {
+            size += 4;
+        }
+    }
+    return size;
+}
+
+function createLocalStorage(items) {
+    return {
+        getItem: function (key) {
+            return items.hasOwnProperty(key) ? items[key] : null;
+        },
+        setItem: function (key, value) {
+            items[key] = String(value);
+        },
+        removeItem: function (key) {
+            delete items[key];
+        },
+        clear: function () {
+            for (var key in items) {
+                delete items[key];
+            }
+        }
+    };
+}
+
+function createGeolocation(options, Clock) {
+    return {
+        getCurrentPosition: function (success, error, positionOptions) {
+            var highAccuracy = positionOptions && positionOptions.enableHighAccuracy;
+            setTimeout(function () {
+                if (options.fix === null) {
+                    error({code: 1, message: 'User denied Geolocation'});
+                    return;
+                }
+                success({
+                    coords: {latitude: options.fix[0], longitude: options.fix[1], accuracy: highAccuracy ? 10 : 150, speed: null},
+                    timestamp: Clock.now()
+                });
+            }, highAccuracy ? GPS_FIX_DELAY : COARSE_FIX_DELAY);
+        }
+    };
+}
+
+function createXMLHttpRequest(phone, mockPort) {
+    var XMLHttpRequest = function () {
+        this.readyState = 0;
+        this.status = 0;
+        this.responseText = '';
+        this.timeout = 0;
+        this.onload = null;
+        this.onerror = null;
+        this.ontimeout = null;
+        this.requestHeaders = {};
+        this.responseHeaders = {};
+    };
+    
+    XMLHttpRequest.prototype.open = function (method, url) {
+        this.method = method;
+        this.url = url;
+        this.readyState = 1;
+    };
+    
+    XMLHttpRequest.prototype.setRequestHeader = function (name, value) {
+        this.requestHeaders[name] = value;
+    };
+    
+    XMLHttpRequest.prototype.getResponseHeader = function (name) {
+        var value = this.responseHeaders[name.toLowerCase()];
+        return value === undefined ? null : value;
+    };
+    
+    XMLHttpRequest.prototype.send = function (body) {
+        var xhr = this;
+        var target = /^[a-z]+:\/\/([^\/:]+)(?::(\d+))?(\/.*)?$/.exec(xhr.url);
+        var local = target !== null && (target[1] === 'localhost' || target[1] === '127.0.0.1');
+        var kind = /\/utc\/now$/.test(xhr.url) ? 'clock' : /\/service\//.test(xhr.url) ? 'services' : 'departures';
+        phone.xhr[kind]++;
+        
+        var finished = false;
+        var timer = null;
+        var finish = function (handler) {
+            if (!finished) {
+                finished = true;
+                clearTimeout(timer);
+                xhr.readyState = 4;
+                if (handler) {
+                    handler.call(xhr);
+                }
+            }
+        };
+        
+        var request = http.request({
+            host: 'localhost',
+            port: local ? parseInt(target[2] || '80') : mockPort,
+            method: xhr.method,
+            path: target && target[3] ? target[3] : '/',
+            headers: xhr.requestHeaders
+        }, function (response) {
+            var chunks = [];
+            response.on('data', function (chunk) {
+                chunks.push(chunk);
+            });
+            response.on('end', function () {
+                xhr.status = response.statusCode;
+                xhr.responseHeaders = response.headers;
+                xhr.responseText = Buffer.concat(chunks).toString('utf8');
+                phone.xhr.bytes += Buffer.byteLength(xhr.responseText);
+                if (response.statusCode === 304) {
+                    phone.xhr.notModified++;
+                }
+                finish(xhr.onload);
+            });
+        });
+        request.on('error', function () {
+            if (!finished) {
+                phone.xhr.errors++;
+            }
+            finish(xhr.onerror);
+        });
+        if (xhr.timeout > 0) {
+            timer = setTimeout(function () {
+                phone.xhr.timeouts++;
+                finish(xhr.ontimeout);
+                request.destroy();
+            }, xhr.timeout);
+        }
+        request.end(body);
+    };
+    
+    return XMLHttpRequest;
+}
+
+// the watch's side of AppMessage: counts what is sent to it, and answers the update in progress
+function createPebble(phone) {
+    return {
+        addEventListener: function (type, listener) {
+            (phone.listeners[type] = phone.listeners[type] || []).push(listener);
+        },
+        sendAppMessage: function (dictionary, success, error) {
+            var size = dictionarySize(dictionary);
+            phone.sent.messages++;
+            phone.sent.bytes += size;
+            
+            if ('KEY_CONFIG' in dictionary) {
+                phone.configGeneration = dictionary.KEY_CONFIG[1] | (dictionary.KEY_CONFIG[2] << 8);
+            }
+            
+            if ('KEY_BOARDS' in dictionary) {
+                phone.sent.boards++;
+                phone.sent.boardsBytes += dictionary.KEY_BOARDS.length;
+            }
+            
+            var answer = null;
+            if ('KEY_DEPARTURES' in dictionary) {
+                answer = 'tables';
+            }
+            else if ('KEY_DEPARTURE_UPDATES' in dictionary) {
+                answer = 'updates';
+            }
+            else if ('KEY_JOURNEYS' in dictionary) {
+                answer = 'journeys';
+                phone.sent.journeyRecords += dictionary.KEY_JOURNEYS[1];
+            }
+            else if ('KEY_LAST_REQUEST_FAILED' in dictionary) {
+                answer = 'failures';
+            }
+            if (answer !== null) {
+                phone.sent[answer]++;
+                if (dictionary.KEY_LAST_REQUEST_FAILED && answer !== 'failures') {
+                    phone.sent.stale++;
+                }
+                if (phone.pending !== null) {
+                    phone.pending(size);
+                }
+            }
+            
+            setTimeout(function () {
+                if (success) {
+                    success({data: {transactionId: phone.sent.messages}});
+                }
+            }, LINK_LATENCY);
+            return phone.sent.messages;
+        },
+        openURL: function (url) {},
+        getAccountToken: function () {
+            return '';
+        }
+    };
+}
+
+function createPhone(id, app, options, mockPort) {
+    var phone = {
+        id: id,
+        listeners: {},
+        storage: {},
+        pending: null,
+        configGeneration: 0,
+        latencies: [],
+        unanswered: 0,
+        sent: {messages: 0, bytes: 0, answerBytes: 0, tables: 0, updates: 0, failures: 0, stale: 0, boards: 0, boardsBytes: 0,
+               journeys: 0, journeyRecords: 0},
+        xhr: {departures: 0, services: 0, clock: 0, notModified: 0, errors: 0, timeouts: 0, bytes: 0}
+    };
+    
+    if (options.fix === null) {
+        phone.storage.useLocation = 'false';
+    }
+    if (options.cacheTTL !== null) {
+        phone.storage.cache_ttl = String(options.cacheTTL);
+    }
+    if (options.checkTime) {
+        phone.storage.check_time = 'true';
+    }
+    phone.storage.endpoint = options.endpoint;
+    if (options.routes !== null) {
+        phone.storage.routes = options.routes;
+    }
+    if (options.interchange !== null) {
+        phone.storage.interchange = options.interchange;
+    }
+    
+    var Clock = createDate(options.clockOffset);
+    var context = vm.createContext({
+        console: {
+            log: function (message) {
+                if (options.verbose) {
+                    process.stderr.write('[phone ' + id + '] ' + message + '\n');
+                }
+            }
+        },
+        setTimeout: setTimeout,
+        clearTimeout: clearTimeout,
+        setInterval: setInterval,
+        clearInterval: clearInterval,
+        Date: Clock,
+        localStorage: createLocalStorage(phone.storage),
+        navigator: {geolocation: createGeolocation(options, Clock)},
+        XMLHttpRequest: createXMLHttpRequest(phone, mockPort),
+        Pebble: createPebble(phone)
+    });
+    vm.runInContext(app, context, {filename: 'pebble-js-app.js'});
+    
+    phone.dispatch = function (type, e) {
+        (phone.listeners[type] || []).forEach(function (listener) {
+            listener(e);
+        });
+    };
+    
+    return phone;
+}
+
+// sends the phone a series of update requests, each after the previous one has been answered
+function runPhone(phone, options, done) {
+    var count = 0;
+    
+    var next = function () {
+        if (count++ >= options.updates) {
+            done();
+            return;
+        }
+        
+        var start = Date.now();
+        var limit = setTimeout(function () {
+            phone.pending = null;
+            phone.unanswered++;
+            next();
+        }, UPDATE_LIMIT);
+        
+        phone.pending = function (size) {
+            clearTimeout(limit);
+            phone.pending = null;
+            phone.latencies.push(Date.now() - start);
+            phone.sent.answerBytes += size;
+            setTimeout(next, options.interval);
+        };
+        
+        phone.dispatch('appmessage', {payload: {KEY_UPDATE: 1, KEY_CONFIG_GENERATION: phone.configGeneration}});
+    };
+    
+    phone.dispatch('ready', {});
+    
+    // spread the phones over the interval, as real users are
+    setTimeout(next, Math.floor(options.interval * phone.id / options.phones));
+}
+
+function percentile(sorted, p) {
+    if (sorted.length === 0) {
+        return 0;
+    }
+    return sorted[Math.min(sorted.length - 1, Math.floor(p / 100 * sorted.length))];
+}
+
+function sum(phones, f) {
+    return phones.reduce(function (total, phone) {
+        return total + f(phone);
+    }, 0);
+}
+
+function report(options, phones, server, proxy) {
+    var scenario = mockHuxley.scenarios[options.scenario];
+    var latencies = [].concat.apply([], phones.map(function (phone) {
+        return phone.latencies;
+    })).sort(function (a, b) {
+        return a - b;
+    });
+    var answered = latencies.length;
+    var mean = answered > 0 ? Math.round(latencies.reduce(function (a, b) { return a + b; }, 0) / answered) : 0;
+    var answerBytes = sum(phones, function (p) { return p.sent.answerBytes; });
+    
+    console.log('scenario ' + options.scenario + ': ' + scenario.description);
+    console.log(options.phones + ' phone(s) x ' + options.updates + ' updates, ' + options.interval + ' ms apart' +
+        (options.fix !== null ? ', with location' : '') + '\n');
+    console.log('updates         ' + answered + ' answered, ' + sum(phones, function (p) { return p.unanswered; }) + ' unanswered');
+    console.log('  answers       ' + sum(phones, function (p) { return p.sent.tables; }) + ' full tables, ' +
+        sum(phones, function (p) { return p.sent.updates; }) + ' updates, ' +
+        sum(phones, function (p) { return p.sent.failures; }) + ' failures; ' +
+        sum(phones, function (p) { return p.sent.stale; }) + ' served from the cache after a failure');
+    if (options.interchange !== null) {
+        console.log('  journeys      ' + sum(phones, function (p) { return p.sent.journeys; }) + ' answers, ' +
+            sum(phones, function (p) { return p.sent.journeyRecords; }) + ' journeys via ' + options.interchange);
+    }
+    console.log('latency         mean ' + mean + ' ms, median ' + percentile(latencies, 50) + ' ms, 95th percentile ' +
+        percentile(latencies, 95) + ' ms, max ' + (answered > 0 ? latencies[answered - 1] : 0) + ' ms');
+    console.log('sent to watch   ' + sum(phones, function (p) { return p.sent.messages; }) + ' messages, ' +
+        sum(phones, function (p) { return p.sent.bytes; }) + ' bytes; ' +
+        (answered > 0 ? Math.round(answerBytes / answered) : 0) + ' bytes per answer');
+    if (options.routes !== null) {
+        console.log('  boards        sent with ' + sum(phones, function (p) { return p.sent.boards; }) + ' answers, ' +
+            sum(phones, function (p) { return p.sent.boardsBytes; }) + ' bytes');
+    }
+    console.log('xhr             ' + sum(phones, function (p) { return p.xhr.departures; }) + ' departures (' +
+        sum(phones, function (p) { return p.xhr.notModified; }) + ' not modified, ' +
+        sum(phones, function (p) { return p.xhr.errors; }) + ' errors, ' +
+        sum(phones, function (p) { return p.xhr.timeouts; }) + ' timeouts), ' +
+        sum(phones, function (p) { return p.xhr.services; }) + ' service details, ' +
+        sum(phones, function (p) { return p.xhr.clock; }) + ' clock; ' +
+        sum(phones, function (p) { return p.xhr.bytes; }) + ' bytes received');
+    console.log('server          ' + server.stats.requests + ' requests, ' + server.stats.departures + ' boards, ' +
+        server.stats.services + ' services, ' +
+        server.stats.notModified + ' not modified, ' + server.stats.failed + ' failed');
+    if (proxy !== null) {
+        console.log('proxy           ' + proxy.stats.requests + ' requests, ' + proxy.stats.hits + ' cache hits, ' +
+            proxy.stats.shared + ' shared fetches, ' + proxy.stats.fetches + ' fetches (' + proxy.stats.fetchFailures +
+            ' failed), ' + proxy.stats.staleServed + ' served stale, ' + proxy.stats.serviceFetches + ' service fetches');
+    }
+}
+
+function main() {
+    // the phone app works in UK local time
+    process.env.TZ = 'Europe/London';
+    
+    var options = parseArguments(process.argv);
+    var app = options.app !== null ? fs.readFileSync(options.app, 'utf8') : buildApp(options.verbose);
+    
+    // some scenarios run the phones' clocks at a particular time of day
+    options.clockOffset = 0;
+    var clock = mockHuxley.scenarios[options.scenario].clock;
+    if (clock) {
+        var start = new Date();
+        start.setHours(parseInt(clock.split(':')[0]), parseInt(clock.split(':')[1]), 0, 0);
+        options.clockOffset = start.getTime() - Date.now();
+    }
+    
+    var server = mockHuxley.createServer({
+        scenario: options.scenario,
+        clockOffset: options.clockOffset,
+        log: options.verbose ? function (line) { process.stderr.write('[server] ' + line + '\n'); } : null
+    });
+    
+    var proxy = null;
+    
+    var start = function (mockPort) {
+        var phones = [];
+        var running = options.phones;
+        
+        for (var i = 0; i < options.phones; i++) {
+            phones.push(createPhone(i, app, options, mockPort));
+        }
+        phones.forEach(function (phone) {
+            runPhone(phone, options, function () {
+                if (--running === 0) {
+                    report(options, phones, server, proxy);
+                    process.exit(0);
+                }
+            });
+        });
+    };
+    
+    server.listen(0, 'localhost', function () {
+        var mockPort = server.address().port;
+        if (options.endpoint === null) {
+            options.endpoint = 'http://localhost:' + mockPort;
+        }
+        if (!options.proxy) {
+            start(mockPort);
+            return;
+        }
+        
+        proxy = departuresProxy.createProxy({
+            upstream: 'http://localhost:' + mockPort,
+            log: options.verbose ? function (line) { process.stderr.write('[proxy] ' + line + '\n'); } : null
+        });
+        proxy.listen(0, 'localhost', function () {
+            options.endpoint = 'http://localhost:' + proxy.address().port;
+            start(mockPort);
+        });
+    });
+}
+
+main();
@@ -0,0 +1,359 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+
+// A local stand-in for the Huxley departures service, for tools/phone/harness.js and for running the phone app
+// offline. It serves generated departure boards in Huxley's JSON format, with scripted disruption:
+//
+//   GET /departures/<origin>/to/<destination>/<rows>   departure board; supports ETag and If-None-Match, and
+//                                                      ?expand=true for the calling point at the destination
+//   GET /service/<service id>                          details of a service on a board served earlier
+//   GET /utc/now                                       the current UTC time, in place of timeapi.org
+//
+// Trains run every 15 minutes, from 4 minutes past the hour, in both directions between any pair of stations. The
+// journey time between a pair of stations is fixed, between 10 and 39 minutes, with a stop every 8 minutes or so.
+//
+// Usage: node mock_huxley.js [--port 8080] [--scenario on-time]
+
+var http = require('http');
+var crypto = require('crypto');
+
+var SERVICE_INTERVAL = 15;          // minutes between trains
+var SERVICE_OFFSET = 4;             // minutes past the hour of the first train
+
+// each scenario may change the services on a board, choose a response delay, or fail requests
+//   clock: local time at which the harness starts the phone's clock, e.g. to cross midnight
+var scenarios = {
+    'on-time': {
+        description: 'every train on time'
+    },
+    'delayed': {
+        description: 'every other train delayed by 5-12 minutes; some only reported as delayed',
+        service: function (service, i, std) {
+            if (i % 2 === 1) {
+                service.etd = formatTime(new Date(std.getTime() + (5 + (i * 3) % 8) * 60000));
+                service.delayReason = 'This train has been delayed by a signalling problem';
+            }
+            else if (i % 6 === 4) {
+                service.etd = 'Delayed';
+            }
+        }
+    },
+    'cancelled': {
+        description: 'one train in three cancelled',
+        service: function (service, i, std) {
+            if (i % 3 === 1) {
+                service.etd = 'Cancelled';
+                service.isCancelled = true;
+                service.cancelReason = 'This train has been cancelled because of a shortage of train crew';
+            }
+        }
+    },
+    'midnight': {
+        description: 'the last trains of the day, crossing midnight',
+        clock: '23:35'
+    },
+    'slow': {
+        description: 'responses take 2-5 seconds',
+        delay: function (count) {
+            return 2000 + (count * 1237) % 3000;
+        }
+    },
+    'failing': {
+        description: 'requests fail in turn with HTTP 503, a reset connection and invalid JSON, then succeed',
+        fail: function (count, response) {
+            switch (count % 4) {
+                case 0:
+                    response.writeHead(503, {'Content-Type': 'text/plain', 'Retry-After': '30'});
+                    response.end('Service Unavailable');
+                    return true;
+                case 1:
+                    response.socket.destroy();
+                    return true;
+                case 2:
+                    response.writeHead(200, {'Content-Type': 'application/json'});
+                    response.end('{"trainServices": [');
+                    return true;
+            }
+            return false;
+        }
+    }
+};
+
+function pad(n) {
+    return (n < 10 ? '0' : '') + n;
+}
+
+function formatTime(date) {
+    return pad(date.getHours()) + ':' + pad(date.getMinutes());
+}
+
+// minutes between a pair of stations, the same in both directions
+function journeyMinutes(origin, destination) {
+    var pair = [origin, destination].sort().join('');
+    var hash = 0;
+    for (var i = 0; i < pair.length; i++) {
+        hash = (hash * 31 + pair.charCodeAt(i)) % 1000;
+    }
+    return 10 + hash % 30;
+}
+
+// the calling point at the destination, with its arrival time following the departure's disruption
+function createCallingPoint(service, destination, std) {
+    var minutes = journeyMinutes(service.origin[0].crs, destination);
+    var et = 'On time';
+    if (service.isCancelled || service.etd === 'Cancelled' || service.etd === 'Delayed') {
+        et = service.etd;
+    }
+    else if (service.etd.indexOf(':') > -1) {
+        var etd = service.etd.split(':');
+        var departure = new Date(std.getTime());
+        departure.setHours(etd[0], etd[1]);
+        if (departure < std) {
+            departure.setDate(departure.getDate() + 1);
+        }
+        et = formatTime(new Date(departure.getTime() + minutes * 60000));
+    }
+    
+    return {
+        locationName: destination,
+        crs: destination,
+        st: formatTime(new Date(std.getTime() + minutes * 60000)),
+        et: et,
+        at: null,
+        isCancelled: service.isCancelled,
+        length: 8,
+        detachFront: false,
+        adhocAlerts: null
+    };
+}
+
+// a service's details in Huxley's format, with its calling points up to the destination of the board it was on
+function createServiceDetails(entry) {
+    var minutes = journeyMinutes(entry.origin, entry.destination);
+    var stops = Math.floor(minutes / 8);
+    var points = [];
+    for (var i = 1; i <= stops + 1; i++) {
+        var crs = i <= stops ? 'XX' + String.fromCharCode(64 + i) : entry.destination;
+        var st = new Date(entry.std.getTime() + Math.round(minutes * i / (stops + 1)) * 60000);
+        points.push({locationName: crs, crs: crs, st: formatTime(st), et: 'On time', at: null, isCancelled: false,
+                     length: 8, detachFront: false, adhocAlerts: null});
+    }
+    
+    return {
+        previousCallingPoints: null,
+        subsequentCallingPoints: [{callingPoint: points, serviceType: 0, serviceChangeRequired: false, assocIsCancelled: false}],
+        generatedAt: new Date().toISOString(),
+        serviceType: 0,
+        locationName: entry.origin,
+        crs: entry.origin,
+        operator: 'Mock Trains',
+        operatorCode: 'MT',
+        rsid: null,
+        isCancelled: false,
+        cancelReason: null,
+        delayReason: null,
+        overdueMessage: null,
+        length: 8,
+        detachFront: false,
+        isReverseFormation: false,
+        platform: null,
+        sta: null,
+        eta: null,
+        ata: null,
+        std: formatTime(entry.std),
+        etd: 'On time',
+        atd: null,
+        adhocAlerts: null
+    };
+}
+
+function location(crs) {
+    return {locationName: crs, crs: crs, via: null, futureChangeTo: null, assocIsCancelled: false};
+}
+
+// a departure board in Huxley's format, including the fields that the phone app ignores, so that response sizes
+// are realistic
+function createBoard(scenario, origin, destination, rows, expand, now, served) {
+    var first = new Date(now.getTime());
+    first.setSeconds(0, 0);
+    first.setMinutes(first.getMinutes() - (first.getMinutes() - SERVICE_OFFSET + 60) % SERVICE_INTERVAL);
+    
+    var services = [];
+    for (var i = 0; i < rows; i++) {
+        var std = new Date(first.getTime() + i * SERVICE_INTERVAL * 60000);
+        var id = crypto.createHash('md5').update(origin + destination + std.toISOString()).digest('base64').substr(0, 22);
+        
+        var service = {
+            previousCallingPoints: null,
+            subsequentCallingPoints: null,
+            origin: [location(origin)],
+            destination: [location(destination)],
+            currentOrigins: null,
+            currentDestinations: null,
+            rsid: null,
+            sta: null,
+            eta: null,
+            std: formatTime(std),
+            etd: 'On time',
+            platform: String(1 + (std.getHours() + i) % 4),
+            operator: 'Mock Trains',
+            operatorCode: 'MT',
+            isCircularRoute: false,
+            isCancelled: false,
+            filterLocationCancelled: false,
+            serviceType: 0,
+            length: 8,
+            detachFront: false,
+            isReverseFormation: false,
+            cancelReason: null,
+            delayReason: null,
+            serviceID: id,
+            serviceIdPercentEncoded: encodeURIComponent(id),
+            serviceIdGuid: null,
+            serviceIdUrlSafe: id.replace(/\+/g, '-').replace(/\//g, '_'),
+            adhocAlerts: null
+        };
+        
+        if (scenario.service) {
+            scenario.service(service, i, std);
+        }
+        served[id] = {origin: origin, destination: destination, std: std};
+        if (expand) {
+            service.subsequentCallingPoints = [{callingPoint: [createCallingPoint(service, destination, std)], serviceType: 0,
+                                                serviceChangeRequired: false, assocIsCancelled: false}];
+        }
+        services.push(service);
+    }
+    
+    return {
+        trainServices: services,
+        busServices: null,
+        ferryServices: null,
+        generatedAt: now.toISOString(),
+        locationName: origin,
+        crs: origin,
+        filterLocationName: destination,
+        filtercrs: destination,
+        filterType: 0,
+        nrccMessages: null,
+        platformAvailable: true,
+        areServicesAvailable: true
+    };
+}
+
+/**
+ * Creates a mock Huxley server; call listen() on the result.
+ * @param options {scenario: name, clockOffset: ms to add to the host's clock, log: function (line)}
+ * @returns http.Server, with a stats property {requests, departures, services, notModified, failed, bytes}
+ */
+function createServer(options) {
+    var scenario = scenarios[options.scenario || 'on-time'];
+    if (!scenario) {
+        throw new Error('unknown scenario: ' + options.scenario);
+    }
+    var clockOffset = options.clockOffset || 0;
+    var stats = {requests: 0, departures: 0, services: 0, notModified: 0, failed: 0, bytes: 0};
+    var served = {};        // the services on the boards served so far, by service id
+    
+    var server = http.createServer(function (request, response) {
+        var count = stats.requests++;
+        var now = new Date(Date.now() + clockOffset);
+        if (options.log) {
+            options.log(request.method + ' ' + request.url);
+        }
+        
+        if (request.url === '/utc/now') {
+            response.writeHead(200, {'Content-Type': 'text/plain'});
+            response.end(now.toISOString());
+            return;
+        }
+        
+        var service = /^\/service\/([^\/?]+)$/.exec(request.url);
+        if (service !== null && served.hasOwnProperty(decodeURIComponent(service[1]))) {
+            stats.services++;
+            var details = JSON.stringify(createServiceDetails(served[decodeURIComponent(service[1])]));
+            stats.bytes += Buffer.byteLength(details);
+            response.writeHead(200, {'Content-Type': 'application/json; charset=utf-8'});
+            response.end(details);
+            return;
+        }
+        
+        var match = /^\/departures\/([A-Z]{3})\/to\/([A-Z]{3})\/(\d+)(\?expand=true)?$/.exec(request.url);
+        if (match === null) {
+            response.writeHead(404, {'Content-Type': 'text/plain'});
+            response.end('Not Found');
+            return;
+        }
+        stats.departures++;
+        
+        var respond = function () {
+            if (scenario.fail && scenario.fail(count, response)) {
+                stats.failed++;
+                return;
+            }
+            
+            var body = JSON.stringify(createBoard(scenario, match[1], match[2], Math.min(parseInt(match[3]), 150), !!match[4], now, served));
+            var etag = '"' + crypto.createHash('md5').update(body.replace(/"generatedAt":"[^"]*"/, '')).digest('hex') + '"';
+            if (request.headers['if-none-match'] === etag) {
+                stats.notModified++;
+                response.writeHead(304, {'ETag': etag});
+                response.end();
+                return;
+            }
+            
+            stats.bytes += Buffer.byteLength(body);
+            response.writeHead(200, {'Content-Type': 'application/json; charset=utf-8', 'ETag': etag});
+            response.end(body);
+        };
+        
+        var delay = scenario.delay ? scenario.delay(count) : 0;
+        if (delay > 0) {
+            setTimeout(respond, delay);
+        }
+        else {
+            respond();
+        }
+    });
+    
+    server.stats = stats;
+    return server;
+}
+
+module.exports = {
+    scenarios: scenarios,
+    createServer: createServer
+};
+
+if (require.main === module) {
+    var port = 8080;
+    var scenario = 'on-time';
+    for (var i = 2; i < process.argv.length; i++) {
+        if (process.argv[i] === '--port') {
+            port = parseInt(process.argv[++i]);
+        }
+        else if (process.argv[i] === '--scenario') {
+            scenario = process.argv[++i];
+        }
+    }
+    
+    // departure times are UK local times
+    process.env.TZ = 'Europe/London';
+    createServer({scenario: scenario, log: console.log}).listen(port, function () {
+        console.log('mock Huxley (' + scenario + ': ' + scenarios[scenario].description + ') on http://localhost:' + port + '/');
+    });
+}
@@ -0,0 +1,295 @@
+/*  Commuter Bliss UK - a Pebble watchface for UK rail commuters
+    Copyright (C) 2015 Steven Blair
+
+    This program is free software: you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation, either version 3 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program. If not, see <http://www.gnu.org/licenses/>. */
+
+
+
+// A reference departures proxy, which phones can use in place of Huxley by setting the endpoint on the config page.
+// Each board is fetched from Huxley at most once per TTL, whatever the number of phones asking for it, and responses
+// are trimmed to the fields that data.js reads:
+//
+//   GET /departures/<origin>/to/<destination>/<rows>[?expand=true]
+//     {"trainServices": [{"std", "etd", "platform", "isCancelled", "destination": [{"crs"}], "serviceID"}]}
+//     expanded boards also keep the calling point at the destination, for journeys with a change:
+//     "subsequentCallingPoints": [{"callingPoint": [{"crs", "st", "et", "isCancelled"}]}]
+//   GET /service/<service id>
+//     {"std", "subsequentCallingPoints": [{"callingPoint": [{"crs", "st"}]}]}, cached for SERVICE_TTL
+//   GET /stats
+//     counters of requests, cache hits and upstream fetches
+//
+// Boards are fetched with enough rows for the largest request, so that requests for the same route with different
+// numbers of rows share one upstream fetch. If Huxley fails, a cached board is served for up to MAX_STALE.
+//
+// Usage: node departures_proxy.js [--port 8081] [--upstream http://commuter-bliss-uk.apphb.com] [--ttl 30]
+//   e.g. against the mock server: node departures_proxy.js --upstream http://localhost:8080
+
+var http = require('http');
+var https = require('https');
+var crypto = require('crypto');
+
+var DEFAULT_UPSTREAM = 'http://commuter-bliss-uk.apphb.com';
+var DEFAULT_TTL = 30;                   // seconds for which a board is served without fetching it again
+var MAX_STALE = 10 * 60;                // seconds for which a board is served while Huxley is failing
+var MIN_ROWS = 36;                      // rows fetched for each board; MAX_TIMETABLE_TRAINS in data.js
+var MAX_ROWS = 150;                     // Huxley's limit
+var UPSTREAM_TIMEOUT = 10000;
+var SERVICE_TTL = 10 * 60;              // seconds; the phone only uses a service's scheduled calling points
+
+// keeps the fields that the phone app reads; for an expanded board, that is the calling point at the filter station
+function trimBoard(board, filter) {
+    var services = (board && board.trainServices) || [];
+    return services.map(function (service) {
+        var destination = service.destination && service.destination[0] ? service.destination[0].crs : null;
+        var trimmed = {
+            std: service.std,
+            etd: service.etd,
+            platform: service.platform,
+            isCancelled: service.isCancelled === true || service.etd === 'Cancelled',
+            destination: [{crs: destination}],
+            serviceID: service.serviceID
+        };
+        
+        if (service.subsequentCallingPoints && service.subsequentCallingPoints[0]) {
+            var points = (service.subsequentCallingPoints[0].callingPoint || []).filter(function (point) {
+                return point.crs === filter;
+            }).map(function (point) {
+                return {crs: point.crs, st: point.st, et: point.et, isCancelled: point.isCancelled === true};
+            });
+            trimmed.subsequentCallingPoints = [{callingPoint: points}];
+        }
+        return trimmed;
+    });
+}
+
+function trimService(service) {
+    var points = service.subsequentCallingPoints && service.subsequentCallingPoints[0] ?
+        service.subsequentCallingPoints[0].callingPoint || [] : [];
+    return {
+        std: service.std,
+        subsequentCallingPoints: [{callingPoint: points.map(function (point) {
+            return {crs: point.crs, st: point.st};
+        })}]
+    };
+}
+
+/**
+ * Creates a departures proxy; call listen() on the result.
+ * @param options {upstream: base URL of Huxley, ttl: seconds, log: function (line)}
+ * @returns http.Server, with a stats property
+ */
+function createProxy(options) {
+    var upstream = (options.upstream || DEFAULT_UPSTREAM).replace(/\/+$/, '');
+    var ttl = (options.ttl > 0 ? options.ttl : DEFAULT_TTL) * 1000;
+    var client = /^https:/.test(upstream) ? https : http;
+    var stats = {requests: 0, hits: 0, shared: 0, fetches: 0, fetchFailures: 0, staleServed: 0, services: 0, serviceFetches: 0};
+    
+    // boards by route, and query for expanded boards: {services, rows, fetched, pending: [callbacks] or null, pendingRows}
+    var cache = {};
+    
+    // fetches and parses a JSON response from Huxley: callback(err, json)
+    var getUpstream = function (url, callback) {
+        if (options.log) {
+            options.log('fetch ' + url);
+        }
+        var request = client.get(url, function (response) {
+            var chunks = [];
+            response.on('data', function (chunk) {
+                chunks.push(chunk);
+            });
+            response.on('end', function () {
+                if (response.statusCode !== 200) {
+                    callback(new Error('HTTP ' + response.statusCode));
+                    return;
+                }
+                var json;
+                try {
+                    json = JSON.parse(Buffer.concat(chunks).toString('utf8'));
+                }
+                catch (err) {
+                    callback(err);
+                    return;
+                }
+                callback(null, json);
+            });
+        });
+        request.setTimeout(UPSTREAM_TIMEOUT, function () {
+            request.destroy(new Error('timeout'));
+        });
+        request.on('error', function (err) {
+            callback(err);
+        });
+    };
+    
+    // service details by service id: {body, fetched}
+    var services = {};
+    
+    var serveService = function (id, response) {
+        stats.services++;
+        var entry = services[id];
+        if (entry && Date.now() - entry.fetched < SERVICE_TTL * 1000) {
+            response.writeHead(200, {'Content-Type': 'application/json; charset=utf-8'});
+            response.end(entry.body);
+            return;
+        }
+        
+        stats.serviceFetches++;
+        getUpstream(upstream + '/service/' + encodeURIComponent(id), function (err, json) {
+            if (err !== null) {
+                response.writeHead(502, {'Content-Type': 'text/plain'});
+                response.end('Bad Gateway');
+                return;
+            }
+            
+            // entries are dropped once stale, as service ids are not reused within a day
+            var now = Date.now();
+            for (var k in services) {
+                if (services.hasOwnProperty(k) && now - services[k].fetched >= SERVICE_TTL * 1000) {
+                    delete services[k];
+                }
+            }
+            services[id] = {body: JSON.stringify(trimService(json)), fetched: now};
+            response.writeHead(200, {'Content-Type': 'application/json; charset=utf-8'});
+            response.end(services[id].body);
+        });
+    };
+    
+    var fetchBoard = function (route, query, rows, callback) {
+        var key = route.origin + '/to/' + route.destination + query;
+        var entry = cache[key] || (cache[key] = {services: null, rows: 0, fetched: 0, pending: null, pendingRows: 0});
+        var now = Date.now();
+        
+        if (entry.services !== null && entry.rows >= rows && now - entry.fetched < ttl) {
+            stats.hits++;
+            callback(null, entry);
+            return;
+        }
+        
+        // a fetch for this route is already in progress; share its result, if it has enough rows
+        if (entry.pending !== null && entry.pendingRows >= rows) {
+            stats.shared++;
+            entry.pending.push(callback);
+            return;
+        }
+        
+        // a larger fetch supersedes one in progress, and answers the requests that were waiting for it too
+        var pending = entry.pending = (entry.pending || []).concat([callback]);
+        entry.pendingRows = Math.min(MAX_ROWS, Math.max(MIN_ROWS, rows));
+        stats.fetches++;
+        
+        var finish = function (err, services) {
+            if (entry.pending !== pending) {
+                return;
+            }
+            entry.pending = null;
+            
+            if (err === null) {
+                entry.services = services;
+                entry.rows = entry.pendingRows;
+                entry.fetched = Date.now();
+            }
+            else {
+                stats.fetchFailures++;
+            }
+            pending.forEach(function (cb) {
+                cb(err, entry);
+            });
+        };
+        
+        var url = upstream + '/departures/' + route.origin + '/to/' + route.destination + '/' + entry.pendingRows + query;
+        getUpstream(url, function (err, json) {
+            finish(err, err === null ? trimBoard(json, route.destination) : null);
+        });
+    };
+    
+    var server = http.createServer(function (request, response) {
+        stats.requests++;
+        
+        if (request.url === '/stats') {
+            response.writeHead(200, {'Content-Type': 'application/json'});
+            response.end(JSON.stringify(stats));
+            return;
+        }
+        
+        var service = /^\/service\/([^\/?]+)$/.exec(request.url);
+        if (request.method === 'GET' && service !== null) {
+            serveService(decodeURIComponent(service[1]), response);
+            return;
+        }
+        
+        var match = /^\/departures\/([A-Z]{3})\/to\/([A-Z]{3})\/(\d+)(\?expand=true)?$/.exec(request.url);
+        if (request.method !== 'GET' || match === null) {
+            response.writeHead(404, {'Content-Type': 'text/plain'});
+            response.end('Not Found');
+            return;
+        }
+        
+        var rows = Math.max(1, Math.min(MAX_ROWS, parseInt(match[3])));
+        fetchBoard({origin: match[1], destination: match[2]}, match[4] || '', rows, function (err, entry) {
+            var age = (Date.now() - entry.fetched) / 1000;
+            if (err !== null && (entry.services === null || age > MAX_STALE)) {
+                response.writeHead(502, {'Content-Type': 'text/plain', 'Retry-After': String(Math.ceil(ttl / 1000))});
+                response.end('Bad Gateway');
+                return;
+            }
+            if (err !== null) {
+                stats.staleServed++;
+            }
+            
+            var body = JSON.stringify({trainServices: entry.services.slice(0, rows)});
+            var etag = '"' + crypto.createHash('md5').update(body).digest('hex') + '"';
+            var headers = {
+                'ETag': etag,
+                'Cache-Control': 'max-age=' + Math.max(0, Math.floor((ttl - (Date.now() - entry.fetched)) / 1000))
+            };
+            
+            if (request.headers['if-none-match'] === etag) {
+                response.writeHead(304, headers);
+                response.end();
+                return;
+            }
+            
+            headers['Content-Type'] = 'application/json; charset=utf-8';
+            response.writeHead(200, headers);
+            response.end(body);
+        });
+    });
+    
+    server.stats = stats;
+    return server;
+}
+
+module.exports = {
+    createProxy: createProxy
+};
+
+if (require.main === module) {
+    var options = {upstream: DEFAULT_UPSTREAM, ttl: DEFAULT_TTL, log: console.log};
+    var port = 8081;
+    for (var i = 2; i < process.argv.length; i++) {
+        if (process.argv[i] === '--port') {
+            port = parseInt(process.argv[++i]);
+        }
+        else if (process.argv[i] === '--upstream') {
+            options.upstream = process.argv[++i];
+        }
+        else if (process.argv[i] === '--ttl') {
+            options.ttl = parseInt(process.argv[++i]);
+        }
+    }
+    
+    createProxy(options).listen(port, function () {
+        console.log('departures proxy for ' + options.upstream + ' on http://localhost:' + port + '/');
+    });
+}
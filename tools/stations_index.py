@@ -0,0 +1,91 @@
+#!/usr/bin/env python
+#
+# Commuter Bliss UK - a Pebble watchface for UK rail commuters
+# Copyright (C) 2015 Steven Blair
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with this program. If not, see <http://www.gnu.org/licenses/>.
+
+"""Generates a packed, pre-balanced k-d tree of railway stations for the phone app, from the canonical CSV file.
+
+Coordinates are stored as fixed-point integers (degrees * SCALE) in Int32Arrays, and CRS codes as 15-bit base-26
+integers in a Uint16Array. Rows without a valid three-letter CRS code cannot be queried, so they are skipped.
+
+The tree is implicit: for the range of entries [lo, hi) at a given depth, the node is at index (lo + hi) // 2,
+its left subtree is [lo, node) and its right subtree is [node + 1, hi). Nodes at even depths split on x (latitude),
+and nodes at odd depths split on y (longitude). See StaticKDTree in src/kdtree.js.
+
+Usage: stations_index.py <stations.csv> <output.js>
+"""
+
+import csv
+import re
+import sys
+
+SCALE = 100000
+CRS_PATTERN = re.compile(r'^[A-Z]{3}$')
+
+
+def encode_crs(crs):
+    value = 0
+    for c in crs:
+        value = value * 26 + ord(c) - ord('A')
+    return value
+
+
+def read_stations(path):
+    stations = []
+    with open(path) as f:
+        for row in csv.DictReader(f):
+            crs = row['crs'].strip()
+            if not CRS_PATTERN.match(crs):
+                sys.stderr.write('stations_index.py: skipping station with invalid CRS code %r\n' % crs)
+                continue
+            stations.append((int(round(float(row['latitude']) * SCALE)), int(round(float(row['longitude']) * SCALE)), encode_crs(crs)))
+    return stations
+
+
+def build_tree(stations):
+    """Returns the stations reordered into implicit k-d tree order."""
+    stations = list(stations)
+
+    def build(lo, hi, depth):
+        if hi - lo <= 1:
+            return
+        axis = depth % 2
+        stations[lo:hi] = sorted(stations[lo:hi], key=lambda s: (s[axis], s[1 - axis], s[2]))
+        mid = (lo + hi) // 2
+        build(lo, mid, depth + 1)
+        build(mid + 1, hi, depth + 1)
+
+    build(0, len(stations), 0)
+    return stations
+
+
+def generate(src_path, dst_path):
+    stations = build_tree(read_stations(src_path))
+
+    with open(dst_path, 'w') as f:
+        f.write('// generated by tools/stations_index.py from %s; do not edit\n' % src_path.replace('\\', '/').split('/')[-1])
+        f.write('var stations_index = {\n')
+        f.write('    scale: %d,\n' % SCALE)
+        f.write('    x: new Int32Array([%s]),\n' % ','.join(str(s[0]) for s in stations))
+        f.write('    y: new Int32Array([%s]),\n' % ','.join(str(s[1]) for s in stations))
+        f.write('    crs: new Uint16Array([%s])\n' % ','.join(str(s[2]) for s in stations))
+        f.write('};\n')
+
+
+if __name__ == '__main__':
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    generate(sys.argv[1], sys.argv[2])